@@ -13,6 +13,7 @@
 #include "MantidKernel/ThreadPool.h"
 #include "MantidNexusCpp/NeXusFile.hpp"
 
+#include <atomic>
 #include <numeric>
 #include <optional>
 #include <vector>
@@ -26,6 +27,9 @@ namespace API {
  *  - How the splitting will occur.
  *  - When a MDGridBox should use Tasks to parallelize adding events
  *
+ * Box IDs and the box counters are updated atomically, so boxes may be
+ * created and split by several threads at once without locking.
+ *
  * @author Janik Zikovsky
  * @date Feb 21, 2011
  */
@@ -69,24 +73,20 @@ public:
 
   //-----------------------------------------------------------------------------------
   /** @return the next available box Id.
-   * Call when creating a MDBox to give it an ID. */
-  size_t getNextId() { return m_maxId++; }
+   * Call when creating a MDBox to give it an ID. Thread safe. */
+  size_t getNextId() { return m_maxId.fetch_add(1, std::memory_order_relaxed); }
 
   //-----------------------------------------------------------------------------------
   /** @return the maximum (not-inclusive) ID number anywhere in the workspace.
    */
-  size_t getMaxId() const { return m_maxId; }
+  size_t getMaxId() const { return m_maxId.load(std::memory_order_relaxed); }
 
   //-----------------------------------------------------------------------------------
   /** Set the new maximum ID number anywhere in the workspace.
    * Should only be called when loading a file.
    * @param newMaxId value to set the newMaxId to
    */
-  void setMaxId(size_t newMaxId) { m_maxId = newMaxId; }
-
-  //-----------------------------------------------------------------------------------
-  /** @return the mutex for avoiding simultaneous assignments of box Ids. */
-  inline std::mutex &getIdMutex() { return m_idMutex; }
+  void setMaxId(size_t newMaxId) { m_maxId.store(newMaxId, std::memory_order_relaxed); }
 
   //-----------------------------------------------------------------------------------
   /** Return true if the MDBox should split, given :
@@ -274,23 +274,18 @@ public:
   }
   //-----------------------------------------------------------------------------------
 
-  void clearBoxesCounter(size_t depth) {
-    std::lock_guard<std::mutex> lock(m_mutexNumMDBoxes);
-    m_numMDBoxes[depth] = 0;
-  }
+  // The counters of boxes below may be changed by several threads at once. The
+  // vectors of counters are only resized by resetNumBoxes and setMaxDepth,
+  // which must not run while boxes are being split.
+  void clearBoxesCounter(size_t depth) { counter(m_numMDBoxes, depth).store(0, std::memory_order_relaxed); }
 
-  void clearGridBoxesCounter(size_t depth) {
-    std::lock_guard<std::mutex> lock(m_mutexNumMDBoxes);
-    m_numMDGridBoxes[depth] = 0;
-  }
+  void clearGridBoxesCounter(size_t depth) { counter(m_numMDGridBoxes, depth).store(0, std::memory_order_relaxed); }
   void incGridBoxesCounter(size_t depth, size_t inc = 1) {
-    std::lock_guard<std::mutex> lock(m_mutexNumMDBoxes);
-    m_numMDGridBoxes[depth] += inc;
+    counter(m_numMDGridBoxes, depth).fetch_add(inc, std::memory_order_relaxed);
   }
 
   void incBoxesCounter(size_t depth, size_t inc = 1) {
-    std::lock_guard<std::mutex> lock(m_mutexNumMDBoxes);
-    m_numMDBoxes[depth] += inc;
+    counter(m_numMDBoxes, depth).fetch_add(inc, std::memory_order_relaxed);
   }
 
   /** Call to track the number of MDBoxes are contained in the MDEventWorkspace
@@ -304,11 +299,11 @@ public:
    *boxes.
    */
   void trackNumBoxes(size_t depth) {
-    std::lock_guard<std::mutex> lock(m_mutexNumMDBoxes);
-    if (m_numMDBoxes[depth] > 0) {
-      m_numMDBoxes[depth]--;
+    auto numBoxes = counter(m_numMDBoxes, depth);
+    size_t current = numBoxes.load(std::memory_order_relaxed);
+    while (current > 0 && !numBoxes.compare_exchange_weak(current, current - 1, std::memory_order_relaxed)) {
     }
-    m_numMDGridBoxes[depth]++;
+    incGridBoxesCounter(depth);
 
     // We need to account for optional top level splitting
     if (depth == 0 && m_splitTopInto) {
@@ -316,9 +311,9 @@ public:
       const auto &splitTopInto = m_splitTopInto.value();
       size_t numSplitTop =
           std::accumulate(splitTopInto.cbegin(), splitTopInto.cend(), size_t{1}, std::multiplies<size_t>());
-      m_numMDBoxes[depth + 1] += numSplitTop;
+      incBoxesCounter(depth + 1, numSplitTop);
     } else {
-      m_numMDBoxes[depth + 1] += m_numSplit;
+      incBoxesCounter(depth + 1, m_numSplit);
     }
   }
 
@@ -358,9 +353,8 @@ public:
     return total / maxNumberOfFinestBoxes;
   }
 
-  /** Reset the number of boxes tracked in m_numMDBoxes */
+  /** Reset the number of boxes tracked in m_numMDBoxes. Not thread safe. */
   void resetNumBoxes() {
-    std::lock_guard<std::mutex> lock(m_mutexNumMDBoxes);
     m_numMDBoxes.clear();
     m_numMDBoxes.resize(m_maxDepth + 1, 0);     // Reset to 0
     m_numMDGridBoxes.resize(m_maxDepth + 1, 0); // Reset to 0
@@ -383,10 +377,10 @@ public:
   // void setChangesList(BoxCtrlChangesInterface *pl){m_ChangesList=pl;}
   //-----------------------------------------------------------------------------------
   // increase the counter, calculatinb events at max;
-  void rizeEventAtMax() { ++m_numEventsAtMax; }
+  void rizeEventAtMax() { m_numEventsAtMax.fetch_add(1, std::memory_order_relaxed); }
   /// return the numner of events, which are sitting at max depth and would be
   /// split if not due to the max depth of the box they are occupying
-  size_t getNumEventAtMax() const { return m_numEventsAtMax; }
+  size_t getNumEventAtMax() const { return m_numEventsAtMax.load(std::memory_order_relaxed); }
   /// get range of id-s and increment box ID by this range;
   size_t claimIDRange(size_t range);
 
@@ -398,6 +392,11 @@ public:
   bool useWriteBuffer() const;
 
 private:
+  /// @return the counter at the given depth, for atomic access
+  static std::atomic_ref<size_t> counter(std::vector<size_t> &counters, size_t depth) {
+    return std::atomic_ref<size_t>(counters[depth]);
+  }
+
   /// When you split a MDBox, it becomes this many sub-boxes
   void calcNumSplit() {
     m_numSplit = 1;
@@ -444,7 +443,7 @@ private:
 
   /** The maximum ID number of any boxes in the workspace (not inclusive,
    * i.e. maxId = 100 means there the highest ID number is 99.  */
-  size_t m_maxId;
+  std::atomic<size_t> m_maxId;
 
   /// Splitting threshold
   size_t m_SplitThreshold;
@@ -466,7 +465,7 @@ private:
   size_t m_maxDepth;
   /// number of events sitting in the boxes which should be split but are
   /// already split up to the max depth
-  volatile size_t m_numEventsAtMax;
+  std::atomic<size_t> m_numEventsAtMax;
 
   /// Splitting # for all dimensions
   std::vector<size_t> m_splitInto;
@@ -494,16 +493,10 @@ private:
   /// level
   std::vector<size_t> m_numMDGridBoxes;
 
-  /// Mutex for changing the number of MD Boxes.
-  std::mutex m_mutexNumMDBoxes;
-
   /// This is the maximum number of MD boxes there could be at each recursion
   /// level (e.g. (splitInto ^ ndims) ^ depth )
   std::vector<double> m_maxNumMDBoxes;
 
-  /// Mutex for getting IDs
-  std::mutex m_idMutex;
-
   // the class which does actual IO operations, including MRU support list
   std::shared_ptr<IBoxControllerIO> m_fileIO;
 
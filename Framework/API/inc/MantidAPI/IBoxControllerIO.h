@@ -7,6 +7,7 @@
 #pragma once
 #include "MantidAPI/DllConfig.h"
 #include "MantidKernel/DiskBuffer.h"
+#include "MantidKernel/ISaveable.h"
 
 namespace Mantid {
 namespace API {
@@ -49,8 +50,22 @@ public:
   virtual void loadBlock(std::vector<double> & /* Block */, const uint64_t /*blockPosition*/,
                          const size_t /*BlockSize*/) const = 0;
 
+  /** Hint that a data block will be loaded soon, so an implementation able to
+   * read ahead may start reading it in the background. Does nothing by default.
+   * The block has to be requested later with the same position and size. */
+  virtual void prefetchBlock(const uint64_t /*blockPosition*/, const size_t /*BlockSize*/) const {}
+  /** Hint that the data of a file-backed object will be loaded soon.
+   * Objects which are in memory or have never been saved are ignored. */
+  void prefetch(const Kernel::ISaveable *saveable) const {
+    if (saveable && saveable->wasSaved() && !saveable->isLoaded() && saveable->getFileSize() > 0)
+      this->prefetchBlock(saveable->getFilePosition(), static_cast<size_t>(saveable->getFileSize()));
+  }
+
   /** flush the IO buffers */
   virtual void flushData() const = 0;
+  /** flush the IO buffers after the data saved so far, without waiting for the
+   * data to be written if the implementation writes them in the background */
+  virtual void flushDataBehind() const { this->flushData(); }
   /** Close the file */
   virtual void closeFile() = 0;
 
@@ -386,6 +386,12 @@ public:
   /// Returns true if the workspace contains common X bins
   virtual bool isCommonBins() const;
 
+  /// Returns true if all the spectra share the same X data
+  bool isSharedX() const;
+
+  /// Make spectra with identical X values share the same X data
+  std::size_t shareIdenticalX();
+
   /// Returns true if the workspace has common, integer X bins
   virtual bool isIntegerBins() const;
 
@@ -555,6 +561,9 @@ private:
   mutable std::atomic<bool> m_isCommonBinsFlagValid{false};
   /// Flag indicating whether the data has common bins
   mutable std::atomic<bool> m_isCommonBinsFlag{false};
+  /// Flag indicating whether all the spectra share the same X data. It is
+  /// valid whenever m_isCommonBinsFlag is valid
+  mutable std::atomic<bool> m_isSharedXFlag{false};
   /// A mutex protecting the update of m_isCommonBinsFlag.
   mutable std::mutex m_isCommonBinsMutex;
 
@@ -0,0 +1,77 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+
+#include <map>
+#include <string>
+
+namespace Mantid {
+namespace API {
+
+/** WorkspaceExpression : A lazily evaluated arithmetic expression of
+ * workspaces and numbers. The operators only build up the expression, which
+ * is evaluated in a single pass by the EvaluateWorkspaceExpression algorithm
+ * when evaluate() is called, e.g.
+
+    auto result = ((WorkspaceExpression(a) - b) / c * 2.).evaluate("result");
+
+ * The expression holds on to its workspaces and passes them to the algorithm
+ * as input workspace properties, so they do not need to be in the
+ * AnalysisDataService. Those that are appear under their own names in the
+ * expression and in the history of the result.
+ */
+class MANTID_API_DLL WorkspaceExpression {
+public:
+  explicit WorkspaceExpression(const MatrixWorkspace_sptr &workspace);
+  explicit WorkspaceExpression(const double value);
+
+  /// The expression in the syntax accepted by EvaluateWorkspaceExpression
+  const std::string &str() const { return m_expression; }
+  MatrixWorkspace_sptr evaluate(const std::string &name = "", const bool child = true) const;
+
+  WorkspaceExpression operator-() const;
+  WorkspaceExpression &operator+=(const WorkspaceExpression &rhs);
+  WorkspaceExpression &operator-=(const WorkspaceExpression &rhs);
+  WorkspaceExpression &operator*=(const WorkspaceExpression &rhs);
+  WorkspaceExpression &operator/=(const WorkspaceExpression &rhs);
+
+private:
+  WorkspaceExpression &combine(const char op, const WorkspaceExpression &rhs);
+
+  std::string m_expression;
+  /// The workspaces of the expression, keyed by the name used for them in the expression
+  std::map<std::string, MatrixWorkspace_sptr> m_workspaces;
+};
+
+MANTID_API_DLL WorkspaceExpression operator+(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator-(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator*(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator/(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+
+MANTID_API_DLL WorkspaceExpression operator+(const WorkspaceExpression &lhs, const MatrixWorkspace_sptr &rhs);
+MANTID_API_DLL WorkspaceExpression operator-(const WorkspaceExpression &lhs, const MatrixWorkspace_sptr &rhs);
+MANTID_API_DLL WorkspaceExpression operator*(const WorkspaceExpression &lhs, const MatrixWorkspace_sptr &rhs);
+MANTID_API_DLL WorkspaceExpression operator/(const WorkspaceExpression &lhs, const MatrixWorkspace_sptr &rhs);
+MANTID_API_DLL WorkspaceExpression operator+(const MatrixWorkspace_sptr &lhs, const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator-(const MatrixWorkspace_sptr &lhs, const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator*(const MatrixWorkspace_sptr &lhs, const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator/(const MatrixWorkspace_sptr &lhs, const WorkspaceExpression &rhs);
+
+MANTID_API_DLL WorkspaceExpression operator+(const WorkspaceExpression &lhs, const double rhs);
+MANTID_API_DLL WorkspaceExpression operator-(const WorkspaceExpression &lhs, const double rhs);
+MANTID_API_DLL WorkspaceExpression operator*(const WorkspaceExpression &lhs, const double rhs);
+MANTID_API_DLL WorkspaceExpression operator/(const WorkspaceExpression &lhs, const double rhs);
+MANTID_API_DLL WorkspaceExpression operator+(const double lhs, const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator-(const double lhs, const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator*(const double lhs, const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator/(const double lhs, const WorkspaceExpression &rhs);
+
+} // namespace API
+} // namespace Mantid
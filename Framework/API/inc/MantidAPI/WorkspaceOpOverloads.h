@@ -8,6 +8,7 @@
 
 #include "MantidAPI/DllConfig.h"
 #include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidAPI/WorkspaceExpression.h"
 #include <string>
 
 namespace Mantid {
@@ -23,7 +24,8 @@ DLLExport ResultType executeBinaryOperation(const std::string &algorithmName, co
 
 bool MANTID_API_DLL equals(const MatrixWorkspace_sptr &lhs, const MatrixWorkspace_sptr &rhs, double tolerance = 0.0);
 
-// Workspace operator overloads
+// Workspace operator overloads. Each operator runs one algorithm; wrap the
+// first operand in a WorkspaceExpression to evaluate a chain in a single pass.
 MatrixWorkspace_sptr MANTID_API_DLL operator+(const MatrixWorkspace_sptr &lhs, const MatrixWorkspace_sptr &rhs);
 MatrixWorkspace_sptr MANTID_API_DLL operator-(const MatrixWorkspace_sptr &lhs, const MatrixWorkspace_sptr &rhs);
 MatrixWorkspace_sptr MANTID_API_DLL operator*(const MatrixWorkspace_sptr &lhs, const MatrixWorkspace_sptr &rhs);
@@ -39,9 +39,9 @@ BoxController *BoxController::clone() const {
 
 /*Private Copy constructor used in cloning */
 BoxController::BoxController(const BoxController &other)
-    : nd(other.nd), m_maxId(other.m_maxId), m_SplitThreshold(other.m_SplitThreshold),
+    : nd(other.nd), m_maxId(other.getMaxId()), m_SplitThreshold(other.m_SplitThreshold),
       m_significantEventsNumber(other.m_significantEventsNumber), m_maxDepth(other.m_maxDepth),
-      m_numEventsAtMax(other.m_numEventsAtMax), m_splitInto(other.m_splitInto), m_splitTopInto(other.m_splitTopInto),
+      m_numEventsAtMax(other.getNumEventAtMax()), m_splitInto(other.m_splitInto), m_splitTopInto(other.m_splitTopInto),
       m_numSplit(other.m_numSplit), m_numTopSplit(other.m_numTopSplit),
       m_addingEvents_eventsPerTask(other.m_addingEvents_eventsPerTask),
       m_addingEvents_numTasksPerBlock(other.m_addingEvents_numTasksPerBlock), m_numMDBoxes(other.m_numMDBoxes),
@@ -49,7 +49,7 @@ BoxController::BoxController(const BoxController &other)
       m_fileIO(std::shared_ptr<API::IBoxControllerIO>()) {}
 
 bool BoxController::operator==(const BoxController &other) const {
-  if (nd != other.nd || m_maxId != other.m_maxId || m_SplitThreshold != other.m_SplitThreshold ||
+  if (nd != other.nd || getMaxId() != other.getMaxId() || m_SplitThreshold != other.m_SplitThreshold ||
       m_maxDepth != other.m_maxDepth || m_numSplit != other.m_numSplit ||
       m_splitInto.size() != other.m_splitInto.size() || m_numMDBoxes.size() != other.m_numMDBoxes.size() ||
       m_numMDGridBoxes.size() != other.m_numMDGridBoxes.size() ||
@@ -89,7 +89,7 @@ bool BoxController::operator==(const BoxController &other) const {
   // There are number of variables which are
   // 1) derived:
   // Number of events sitting in the boxes which should be split but are already
-  // split up to the max depth: volatile size_t m_numEventsAtMax;
+  // split up to the max depth: m_numEventsAtMax;
   // 2) Dynamical and related to current processor and dynamical jobs
   // allocation:
   // For adding events tasks: size_t m_addingEvents_eventsPerTask;
@@ -108,16 +108,11 @@ BoxController::~BoxController() {
   }
 }
 /**reserve range of id-s for use on set of adjacent boxes.
- * Needed to be thread safe as adjacent boxes have to have subsequent ID-s
+ * Thread safe without locking, as adjacent boxes have to have subsequent ID-s
  * @param range  --range number of box-id-s to lock
  * @returns initial ID to use in the range
  */
-size_t BoxController::claimIDRange(size_t range) {
-  std::lock_guard<std::mutex> lock(m_idMutex);
-  size_t tmp = m_maxId;
-  m_maxId += range;
-  return tmp;
-}
+size_t BoxController::claimIDRange(size_t range) { return m_maxId.fetch_add(range, std::memory_order_relaxed); }
 /** Serialize to an XML string
  * @return XML string
  */
@@ -33,10 +33,12 @@
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/regex.hpp>
+#include <boost/functional/hash.hpp>
 
 #include <cmath>
 #include <functional>
 #include <numeric>
+#include <unordered_map>
 #include <utility>
 
 using Mantid::Kernel::StringListValidator;
@@ -122,6 +124,7 @@ MatrixWorkspace::MatrixWorkspace(const MatrixWorkspace &other)
   for (size_t i = 0; i < m_axes.size(); ++i)
     m_axes[i] = std::unique_ptr<Axis>(other.m_axes[i]->clone(this));
   m_isCommonBinsFlag.store(other.m_isCommonBinsFlag.load());
+  m_isSharedXFlag.store(other.m_isSharedXFlag.load());
   m_isCommonBinsFlagValid.store(other.m_isCommonBinsFlagValid.load());
   // TODO: Do we need to init m_monitorWorkspace?
 }
@@ -1116,6 +1119,7 @@ bool MatrixWorkspace::isCommonBins() const {
     return m_isCommonBinsFlag;
   }
   m_isCommonBinsFlag = true;
+  m_isSharedXFlag = true;
   const size_t numHist = this->getNumberHistograms();
   // there being only one or zero histograms is accepted as not being an error
   if (numHist <= 1) {
@@ -1127,6 +1131,7 @@ bool MatrixWorkspace::isCommonBins() const {
   for (size_t i = 1; i < numHist; ++i) {
     if (&x(i) != first) {
       m_isCommonBinsFlag = false;
+      m_isSharedXFlag = false;
       break;
     }
   }
@@ -1173,6 +1178,55 @@ bool MatrixWorkspace::isCommonBins() const {
   return m_isCommonBinsFlag;
 }
 
+/**
+ * Whether all the spectra share the same X data, rather than having separate
+ * copies of the same values. Shared X can be processed once for the whole
+ * workspace. The result is cached together with that of isCommonBins().
+ * @return whether all the spectra share the same X data
+ */
+bool MatrixWorkspace::isSharedX() const {
+  MatrixWorkspace::isCommonBins();
+  return m_isSharedXFlag;
+}
+
+/**
+ * Make the spectra with identical X values share the same X data, freeing
+ * the duplicated copies. The X values are grouped by a hash and compared
+ * exactly, so spectra with X that are only equal within a tolerance keep
+ * their own copy.
+ * @return the number of distinct X data left in the workspace
+ */
+std::size_t MatrixWorkspace::shareIdenticalX() {
+  const size_t numHist = getNumberHistograms();
+  // the first workspace index of each distinct X, grouped by hash
+  std::unordered_map<std::size_t, std::vector<size_t>> distinctX;
+  size_t numDistinct{0};
+  for (size_t i = 0; i < numHist; ++i) {
+    const auto &xi = x(i);
+    // spectra are commonly filled in order, so check the previous one first
+    if (i > 0 && &x(i - 1) == &xi)
+      continue;
+    auto &candidates = distinctX[boost::hash_range(xi.cbegin(), xi.cend())];
+    const auto match = std::find_if(candidates.cbegin(), candidates.cend(), [this, &xi](const size_t index) {
+      return &x(index) == &xi || x(index).rawData() == xi.rawData();
+    });
+    if (match == candidates.cend()) {
+      candidates.emplace_back(i);
+      ++numDistinct;
+    } else if (&x(*match) != &xi) {
+      setSharedX(i, sharedX(*match));
+    }
+  }
+
+  if (numDistinct <= 1) {
+    std::lock_guard<std::mutex> lock{m_isCommonBinsMutex};
+    m_isCommonBinsFlag = true;
+    m_isSharedXFlag = true;
+    m_isCommonBinsFlagValid = true;
+  }
+  return numDistinct;
+}
+
 /**
  * Whether the workspace's bins are integers - and common.
  * @return Whether the workspace's bins are integers - and common.
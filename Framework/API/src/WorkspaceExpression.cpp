@@ -0,0 +1,180 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidKernel/Property.h"
+
+#include <cmath>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+
+namespace Mantid::API {
+
+/** Constructor
+ * @param workspace :: a workspace, which need not be in the AnalysisDataService
+ * @throws std::invalid_argument if the workspace is null
+ */
+WorkspaceExpression::WorkspaceExpression(const MatrixWorkspace_sptr &workspace) {
+  if (!workspace)
+    throw std::invalid_argument("WorkspaceExpression: the workspace is null");
+  auto name = workspace->getName();
+  if (name.empty() || name.find('\'') != std::string::npos) {
+    // the expression syntax cannot quote this name so the workspace is given a unique placeholder
+    std::ostringstream placeholder;
+    placeholder << "__unnamed_" << workspace.get();
+    name = placeholder.str();
+  }
+  m_expression = "'" + name + "'";
+  m_workspaces.emplace(name, workspace);
+}
+
+/** Constructor
+ * @param value :: a finite number
+ * @throws std::invalid_argument if the number is infinite or NaN
+ */
+WorkspaceExpression::WorkspaceExpression(const double value) {
+  if (!std::isfinite(value))
+    throw std::invalid_argument("WorkspaceExpression: the number must be finite");
+  std::ostringstream out;
+  out.imbue(std::locale::classic());
+  // enough digits for the number to be read back exactly
+  out.precision(std::numeric_limits<double>::max_digits10);
+  out << std::fabs(value);
+  m_expression = std::signbit(value) ? "(-" + out.str() + ")" : out.str();
+}
+
+/** Evaluate the expression with the EvaluateWorkspaceExpression algorithm
+ * @param name :: if not empty the result is stored in the AnalysisDataService
+ * with this name
+ * @param child :: whether to run the algorithm as a child, which is not
+ * recorded in the history of the result
+ * @return the result
+ */
+MatrixWorkspace_sptr WorkspaceExpression::evaluate(const std::string &name, const bool child) const {
+  auto alg = AlgorithmManager::Instance().createUnmanaged("EvaluateWorkspaceExpression");
+  alg->setChild(child);
+  alg->setRethrows(true);
+  alg->initialize();
+  alg->setPropertyValue("Expression", m_expression);
+  // the algorithm declares an input workspace property for each name in the expression
+  for (const auto *property : alg->getProperties()) {
+    if (property->direction() != Kernel::Direction::Input)
+      continue;
+    const auto workspace = m_workspaces.find(property->value());
+    if (workspace != m_workspaces.cend())
+      alg->setProperty(property->name(), workspace->second);
+  }
+  if (name.empty()) {
+    alg->setAlwaysStoreInADS(false);
+    alg->setPropertyValue("OutputWorkspace", "dummy-output-name");
+  } else {
+    alg->setPropertyValue("OutputWorkspace", name);
+  }
+  alg->execute();
+
+  if (!alg->getAlwaysStoreInADS())
+    return alg->getProperty("OutputWorkspace");
+  return AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(name);
+}
+
+WorkspaceExpression WorkspaceExpression::operator-() const {
+  auto result(*this);
+  result.m_expression = "(-" + m_expression + ")";
+  return result;
+}
+
+WorkspaceExpression &WorkspaceExpression::operator+=(const WorkspaceExpression &rhs) { return combine('+', rhs); }
+WorkspaceExpression &WorkspaceExpression::operator-=(const WorkspaceExpression &rhs) { return combine('-', rhs); }
+WorkspaceExpression &WorkspaceExpression::operator*=(const WorkspaceExpression &rhs) { return combine('*', rhs); }
+WorkspaceExpression &WorkspaceExpression::operator/=(const WorkspaceExpression &rhs) { return combine('/', rhs); }
+
+/** Append a binary operation to the expression. Every operation is
+ * parenthesised so that the evaluation order is the order of the C++ operators.
+ * @param op :: the operator character
+ * @param rhs :: the right-hand operand
+ * @return this expression
+ * @throws std::invalid_argument if the operands hold different workspaces of the same name
+ */
+WorkspaceExpression &WorkspaceExpression::combine(const char op, const WorkspaceExpression &rhs) {
+  for (const auto &[name, workspace] : rhs.m_workspaces) {
+    const auto existing = m_workspaces.emplace(name, workspace).first;
+    if (existing->second != workspace)
+      throw std::invalid_argument("WorkspaceExpression: the expression refers to two different workspaces called " +
+                                  name);
+  }
+  m_expression = "(" + m_expression + " " + op + " " + rhs.m_expression + ")";
+  return *this;
+}
+
+WorkspaceExpression operator+(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) += rhs;
+}
+WorkspaceExpression operator-(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) -= rhs;
+}
+WorkspaceExpression operator*(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) *= rhs;
+}
+WorkspaceExpression operator/(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) /= rhs;
+}
+
+WorkspaceExpression operator+(const WorkspaceExpression &lhs, const MatrixWorkspace_sptr &rhs) {
+  return lhs + WorkspaceExpression(rhs);
+}
+WorkspaceExpression operator-(const WorkspaceExpression &lhs, const MatrixWorkspace_sptr &rhs) {
+  return lhs - WorkspaceExpression(rhs);
+}
+WorkspaceExpression operator*(const WorkspaceExpression &lhs, const MatrixWorkspace_sptr &rhs) {
+  return lhs * WorkspaceExpression(rhs);
+}
+WorkspaceExpression operator/(const WorkspaceExpression &lhs, const MatrixWorkspace_sptr &rhs) {
+  return lhs / WorkspaceExpression(rhs);
+}
+WorkspaceExpression operator+(const MatrixWorkspace_sptr &lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) + rhs;
+}
+WorkspaceExpression operator-(const MatrixWorkspace_sptr &lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) - rhs;
+}
+WorkspaceExpression operator*(const MatrixWorkspace_sptr &lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) * rhs;
+}
+WorkspaceExpression operator/(const MatrixWorkspace_sptr &lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) / rhs;
+}
+
+WorkspaceExpression operator+(const WorkspaceExpression &lhs, const double rhs) {
+  return lhs + WorkspaceExpression(rhs);
+}
+WorkspaceExpression operator-(const WorkspaceExpression &lhs, const double rhs) {
+  return lhs - WorkspaceExpression(rhs);
+}
+WorkspaceExpression operator*(const WorkspaceExpression &lhs, const double rhs) {
+  return lhs * WorkspaceExpression(rhs);
+}
+WorkspaceExpression operator/(const WorkspaceExpression &lhs, const double rhs) {
+  return lhs / WorkspaceExpression(rhs);
+}
+WorkspaceExpression operator+(const double lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) + rhs;
+}
+WorkspaceExpression operator-(const double lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) - rhs;
+}
+WorkspaceExpression operator*(const double lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) * rhs;
+}
+WorkspaceExpression operator/(const double lhs, const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) / rhs;
+}
+
+} // namespace Mantid::API
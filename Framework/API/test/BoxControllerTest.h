@@ -10,6 +10,8 @@
 #include "MantidAPI/IBoxControllerIO.h"
 #include "MantidFrameworkTestHelpers/BoxControllerDummyIO.h"
 #include "MantidKernel/DiskBuffer.h"
+#include "MantidKernel/MultiThreaded.h"
+#include <algorithm>
 #include <cxxtest/TestSuite.h>
 #include <map>
 #include <memory>
@@ -75,6 +77,33 @@ public:
     TS_ASSERT_EQUALS(sc.getMaxDepth(), 6);
   }
 
+  void test_IDs_and_counters_are_consistent_when_updated_concurrently() {
+    BoxController bc(2);
+    bc.setSplitInto(10);
+    bc.setMaxDepth(4);
+    bc.trackNumBoxes(0);
+
+    const int numSplits = 100;
+    std::vector<size_t> firstIDs(numSplits);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < numSplits; i++) {
+      firstIDs[i] = bc.claimIDRange(100);
+      bc.trackNumBoxes(1);
+      bc.rizeEventAtMax();
+    }
+
+    // the ranges of IDs do not overlap
+    std::sort(firstIDs.begin(), firstIDs.end());
+    for (size_t i = 0; i < firstIDs.size(); i++)
+      TS_ASSERT_EQUALS(firstIDs[i], i * 100);
+    TS_ASSERT_EQUALS(bc.getMaxId(), numSplits * 100);
+    TS_ASSERT_EQUALS(bc.getNumEventAtMax(), numSplits);
+
+    TS_ASSERT_EQUALS(bc.getNumMDBoxes()[1], 0);
+    TS_ASSERT_EQUALS(bc.getNumMDGridBoxes()[1], numSplits);
+    TS_ASSERT_EQUALS(bc.getNumMDBoxes()[2], numSplits * 100);
+  }
+
   void test_maxNumBoxes() {
     BoxController sc(3);
     sc.setSplitInto(10);
@@ -480,6 +480,37 @@ public:
     TS_ASSERT_EQUALS(ws.isCommonBins(), false);
   }
 
+  void testIsSharedX() {
+    WorkspaceTester ws;
+    ws.initialize(10, 10, 10);
+    TS_ASSERT(ws.isSharedX());
+    // A detached copy with identical values is common but no longer shared
+    ws.mutableX(3)[0] = ws.x(3)[0];
+    TS_ASSERT(ws.isCommonBins());
+    TS_ASSERT_EQUALS(ws.isSharedX(), false);
+  }
+
+  void testShareIdenticalX() {
+    WorkspaceTester ws;
+    ws.initialize(6, 3, 2);
+    for (size_t i = 0; i < ws.getNumberHistograms(); ++i)
+      ws.setBinEdges(i, HistogramData::BinEdges{0., i % 2 == 0 ? 1. : 2., 3.});
+    TS_ASSERT_EQUALS(ws.isSharedX(), false);
+
+    TS_ASSERT_EQUALS(ws.shareIdenticalX(), 2);
+    TS_ASSERT_EQUALS(&ws.x(0), &ws.x(2));
+    TS_ASSERT_EQUALS(&ws.x(0), &ws.x(4));
+    TS_ASSERT_EQUALS(&ws.x(1), &ws.x(5));
+    TS_ASSERT_DIFFERS(&ws.x(0), &ws.x(1));
+    TS_ASSERT_EQUALS(ws.x(5)[1], 2.);
+
+    for (size_t i = 0; i < ws.getNumberHistograms(); ++i)
+      ws.setBinEdges(i, HistogramData::BinEdges{0., 1., 3.});
+    TS_ASSERT_EQUALS(ws.shareIdenticalX(), 1);
+    TS_ASSERT(ws.isSharedX());
+    TS_ASSERT(ws.isCommonBins());
+  }
+
   void testIsCommonLogAxis() {
     WorkspaceTester ws;
     ws.initialize(10, 10, 10);
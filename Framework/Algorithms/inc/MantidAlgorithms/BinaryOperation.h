@@ -112,6 +112,40 @@ protected:
   virtual void performBinaryOperation(const HistogramData::Histogram &lhs, const double rhsY, const double rhsE,
                                       HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) = 0;
 
+  /// Whether the operation implements performArrayOperation(), which lets
+  /// histogram workspaces be processed in blocks of spectra
+  virtual bool hasArrayOperation() const { return false; }
+
+  /** Carries out the binary operation on plain arrays of bins, with another
+   * array as the right-hand operand. The output arrays may be the same as
+   * either input.
+   *
+   *  @param lhsY :: Lhs data values
+   *  @param lhsE :: Lhs error values
+   *  @param rhsY :: Rhs data values
+   *  @param rhsE :: Rhs error values
+   *  @param YOut :: Data values resulting from the operation
+   *  @param EOut :: Error values resulting from the operation
+   *  @param size :: The number of bins
+   */
+  virtual void performArrayOperation(const double *lhsY, const double *lhsE, const double *rhsY, const double *rhsE,
+                                     double *YOut, double *EOut, const std::size_t size);
+
+  /** Carries out the binary operation on plain arrays of bins when the right
+   * hand operand is a single number. The output arrays may be the same as the
+   * input ones.
+   *
+   *  @param lhsY :: Lhs data values
+   *  @param lhsE :: Lhs error values
+   *  @param rhsY :: The rhs data value
+   *  @param rhsE :: The rhs error value
+   *  @param YOut :: Data values resulting from the operation
+   *  @param EOut :: Error values resulting from the operation
+   *  @param size :: The number of bins
+   */
+  virtual void performArrayOperation(const double *lhsY, const double *lhsE, const double rhsY, const double rhsE,
+                                     double *YOut, double *EOut, const std::size_t size);
+
   // ===================================== EVENT LIST BINARY OPERATIONS
   // ==========================================
 
@@ -48,6 +48,11 @@ private:
                               HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) override;
   void performBinaryOperation(const HistogramData::Histogram &lhs, const double rhsY, const double rhsE,
                               HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) override;
+  bool hasArrayOperation() const override { return true; }
+  void performArrayOperation(const double *lhsY, const double *lhsE, const double *rhsY, const double *rhsE,
+                             double *YOut, double *EOut, const std::size_t size) override;
+  void performArrayOperation(const double *lhsY, const double *lhsE, const double rhsY, const double rhsE,
+                             double *YOut, double *EOut, const std::size_t size) override;
   void setOutputUnits(const API::MatrixWorkspace_const_sptr lhs, const API::MatrixWorkspace_const_sptr rhs,
                       API::MatrixWorkspace_sptr out) override;
 
@@ -0,0 +1,77 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidAlgorithms/DllConfig.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Algorithms {
+/** EvaluateWorkspaceExpression : Evaluates an arithmetic expression of
+ * workspaces and numbers, such as (a - b) / c * 2, in a single pass over the
+ * spectra. No intermediate workspaces are created and the algorithm adds a
+ * single entry to the history. The values, errors, units and logs are the
+ * same as those given by the equivalent chain of Plus, Minus, Multiply and
+ * Divide, and spectra or bins masked in any input are masked in the output.
+ *
+ * Setting the expression declares one input workspace property for each
+ * workspace named in it, InputWorkspace, InputWorkspace_1, ..., which are set
+ * to the workspaces of that name. Like any other input workspace they may
+ * instead be set to a workspace directly.
+ */
+class MANTID_ALGORITHMS_DLL EvaluateWorkspaceExpression : public API::Algorithm {
+public:
+  const std::string name() const override { return "EvaluateWorkspaceExpression"; }
+  /// Summary of algorithms purpose
+  const std::string summary() const override {
+    return "Evaluates an arithmetic expression of workspaces and numbers in a single pass, without creating "
+           "intermediate workspaces.";
+  }
+  int version() const override { return 1; }
+  const std::vector<std::string> seeAlso() const override { return {"Plus", "Minus", "Multiply", "Divide"}; }
+  const std::string category() const override { return "Arithmetic"; }
+  std::map<std::string, std::string> validateInputs() override;
+
+  /// An instruction of the compiled expression, which is run on a stack
+  struct Instruction {
+    enum class Opcode { PushWorkspace, PushValue, Add, Subtract, Multiply, Divide, Negate };
+    Opcode opcode;
+    /// Index into the workspace names for PushWorkspace
+    size_t workspace{0};
+    /// The number for PushValue
+    double value{0.};
+  };
+
+  /// The compiled form of an expression
+  struct Program {
+    /// Instructions in postfix order
+    std::vector<Instruction> instructions;
+    /// Names of the workspaces in the expression, each once, in order of first appearance
+    std::vector<std::string> workspaceNames;
+    /// Largest number of operands on the stack while running the program
+    size_t stackDepth{0};
+  };
+
+  static Program compile(const std::string &expression);
+  static std::string operandPropertyName(const size_t index);
+
+private:
+  void init() override;
+  void exec() override;
+  void afterPropertySet(const std::string &name) override;
+
+  /// Names of the input workspace properties declared for the current expression
+  std::vector<std::string> m_operandProperties;
+};
+
+} // namespace Algorithms
+} // namespace Mantid
@@ -10,6 +10,7 @@
 #include "MantidAlgorithms/DllConfig.h"
 #include "MantidGeometry/IDTypes.h"
 #include <set>
+#include <vector>
 
 namespace Mantid {
 namespace Algorithms {
@@ -73,6 +74,9 @@ private:
 
   API::MatrixWorkspace_sptr replaceSpecialValues();
   void determineIndices(const size_t numberOfSpectra);
+  /// Combine partial sums pairwise in a fixed order
+  template <typename T, typename Combine>
+  void reduceInTree(std::vector<T> &partials, const Combine &combine, const bool runParallel);
 
   /// The output spectrum number
   specnum_t m_outSpecNum{0};
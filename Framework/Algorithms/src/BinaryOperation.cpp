@@ -21,7 +21,9 @@
 #include "MantidHistogramData/Histogram.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/Unit.h"
+#include <algorithm>
 #include <memory>
+#include <stdexcept>
 
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
@@ -31,6 +33,11 @@ using namespace Mantid::HistogramData;
 using std::size_t;
 
 namespace Mantid::Algorithms {
+namespace {
+/// Number of spectra handed to performArrayOperation() by one thread between progress reports
+constexpr int64_t SPECTRA_PER_BLOCK{64};
+} // namespace
+
 /** Initialisation method.
  *  Defines input and output workspaces
  *
@@ -471,6 +478,29 @@ void BinaryOperation::doSingleValue() {
     PARALLEL_CHECK_INTERRUPT_REGION
   } else {
     // ---- Histogram Output -----
+    if (hasArrayOperation() && !m_elhs) {
+      // Work on the bins directly, a block of spectra at a time
+      const int64_t numBlocks = (numHists + SPECTRA_PER_BLOCK - 1) / SPECTRA_PER_BLOCK;
+      PARALLEL_FOR_IF(Kernel::threadSafe(*m_lhs, *m_rhs, *m_out))
+      for (int64_t block = 0; block < numBlocks; ++block) {
+        PARALLEL_START_INTERRUPT_REGION
+        const int64_t start = block * SPECTRA_PER_BLOCK;
+        const int64_t end = std::min(start + SPECTRA_PER_BLOCK, numHists);
+        for (int64_t i = start; i < end; ++i) {
+          m_out->setSharedX(i, m_lhs->sharedX(i));
+          // Break any sharing of the output before the input is looked at
+          auto &outY = m_out->mutableY(i);
+          auto &outE = m_out->mutableE(i);
+          const auto &lhsY = m_lhs->y(i);
+          performArrayOperation(lhsY.data(), m_lhs->e(i).data(), rhsY, rhsE, outY.data(), outE.data(), lhsY.size());
+        }
+        m_progress->reportIncrement(static_cast<size_t>(end - start), this->name());
+        PARALLEL_END_INTERRUPT_REGION
+      }
+      PARALLEL_CHECK_INTERRUPT_REGION
+      return;
+    }
+
     PARALLEL_FOR_IF(Kernel::threadSafe(*m_lhs, *m_rhs, *m_out))
     for (int64_t i = 0; i < numHists; ++i) {
       PARALLEL_START_INTERRUPT_REGION
@@ -722,6 +752,32 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
     // Now loop over the spectra of each one calling the virtual function
     const int64_t numHists = m_lhs->getNumberHistograms();
 
+    if (hasArrayOperation() && !m_elhs && !m_erhs && !table) {
+      // Work on the bins directly, a block of spectra at a time
+      const int64_t numBlocks = (numHists + SPECTRA_PER_BLOCK - 1) / SPECTRA_PER_BLOCK;
+      PARALLEL_FOR_IF(Kernel::threadSafe(*m_lhs, *m_rhs, *m_out))
+      for (int64_t block = 0; block < numBlocks; ++block) {
+        PARALLEL_START_INTERRUPT_REGION
+        const int64_t start = block * SPECTRA_PER_BLOCK;
+        const int64_t end = std::min(start + SPECTRA_PER_BLOCK, numHists);
+        for (int64_t i = start; i < end; ++i) {
+          m_out->setSharedX(i, m_lhs->sharedX(i));
+          if (!propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i, *m_out, outSpectrumInfo))
+            continue;
+          // Break any sharing of the output before the inputs are looked at
+          auto &outY = m_out->mutableY(i);
+          auto &outE = m_out->mutableE(i);
+          const auto &lhsY = m_lhs->y(i);
+          performArrayOperation(lhsY.data(), m_lhs->e(i).data(), m_rhs->y(i).data(), m_rhs->e(i).data(), outY.data(),
+                                outE.data(), lhsY.size());
+        }
+        m_progress->reportIncrement(static_cast<size_t>(end - start), this->name());
+        PARALLEL_END_INTERRUPT_REGION
+      }
+      PARALLEL_CHECK_INTERRUPT_REGION
+      return;
+    }
+
     PARALLEL_FOR_IF(Kernel::threadSafe(*m_lhs, *m_rhs, *m_out))
     for (int64_t i = 0; i < numHists; ++i) {
       PARALLEL_START_INTERRUPT_REGION
@@ -759,6 +815,18 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
     m_erhs->clearMRU();
 }
 
+/// Not used, as hasArrayOperation() is false unless an operation overrides this
+void BinaryOperation::performArrayOperation(const double *, const double *, const double *, const double *, double *,
+                                            double *, const std::size_t) {
+  throw std::logic_error(name() + " does not implement performArrayOperation()");
+}
+
+/// Not used, as hasArrayOperation() is false unless an operation overrides this
+void BinaryOperation::performArrayOperation(const double *, const double *, const double, const double, double *,
+                                            double *, const std::size_t) {
+  throw std::logic_error(name() + " does not implement performArrayOperation()");
+}
+
 /** Copies any bin masking from the smaller/rhs input workspace to the output.
  *  Masks on the other input workspace are copied automatically by the workspace
  * factory.
@@ -437,13 +437,31 @@ MatrixWorkspace_sptr ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUni
     }
     outSpectrumInfo.getDetectorValues(*fromUnit, *outputUnit, emode, signedTheta, i, pmap);
     try {
-      localFromUnit->toTOF(outputWS->dataX(i), emptyVec, l1, emode, pmap);
-      // Convert from time-of-flight to the desired unit
-      localOutputUnit->fromTOF(outputWS->dataX(i), emptyVec, l1, emode, pmap);
-
-      // EventWorkspace part, modifying the EventLists.
-      if (m_inputEvents) {
-        eventWS->getSpectrum(i).convertUnitsViaTof(localFromUnit.get(), localOutputUnit.get());
+      localFromUnit->initialize(l1, emode, pmap);
+      localOutputUnit->initialize(l1, emode, pmap);
+      // For this detector most conversions reduce to a single linear or
+      // reciprocal transform, which saves going through TOF for every value
+      std::optional<ClosedFormConversion> conversion;
+      const auto toTOF = localFromUnit->closedFormToTOF();
+      const auto fromTOF = localOutputUnit->closedFormFromTOF();
+      if (toTOF && fromTOF)
+        conversion = toTOF->then(*fromTOF);
+
+      if (conversion) {
+        auto &x = outputWS->dataX(i);
+        conversion->apply(x.data(), x.data() + x.size());
+        if (m_inputEvents)
+          eventWS->getSpectrum(i).convertUnitsViaTof(*conversion);
+      } else {
+        auto &x = outputWS->dataX(i);
+        localFromUnit->batchToTOF(x);
+        // Convert from time-of-flight to the desired unit
+        localOutputUnit->batchFromTOF(x);
+
+        // EventWorkspace part, modifying the EventLists.
+        if (m_inputEvents) {
+          eventWS->getSpectrum(i).convertUnitsViaTof(localFromUnit.get(), localOutputUnit.get());
+        }
       }
     } catch (std::runtime_error &) {
       // Get to here if exception thrown in unit conversion eg when calculating
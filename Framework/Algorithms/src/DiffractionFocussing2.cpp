@@ -69,6 +69,10 @@ void DiffractionFocussing2::init() {
   declareProperty(std::make_unique<ArrayProperty<double>>("Delta"),
                   "Step parameters for rebin, positive values are constant step-size, negative are logorithmic. One "
                   "value for each output specta or single value which is common to all");
+  declareProperty("CompressTolerance", EMPTY_DBL(),
+                  "Optional: if set, the events of each group are compressed with this tolerance once the group is "
+                  "built, as CompressEvents would do. Only used when focussing an EventWorkspace with "
+                  "PreserveEvents.");
 }
 
 std::map<std::string, std::string> DiffractionFocussing2::validateInputs() {
@@ -457,13 +461,12 @@ void DiffractionFocussing2::execEvent() {
   prog.reset();
   prog = std::make_unique<Progress>(this, 0.25, 0.3, totalHistProcess);
 
-  // This creates and reserves the space required
+  // This creates the output lists; the space is reserved when they are filled
   for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
     const auto group = static_cast<int>(m_validGroups[iGroup]);
     EventList &groupEL = eventOutputW->getSpectrum(iGroup);
     groupEL.switchTo(eventWtype);
     groupEL.clear(true); // remove detector ids
-    groupEL.reserve(size_required[iGroup]);
     groupEL.setSpectrumNo(group);
     prog->reportIncrement(1, "Allocating");
   }
@@ -472,67 +475,73 @@ void DiffractionFocussing2::execEvent() {
   prog.reset();
   prog = std::make_unique<Progress>(this, 0.3, 0.9, totalHistProcess);
 
-  if (this->m_validGroups.size() == 1) {
-    g_log.information() << "Performing focussing on a single group\n";
-    // Special case of a single group - parallelize differently
-    EventList &groupEL = eventOutputW->getSpectrum(0);
-    const std::vector<size_t> &indices = this->m_wsIndices[0];
-
-    constexpr int chunkSize{200};
-
-    const int end = (totalHistProcess / chunkSize) + 1;
-
-    PRAGMA_OMP(parallel for schedule(dynamic, 1) )
-    for (int wiChunk = 0; wiChunk < end; wiChunk++) {
-      PARALLEL_START_INTERRUPT_REGION
-
-      // Perform in chunks for more efficiency
-      int max = (wiChunk + 1) * chunkSize;
-      if (max > totalHistProcess)
-        max = totalHistProcess;
-
-      // Make a blank EventList that will accumulate the chunk.
-      EventList chunkEL;
-      chunkEL.switchTo(eventWtype);
-      // chunkEL.reserve(numEventsInChunk);
-
-      // process the chunk
-      for (int i = wiChunk * chunkSize; i < max; i++) {
-        // Accumulate the chunk
-        size_t wi = indices[i];
-        chunkEL += eventinputWS->getSpectrum(wi);
+  // Split every group into chunks of spectra, so that all the threads have
+  // work even when there are fewer groups than threads or the groups are of
+  // very different sizes
+  constexpr size_t chunkSize{200};
+  struct Chunk {
+    size_t group;
+    size_t begin;
+    size_t end;
+  };
+  std::vector<Chunk> chunks;
+  // the chunks of group i are chunks[firstChunk[i]] to chunks[firstChunk[i + 1] - 1]
+  std::vector<size_t> firstChunk;
+  for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
+    firstChunk.emplace_back(chunks.size());
+    const size_t numIndices = this->m_wsIndices[iGroup].size();
+    for (size_t begin = 0; begin < numIndices; begin += chunkSize)
+      chunks.push_back({iGroup, begin, std::min(begin + chunkSize, numIndices)});
+  }
+  firstChunk.emplace_back(chunks.size());
+
+  // Each chunk is appended to its own event list, so there is no locking
+  // while the events are copied. The lists are merged at the end in chunk
+  // order, so the events are in the same order whatever thread ran a chunk.
+  std::vector<EventList> chunkLists(chunks.size());
+  const bool runParallel = Kernel::threadSafe(*eventinputWS);
+  const auto numChunks = static_cast<int>(chunks.size());
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (runParallel))
+  for (int iChunk = 0; iChunk < numChunks; iChunk++) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto &chunk = chunks[iChunk];
+    const std::vector<size_t> &indices = this->m_wsIndices[chunk.group];
+    EventList &chunkEL = chunkLists[iChunk];
+    chunkEL.switchTo(eventWtype);
+    for (size_t i = chunk.begin; i < chunk.end; i++) {
+      const size_t wi = indices[i];
+      chunkEL += eventinputWS->getSpectrum(wi);
+      // When focussing in place, you can clear out old memory from the input
+      // one!
+      if (inPlace) {
+        std::const_pointer_cast<EventWorkspace>(eventinputWS)->getSpectrum(wi).clear(true);
       }
+    }
+    prog->reportIncrement(static_cast<int>(chunk.end - chunk.begin), "Appending Lists");
 
-      // Rejoin the chunk with the rest.
-      PARALLEL_CRITICAL(DiffractionFocussing2_JoinChunks) { groupEL += chunkEL; }
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
 
-      PARALLEL_END_INTERRUPT_REGION
-    }
-    PARALLEL_CHECK_INTERRUPT_REGION
-  } else {
-    // ------ PARALLELIZE BY GROUPS -------------------------
-
-    auto nValidGroups = static_cast<int>(this->m_validGroups.size());
-    PARALLEL_FOR_IF(Kernel::threadSafe(*eventinputWS))
-    for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
-      PARALLEL_START_INTERRUPT_REGION
-      const std::vector<size_t> &indices = this->m_wsIndices[iGroup];
-      for (auto wi : indices) {
-        // In workspace index iGroup, put what was in the OLD workspace index wi
-        eventOutputW->getSpectrum(iGroup) += eventinputWS->getSpectrum(wi);
-
-        prog->reportIncrement(1, "Appending Lists");
-
-        // When focussing in place, you can clear out old memory from the input
-        // one!
-        if (inPlace) {
-          std::const_pointer_cast<EventWorkspace>(eventinputWS)->getSpectrum(wi).clear(true);
-        }
-      }
-      PARALLEL_END_INTERRUPT_REGION
+  // Merge the lists of the chunks, in chunk order, into the output
+  const double compressTolerance = getProperty("CompressTolerance");
+  const bool compress = !isEmpty(compressTolerance);
+  const auto nValidGroups = static_cast<int>(this->m_validGroups.size());
+  PARALLEL_FOR_IF(runParallel)
+  for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
+    PARALLEL_START_INTERRUPT_REGION
+    EventList &groupEL = eventOutputW->getSpectrum(iGroup);
+    groupEL.reserve(size_required[iGroup]);
+    for (size_t iChunk = firstChunk[iGroup]; iChunk < firstChunk[iGroup + 1]; iChunk++) {
+      groupEL += chunkLists[iChunk];
+      // release the memory as soon as it has been copied
+      chunkLists[iChunk].clear(true);
     }
-    PARALLEL_CHECK_INTERRUPT_REGION
-  } // (done with parallel by groups)
+    if (compress)
+      groupEL.compressEvents(compressTolerance, &groupEL);
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
 
   // Now that the data is cleaned up, go through it and set the X vectors to the
   // input workspace we first talked about.
@@ -6,6 +6,8 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/Divide.h"
 
+#include <cmath>
+
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 using namespace Mantid::DataObjects;
@@ -30,12 +32,21 @@ void Divide::exec() {
 
 void Divide::performBinaryOperation(const HistogramData::Histogram &lhs, const HistogramData::Histogram &rhs,
                                     HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) {
-  const auto bins = static_cast<int>(lhs.e().size());
+  performArrayOperation(lhs.y().data(), lhs.e().data(), rhs.y().data(), rhs.e().data(), YOut.data(), EOut.data(),
+                        lhs.e().size());
+}
+
+void Divide::performBinaryOperation(const HistogramData::Histogram &lhs, const double rhsY, const double rhsE,
+                                    HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) {
+  performArrayOperation(lhs.y().data(), lhs.e().data(), rhsY, rhsE, YOut.data(), EOut.data(), lhs.e().size());
+}
 
-  for (int j = 0; j < bins; ++j) {
-    // Get references to the input Y's
-    const double leftY = lhs.y()[j];
-    const double rightY = rhs.y()[j];
+void Divide::performArrayOperation(const double *lhsY, const double *lhsE, const double *rhsY, const double *rhsE,
+                                   double *YOut, double *EOut, const std::size_t size) {
+  for (std::size_t j = 0; j < size; ++j) {
+    // Get the input Y's
+    const double leftY = lhsY[j];
+    const double rightY = rhsY[j];
 
     //  error dividing two uncorrelated numbers, re-arrange so that you don't
     //  get infinity if leftY==0 (when rightY=0 the Y value and the result will
@@ -44,7 +55,7 @@ void Divide::performBinaryOperation(const HistogramData::Histogram &lhs, const H
     // (Sa c/a)2 + (Sb c/b)2 = (Sc)2
     // = (Sa 1/b)2 + (Sb (a/b2))2
     // (Sc)2 = (1/b)2( (Sa)2 + (Sb a/b)2 )
-    EOut[j] = sqrt(pow(lhs.e()[j], 2) + pow(leftY * rhs.e()[j] / rightY, 2)) / fabs(rightY);
+    EOut[j] = sqrt(pow(lhsE[j], 2) + pow(leftY * rhsE[j] / rightY, 2)) / fabs(rightY);
 
     // Copy the result last in case one of the input workspaces is also any
     // output
@@ -52,8 +63,8 @@ void Divide::performBinaryOperation(const HistogramData::Histogram &lhs, const H
   }
 }
 
-void Divide::performBinaryOperation(const HistogramData::Histogram &lhs, const double rhsY, const double rhsE,
-                                    HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) {
+void Divide::performArrayOperation(const double *lhsY, const double *lhsE, const double rhsY, const double rhsE,
+                                   double *YOut, double *EOut, const std::size_t size) {
   if (rhsY == 0 && m_warnOnZeroDivide)
     g_log.warning() << "Division by zero: the RHS is a single-valued vector "
                        "with value zero."
@@ -61,13 +72,12 @@ void Divide::performBinaryOperation(const HistogramData::Histogram &lhs, const d
 
   // Do the right-hand part of the error calculation just once
   const double rhsFactor = pow(rhsE / rhsY, 2);
-  const auto bins = static_cast<int>(lhs.e().size());
-  for (int j = 0; j < bins; ++j) {
-    // Get reference to input Y
-    const double leftY = lhs.y()[j];
+  for (std::size_t j = 0; j < size; ++j) {
+    // Get the input Y
+    const double leftY = lhsY[j];
 
     // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhs.e()[j], 2) + pow(leftY, 2) * rhsFactor) / fabs(rhsY);
+    EOut[j] = sqrt(pow(lhsE[j], 2) + pow(leftY, 2) * rhsFactor) / fabs(rhsY);
     // Copy the result last in case one of the input workspaces is also any
     // output
     YOut[j] = leftY / rhsY;
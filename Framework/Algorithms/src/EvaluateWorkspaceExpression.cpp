@@ -0,0 +1,758 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/EvaluateWorkspaceExpression.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Progress.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <stdexcept>
+
+namespace Mantid::Algorithms {
+
+using namespace Kernel;
+using namespace API;
+using Instruction = EvaluateWorkspaceExpression::Instruction;
+using Opcode = EvaluateWorkspaceExpression::Instruction::Opcode;
+
+// Register the class into the algorithm factory
+DECLARE_ALGORITHM(EvaluateWorkspaceExpression)
+
+namespace {
+/// Number of consecutive spectra evaluated with one set of scratch buffers
+constexpr size_t SPECTRA_PER_BLOCK{64};
+
+/// Recursive descent parser turning an infix expression into a postfix program
+class ExpressionParser {
+public:
+  explicit ExpressionParser(const std::string &text) : m_text(text) {}
+
+  EvaluateWorkspaceExpression::Program parse() {
+    parseSum();
+    skipSpaces();
+    if (m_pos != m_text.size())
+      fail("Unexpected '" + std::string(1, m_text[m_pos]) + "'");
+    return std::move(m_program);
+  }
+
+private:
+  void parseSum() {
+    parseProduct();
+    for (skipSpaces(); m_pos < m_text.size() && (m_text[m_pos] == '+' || m_text[m_pos] == '-'); skipSpaces()) {
+      const auto opcode = m_text[m_pos++] == '+' ? Opcode::Add : Opcode::Subtract;
+      parseProduct();
+      emit({opcode});
+    }
+  }
+
+  void parseProduct() {
+    parseFactor();
+    for (skipSpaces(); m_pos < m_text.size() && (m_text[m_pos] == '*' || m_text[m_pos] == '/'); skipSpaces()) {
+      const auto opcode = m_text[m_pos++] == '*' ? Opcode::Multiply : Opcode::Divide;
+      parseFactor();
+      emit({opcode});
+    }
+  }
+
+  void parseFactor() {
+    skipSpaces();
+    if (m_pos == m_text.size())
+      fail("Unexpected end of expression");
+    const char next = m_text[m_pos];
+    if (next == '-') {
+      ++m_pos;
+      parseFactor();
+      emit({Opcode::Negate});
+    } else if (next == '+') {
+      ++m_pos;
+      parseFactor();
+    } else if (next == '(') {
+      ++m_pos;
+      parseSum();
+      skipSpaces();
+      if (m_pos == m_text.size() || m_text[m_pos] != ')')
+        fail("Expected ')'");
+      ++m_pos;
+    } else if (std::isdigit(static_cast<unsigned char>(next)) || next == '.') {
+      const char *start = m_text.c_str() + m_pos;
+      char *end = nullptr;
+      const double value = std::strtod(start, &end);
+      if (end == start)
+        fail("Invalid number");
+      m_pos += static_cast<size_t>(end - start);
+      emit({Opcode::PushValue, 0, value});
+    } else if (next == '\'') {
+      const auto close = m_text.find('\'', m_pos + 1);
+      if (close == std::string::npos)
+        fail("Unterminated workspace name");
+      pushWorkspace(m_text.substr(m_pos + 1, close - m_pos - 1));
+      m_pos = close + 1;
+    } else if (std::isalpha(static_cast<unsigned char>(next)) || next == '_') {
+      const size_t start = m_pos;
+      while (m_pos < m_text.size() && (std::isalnum(static_cast<unsigned char>(m_text[m_pos])) ||
+                                       m_text[m_pos] == '_' || m_text[m_pos] == '.'))
+        ++m_pos;
+      pushWorkspace(m_text.substr(start, m_pos - start));
+    } else {
+      fail("Unexpected '" + std::string(1, next) + "'");
+    }
+  }
+
+  void pushWorkspace(const std::string &name) {
+    if (name.empty())
+      fail("Empty workspace name");
+    auto &names = m_program.workspaceNames;
+    const auto found = std::find(names.cbegin(), names.cend(), name);
+    emit({Opcode::PushWorkspace, static_cast<size_t>(std::distance(names.cbegin(), found))});
+    if (found == names.cend())
+      names.emplace_back(name);
+  }
+
+  void emit(const Instruction &instruction) {
+    if (instruction.opcode == Opcode::PushWorkspace || instruction.opcode == Opcode::PushValue) {
+      ++m_depth;
+      m_program.stackDepth = std::max(m_program.stackDepth, m_depth);
+    } else if (instruction.opcode != Opcode::Negate) {
+      --m_depth;
+    }
+    m_program.instructions.emplace_back(instruction);
+  }
+
+  void skipSpaces() {
+    while (m_pos < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_pos])))
+      ++m_pos;
+  }
+
+  [[noreturn]] void fail(const std::string &message) const {
+    throw std::invalid_argument(message + " at position " + std::to_string(m_pos) + " of the expression");
+  }
+
+  const std::string &m_text;
+  size_t m_pos{0};
+  size_t m_depth{0};
+  EvaluateWorkspaceExpression::Program m_program;
+};
+
+/// How a workspace of the expression is applied to the spectra of the output, smallest first
+enum class OperandKind {
+  /// a single number, applied to every bin
+  Value,
+  /// one bin per spectrum, applied to every bin of the spectrum
+  Column,
+  /// a single spectrum, applied to every spectrum
+  Row,
+  /// the same spectra and bins as the output
+  Full
+};
+
+/// A value on the evaluation stack: either a whole spectrum or a single number
+struct Operand {
+  const double *y{nullptr};
+  const double *e{nullptr};
+  bool isValue{false};
+  double valueY{0.};
+  double valueE{0.};
+  OperandKind kind{OperandKind::Full};
+  /// Whether the spectrum is masked in the equivalent intermediate workspace
+  bool masked{false};
+};
+
+// The kernels below use the same formulas as Plus, Minus, Multiply and Divide
+// so that the results match the chained algorithms exactly. All inputs of an
+// element are read before its outputs are written as the output may be the
+// left-hand operand.
+
+void add(const Operand &lhs, const Operand &rhs, double *yOut, double *eOut, const size_t size) {
+  if (lhs.isValue && !rhs.isValue) {
+    add(rhs, lhs, yOut, eOut, size);
+    return;
+  }
+  if (rhs.isValue) {
+    for (size_t j = 0; j < size; ++j)
+      yOut[j] = lhs.y[j] + rhs.valueY;
+    if (rhs.valueE != 0.) {
+      const double rhsE2 = rhs.valueE * rhs.valueE;
+      for (size_t j = 0; j < size; ++j)
+        eOut[j] = std::sqrt(lhs.e[j] * lhs.e[j] + rhsE2);
+    } else if (eOut != lhs.e) {
+      std::copy(lhs.e, lhs.e + size, eOut);
+    }
+    return;
+  }
+  for (size_t j = 0; j < size; ++j) {
+    const double lhsE = lhs.e[j];
+    const double rhsE = rhs.e[j];
+    yOut[j] = lhs.y[j] + rhs.y[j];
+    eOut[j] = std::sqrt(lhsE * lhsE + rhsE * rhsE);
+  }
+}
+
+void subtract(const Operand &lhs, const Operand &rhs, double *yOut, double *eOut, const size_t size) {
+  if (rhs.isValue) {
+    for (size_t j = 0; j < size; ++j)
+      yOut[j] = lhs.y[j] - rhs.valueY;
+    if (rhs.valueE != 0.) {
+      const double rhsE2 = rhs.valueE * rhs.valueE;
+      for (size_t j = 0; j < size; ++j)
+        eOut[j] = std::sqrt(lhs.e[j] * lhs.e[j] + rhsE2);
+    } else if (eOut != lhs.e) {
+      std::copy(lhs.e, lhs.e + size, eOut);
+    }
+    return;
+  }
+  if (lhs.isValue) {
+    const double lhsE2 = lhs.valueE * lhs.valueE;
+    for (size_t j = 0; j < size; ++j) {
+      const double rhsE = rhs.e[j];
+      yOut[j] = lhs.valueY - rhs.y[j];
+      eOut[j] = lhsE2 != 0. ? std::sqrt(rhsE * rhsE + lhsE2) : rhsE;
+    }
+    return;
+  }
+  for (size_t j = 0; j < size; ++j) {
+    const double lhsE = lhs.e[j];
+    const double rhsE = rhs.e[j];
+    yOut[j] = lhs.y[j] - rhs.y[j];
+    eOut[j] = std::sqrt(lhsE * lhsE + rhsE * rhsE);
+  }
+}
+
+void multiply(const Operand &lhs, const Operand &rhs, double *yOut, double *eOut, const size_t size) {
+  if (lhs.isValue && !rhs.isValue) {
+    multiply(rhs, lhs, yOut, eOut, size);
+    return;
+  }
+  if (rhs.isValue) {
+    for (size_t j = 0; j < size; ++j) {
+      const double leftY = lhs.y[j];
+      eOut[j] = std::sqrt(std::pow(lhs.e[j] * rhs.valueY, 2) + std::pow(rhs.valueE * leftY, 2));
+      yOut[j] = leftY * rhs.valueY;
+    }
+    return;
+  }
+  for (size_t j = 0; j < size; ++j) {
+    const double leftY = lhs.y[j];
+    const double rightY = rhs.y[j];
+    eOut[j] = std::sqrt(std::pow(lhs.e[j] * rightY, 2) + std::pow(rhs.e[j] * leftY, 2));
+    yOut[j] = leftY * rightY;
+  }
+}
+
+void divide(const Operand &lhs, const Operand &rhs, double *yOut, double *eOut, const size_t size) {
+  if (rhs.isValue) {
+    const double rhsFactor = std::pow(rhs.valueE / rhs.valueY, 2);
+    for (size_t j = 0; j < size; ++j) {
+      const double leftY = lhs.y[j];
+      eOut[j] = std::sqrt(std::pow(lhs.e[j], 2) + std::pow(leftY, 2) * rhsFactor) / std::fabs(rhs.valueY);
+      yOut[j] = leftY / rhs.valueY;
+    }
+    return;
+  }
+  for (size_t j = 0; j < size; ++j) {
+    const double leftY = lhs.isValue ? lhs.valueY : lhs.y[j];
+    const double leftE = lhs.isValue ? lhs.valueE : lhs.e[j];
+    const double rightY = rhs.y[j];
+    eOut[j] = std::sqrt(std::pow(leftE, 2) + std::pow(leftY * rhs.e[j] / rightY, 2)) / std::fabs(rightY);
+    yOut[j] = leftY / rightY;
+  }
+}
+
+/** Work out how a workspace is applied to the output, accepting the same shapes
+ * as BinaryOperation::checkSizeCompatibility
+ * @param leaf :: the workspace
+ * @param shape :: the largest workspace of the expression
+ * @param name :: the name of the workspace, for error messages
+ * @return the kind of the operand
+ * @throws std::invalid_argument if the workspace cannot be combined with the largest one
+ */
+OperandKind classifyOperand(const MatrixWorkspace_const_sptr &leaf, const MatrixWorkspace_const_sptr &shape,
+                            const std::string &name) {
+  if (leaf->size() == 1 && shape->size() != 1)
+    return OperandKind::Value;
+  const bool leafRagged = leaf->isRaggedWorkspace();
+  const bool shapeRagged = shape->isRaggedWorkspace();
+  const bool sameSpectra = leaf->getNumberHistograms() == shape->getNumberHistograms();
+  // as in the binary operations the X values and units of a single bin are not checked
+  if (sameSpectra && !leafRagged && leaf->blocksize() == 1 && (shapeRagged || shape->blocksize() != 1))
+    return OperandKind::Column;
+  if (!sameSpectra && (leaf->getNumberHistograms() != 1 || leafRagged || shapeRagged))
+    throw std::invalid_argument("Workspace " + name + " must have a single spectrum, a single bin, or the same "
+                                "number of spectra and bins as the largest workspace in the expression");
+  const auto unit = leaf->getAxis(0)->unit();
+  const auto shapeUnit = shape->getAxis(0)->unit();
+  if ((unit ? unit->unitID() : "") != (shapeUnit ? shapeUnit->unitID() : ""))
+    throw std::invalid_argument("Workspace " + name + " has different units on the X axis");
+  if (!WorkspaceHelpers::matchingBins(shape, leaf, !sameSpectra || (!shapeRagged && !leafRagged)))
+    throw std::invalid_argument("The X arrays of workspace " + name + " do not match the other workspaces");
+  if (!shapeRagged && !leafRagged && leaf->blocksize() != shape->blocksize())
+    throw std::invalid_argument("Workspace " + name + " does not have the same number of bins as the largest "
+                                "workspace in the expression");
+  return sameSpectra ? OperandKind::Full : OperandKind::Row;
+}
+
+/** Work out the kind of the result of a binary operation, rejecting the
+ * operands that Plus, Minus, Multiply and Divide reject
+ * @param opcode :: the operation
+ * @param lhs :: the kind of the left-hand operand
+ * @param rhs :: the kind of the right-hand operand
+ * @return the kind of the result
+ * @throws std::invalid_argument if the operands cannot be combined
+ */
+OperandKind combineKinds(const Opcode opcode, const OperandKind lhs, const OperandKind rhs) {
+  // a single value may be on either side, as numbers are
+  if (lhs == OperandKind::Value || rhs == OperandKind::Value)
+    return std::max(lhs, rhs);
+  if ((lhs == OperandKind::Row && rhs == OperandKind::Column) ||
+      (lhs == OperandKind::Column && rhs == OperandKind::Row))
+    throw std::invalid_argument("A single spectrum cannot be combined with a workspace of a single bin");
+  if (lhs < rhs && opcode != Opcode::Add && opcode != Opcode::Multiply)
+    throw std::invalid_argument("The left-hand side of a subtraction or division is smaller than the right-hand side");
+  return std::max(lhs, rhs);
+}
+
+/** Check that every operation of the expression combines operands that the
+ * chained binary operations accept
+ * @param program :: the compiled expression
+ * @param kinds :: the kind of each workspace of the expression
+ * @throws std::invalid_argument if two operands cannot be combined
+ */
+void checkOperandKinds(const EvaluateWorkspaceExpression::Program &program, const std::vector<OperandKind> &kinds) {
+  std::vector<OperandKind> stack;
+  stack.reserve(program.stackDepth);
+  for (const auto &instruction : program.instructions) {
+    if (instruction.opcode == Opcode::PushWorkspace) {
+      stack.emplace_back(kinds[instruction.workspace]);
+    } else if (instruction.opcode == Opcode::PushValue) {
+      stack.emplace_back(OperandKind::Value);
+    } else if (instruction.opcode != Opcode::Negate) {
+      const auto rhs = stack.back();
+      stack.pop_back();
+      stack.back() = combineKinds(instruction.opcode, stack.back(), rhs);
+    }
+  }
+}
+
+/** Whether the result of a binary operation is masked, following the binary
+ * operations: a spectrum masked in either operand is masked and zeroed unless
+ * one of them is a single value or a single spectrum, in which case the mask
+ * of the other operand is kept and the values are calculated as usual.
+ * @param lhs :: the left-hand operand
+ * @param rhs :: the right-hand operand
+ * @param cleared :: set to true if the result is zeroed
+ * @return whether the result is masked
+ */
+bool combineMasks(const Operand &lhs, const Operand &rhs, bool &cleared) {
+  cleared = false;
+  if (lhs.kind == OperandKind::Value)
+    return rhs.masked;
+  if (rhs.kind == OperandKind::Value || rhs.kind == OperandKind::Row)
+    return lhs.masked;
+  if (lhs.kind == OperandKind::Row)
+    return rhs.masked;
+  cleared = lhs.masked || rhs.masked;
+  return cleared;
+}
+
+/// The units, distribution flag and sample logs that an operand carries through the expression
+struct Metadata {
+  OperandKind kind{OperandKind::Full};
+  std::string yUnit;
+  bool distribution{true};
+  bool ragged{false};
+  /// Indices of the workspaces whose runs are merged into the result, the first is copied and the others added
+  std::vector<size_t> runs;
+};
+
+/** Work out the metadata of the result of a binary operation, following the
+ * rules of Plus, Minus, Multiply and Divide. As in those algorithms the
+ * workspace, rather than the single value, provides the result.
+ * @param opcode :: the operation
+ * @param lhs :: the left-hand operand
+ * @param rhs :: the right-hand operand
+ * @return the metadata of the result
+ * @throws std::invalid_argument if two workspaces cannot be added or subtracted
+ */
+Metadata combineMetadata(const Opcode opcode, const Metadata &lhs, const Metadata &rhs) {
+  const bool lhsProvides = lhs.kind != OperandKind::Value || rhs.kind == OperandKind::Value;
+  Metadata result = lhsProvides ? lhs : rhs;
+  const Metadata &other = lhsProvides ? rhs : lhs;
+  result.kind = std::max(lhs.kind, rhs.kind);
+  switch (opcode) {
+  case Opcode::Add:
+  case Opcode::Subtract:
+    if (lhs.kind != OperandKind::Value && rhs.kind != OperandKind::Value) {
+      if (lhs.yUnit != rhs.yUnit)
+        throw std::invalid_argument("Workspaces with different units for the data (Y) cannot be added or subtracted");
+      if (lhs.distribution != rhs.distribution)
+        throw std::invalid_argument(
+            "A workspace flagged as a distribution cannot be added to or subtracted from one that is not");
+    }
+    // only Plus merges the runs, Minus keeps those of the workspace
+    if (opcode == Opcode::Add || !lhsProvides)
+      result.runs.insert(result.runs.end(), other.runs.cbegin(), other.runs.cend());
+    break;
+  case Opcode::Multiply:
+    result.distribution = lhs.distribution && rhs.distribution;
+    break;
+  default:
+    if (!lhsProvides) {
+      // a value divided by a workspace is the value multiplied by the reciprocal of the workspace
+      result.distribution = lhs.distribution && rhs.distribution;
+      break;
+    }
+    if (lhs.ragged && rhs.ragged)
+      result.distribution = true;
+    if (rhs.yUnit.empty() || rhs.kind == OperandKind::Value ||
+        (lhs.kind == OperandKind::Column) != (rhs.kind == OperandKind::Column)) {
+      // the units are unchanged, as Divide only combines them for workspaces with matching bins
+    } else if (lhs.yUnit == rhs.yUnit && rhs.kind != OperandKind::Column) {
+      result.yUnit = "";
+      result.distribution = true;
+    } else {
+      result.yUnit = lhs.yUnit.empty() ? "1/" + rhs.yUnit : lhs.yUnit + "/" + rhs.yUnit;
+    }
+    break;
+  }
+  return result;
+}
+
+/** Set the units, distribution flag and run of the output to those given by
+ * the equivalent chain of binary operations
+ * @param program :: the compiled expression
+ * @param leaves :: the workspaces of the expression
+ * @param kinds :: how each workspace is applied to the output
+ * @param outputWS :: the output workspace
+ * @throws std::invalid_argument if the units of the workspaces are incompatible
+ */
+void setOutputMetadata(const EvaluateWorkspaceExpression::Program &program,
+                       const std::vector<MatrixWorkspace_const_sptr> &leaves, const std::vector<OperandKind> &kinds,
+                       MatrixWorkspace &outputWS) {
+  std::vector<Metadata> stack;
+  stack.reserve(program.stackDepth);
+  for (const auto &instruction : program.instructions) {
+    switch (instruction.opcode) {
+    case Opcode::PushWorkspace: {
+      const auto &leaf = leaves[instruction.workspace];
+      stack.push_back(Metadata{kinds[instruction.workspace], leaf->YUnit(), leaf->isDistribution(),
+                               leaf->isRaggedWorkspace(), {instruction.workspace}});
+      break;
+    }
+    case Opcode::PushValue:
+      stack.push_back(Metadata{OperandKind::Value, "", true, false, {}});
+      break;
+    case Opcode::Negate:
+      break;
+    default: {
+      const auto rhs = stack.back();
+      stack.pop_back();
+      stack.back() = combineMetadata(instruction.opcode, stack.back(), rhs);
+      break;
+    }
+    }
+  }
+
+  const auto &result = stack.front();
+  outputWS.setYUnit(result.yUnit);
+  outputWS.setDistribution(result.distribution);
+  auto &run = outputWS.mutableRun();
+  run = leaves[result.runs.front()]->run();
+  for (auto runIndex = std::next(result.runs.cbegin()); runIndex != result.runs.cend(); ++runIndex)
+    run += leaves[*runIndex]->run();
+}
+
+/** Apply a binary operation to two single numbers, with the formulas used for
+ * two spectra of one bin
+ * @param opcode :: the operation
+ * @param lhs :: the left-hand operand
+ * @param rhs :: the right-hand operand
+ * @param result :: the operand to hold the result, only its values are set
+ */
+void applyToValues(const Opcode opcode, const Operand &lhs, const Operand &rhs, Operand &result) {
+  const Operand left{&lhs.valueY, &lhs.valueE};
+  const Operand right{&rhs.valueY, &rhs.valueE};
+  double y{0.};
+  double e{0.};
+  switch (opcode) {
+  case Opcode::Add:
+    add(left, right, &y, &e, 1);
+    break;
+  case Opcode::Subtract:
+    subtract(left, right, &y, &e, 1);
+    break;
+  case Opcode::Multiply:
+    multiply(left, right, &y, &e, 1);
+    break;
+  default:
+    divide(left, right, &y, &e, 1);
+    break;
+  }
+  result.isValue = true;
+  result.valueY = y;
+  result.valueE = e;
+}
+} // namespace
+
+/** Compile an expression into a postfix program
+ * @param expression :: infix expression of workspace names and numbers, using
+ * + - * / and parentheses. Names that are not identifiers must be quoted with '.
+ * @return the program
+ * @throws std::invalid_argument if the expression cannot be parsed
+ */
+EvaluateWorkspaceExpression::Program EvaluateWorkspaceExpression::compile(const std::string &expression) {
+  auto program = ExpressionParser(expression).parse();
+  if (program.workspaceNames.empty())
+    throw std::invalid_argument("The expression must contain at least one workspace");
+  return program;
+}
+
+void EvaluateWorkspaceExpression::init() {
+  declareProperty("Expression", "", std::make_shared<MandatoryValidator<std::string>>(),
+                  "An arithmetic expression of workspace names and numbers, using + - * / and parentheses, e.g. "
+                  "(a - b) / c * 2. Workspace names that are not identifiers must be put in single quotes.");
+  declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>("OutputWorkspace", "", Direction::Output),
+                  "The name of the workspace to hold the result");
+}
+
+/** The name of the input workspace property holding a workspace of the expression
+ * @param index :: the index of the workspace in Program::workspaceNames
+ * @return InputWorkspace for the first workspace, InputWorkspace_<index> for the others
+ */
+std::string EvaluateWorkspaceExpression::operandPropertyName(const size_t index) {
+  return index == 0 ? "InputWorkspace" : "InputWorkspace_" + std::to_string(index);
+}
+
+/** Declare an input workspace property for each workspace in a new expression
+ * @param name :: the name of the property that has been set
+ */
+void EvaluateWorkspaceExpression::afterPropertySet(const std::string &name) {
+  Algorithm::afterPropertySet(name);
+  if (name != "Expression")
+    return;
+  for (const auto &propertyName : m_operandProperties)
+    removeProperty(propertyName);
+  m_operandProperties.clear();
+
+  Program program;
+  try {
+    program = compile(getPropertyValue("Expression"));
+  } catch (std::invalid_argument &) {
+    // reported by validateInputs
+    return;
+  }
+  for (size_t i = 0; i < program.workspaceNames.size(); ++i) {
+    const auto &workspaceName = program.workspaceNames[i];
+    const auto propertyName = operandPropertyName(i);
+    declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(propertyName, "", Direction::Input),
+                    "The workspace called " + workspaceName + " in the expression");
+    // a workspace that does not exist is reported when the properties are validated
+    getPointerToProperty(propertyName)->setValue(workspaceName);
+    m_operandProperties.emplace_back(propertyName);
+  }
+}
+
+std::map<std::string, std::string> EvaluateWorkspaceExpression::validateInputs() {
+  std::map<std::string, std::string> issues;
+  try {
+    compile(getPropertyValue("Expression"));
+  } catch (std::invalid_argument &e) {
+    issues["Expression"] = e.what();
+  }
+  return issues;
+}
+
+void EvaluateWorkspaceExpression::exec() {
+  const std::string expression = getProperty("Expression");
+  const auto program = compile(expression);
+  const size_t numLeaves = program.workspaceNames.size();
+
+  std::vector<MatrixWorkspace_const_sptr> leaves;
+  leaves.reserve(numLeaves);
+  for (size_t i = 0; i < numLeaves; ++i)
+    leaves.emplace_back(getProperty(operandPropertyName(i)));
+
+  // the largest workspace gives the shape of the output, the others are applied to it as in the binary operations
+  const auto shape = *std::max_element(leaves.cbegin(), leaves.cend(),
+                                       [](const auto &lhs, const auto &rhs) { return lhs->size() < rhs->size(); });
+  std::vector<OperandKind> kinds;
+  kinds.reserve(numLeaves);
+  for (size_t i = 0; i < numLeaves; ++i)
+    kinds.emplace_back(classifyOperand(leaves[i], shape, "'" + program.workspaceNames[i] + "'"));
+  checkOperandKinds(program, kinds);
+
+  MatrixWorkspace_sptr outputWS = DataObjects::create<DataObjects::Workspace2D>(*shape);
+  setOutputMetadata(program, leaves, kinds, *outputWS);
+  const auto numHists = static_cast<int64_t>(shape->getNumberHistograms());
+  const int64_t numBlocks = (numHists + static_cast<int64_t>(SPECTRA_PER_BLOCK) - 1) /
+                            static_cast<int64_t>(SPECTRA_PER_BLOCK);
+
+  bool threadSafe = outputWS->threadSafe();
+  std::vector<const SpectrumInfo *> spectrumInfos(numLeaves, nullptr);
+  for (size_t i = 0; i < numLeaves; ++i) {
+    threadSafe = threadSafe && leaves[i]->threadSafe();
+    if (kinds[i] != OperandKind::Value)
+      spectrumInfos[i] = &leaves[i]->spectrumInfo();
+  }
+  auto &outSpectrumInfo = outputWS->mutableSpectrumInfo();
+
+  Progress progress(this, 0.0, 1.0, static_cast<size_t>(numBlocks));
+  PARALLEL_FOR_IF(threadSafe)
+  for (int64_t block = 0; block < numBlocks; ++block) {
+    PARALLEL_START_INTERRUPT_REGION
+    // slot 0 of the stack writes straight into the output, the others into scratch buffers
+    std::vector<std::vector<double>> scratchY(program.stackDepth);
+    std::vector<std::vector<double>> scratchE(program.stackDepth);
+    std::vector<Operand> stack(program.stackDepth);
+    // keeps the histograms of event workspaces alive while they are used
+    std::vector<Kernel::cow_ptr<HistogramData::HistogramY>> leafY(numLeaves, nullptr);
+    std::vector<Kernel::cow_ptr<HistogramData::HistogramE>> leafE(numLeaves, nullptr);
+
+    const int64_t blockEnd = std::min(numHists, (block + 1) * static_cast<int64_t>(SPECTRA_PER_BLOCK));
+    for (int64_t wi = block * static_cast<int64_t>(SPECTRA_PER_BLOCK); wi < blockEnd; ++wi) {
+      const auto index = static_cast<size_t>(wi);
+      double *outY = outputWS->mutableY(index).data();
+      double *outE = outputWS->mutableE(index).data();
+      // spectra of a ragged workspace have different numbers of bins
+      const size_t numBins = outputWS->y(index).size();
+      for (size_t slot = 1; slot < program.stackDepth; ++slot) {
+        scratchY[slot].resize(numBins);
+        scratchE[slot].resize(numBins);
+      }
+
+      size_t top = 0;
+      for (const auto &instruction : program.instructions) {
+        switch (instruction.opcode) {
+        case Opcode::PushWorkspace: {
+          const size_t leaf = instruction.workspace;
+          auto &operand = stack[top++];
+          operand = Operand();
+          operand.kind = kinds[leaf];
+          if (operand.kind == OperandKind::Value) {
+            operand.isValue = true;
+            operand.valueY = leaves[leaf]->y(0)[0];
+            operand.valueE = leaves[leaf]->e(0)[0];
+            break;
+          }
+          const size_t leafIndex = operand.kind == OperandKind::Row ? 0 : index;
+          operand.masked = spectrumInfos[leaf]->hasDetectors(leafIndex) && spectrumInfos[leaf]->isMasked(leafIndex);
+          if (operand.kind == OperandKind::Column) {
+            operand.isValue = true;
+            operand.valueY = leaves[leaf]->y(index)[0];
+            operand.valueE = leaves[leaf]->e(index)[0];
+          } else {
+            leafY[leaf] = leaves[leaf]->sharedY(leafIndex);
+            leafE[leaf] = leaves[leaf]->sharedE(leafIndex);
+            operand.y = leafY[leaf]->data();
+            operand.e = leafE[leaf]->data();
+          }
+          break;
+        }
+        case Opcode::PushValue: {
+          auto &operand = stack[top++];
+          operand = Operand();
+          operand.kind = OperandKind::Value;
+          operand.isValue = true;
+          operand.valueY = instruction.value;
+          break;
+        }
+        case Opcode::Negate: {
+          auto &operand = stack[top - 1];
+          if (operand.isValue) {
+            operand.valueY = -operand.valueY;
+            break;
+          }
+          double *y = top == 1 ? outY : scratchY[top - 1].data();
+          double *e = top == 1 ? outE : scratchE[top - 1].data();
+          std::transform(operand.y, operand.y + numBins, y, [](const double value) { return -value; });
+          if (e != operand.e)
+            std::copy(operand.e, operand.e + numBins, e);
+          operand.y = y;
+          operand.e = e;
+          break;
+        }
+        default: {
+          --top;
+          const auto &rhs = stack[top];
+          auto &lhs = stack[top - 1];
+          bool cleared{false};
+          const bool masked = combineMasks(lhs, rhs, cleared);
+          const auto kind = std::max(lhs.kind, rhs.kind);
+          if (lhs.isValue && rhs.isValue) {
+            applyToValues(instruction.opcode, lhs, rhs, lhs);
+            if (cleared)
+              lhs.valueY = lhs.valueE = 0.;
+          } else {
+            double *y = top == 1 ? outY : scratchY[top - 1].data();
+            double *e = top == 1 ? outE : scratchE[top - 1].data();
+            if (cleared) {
+              // as in the binary operations a spectrum masked in either workspace is zeroed
+              std::fill(y, y + numBins, 0.);
+              std::fill(e, e + numBins, 0.);
+            } else if (instruction.opcode == Opcode::Add) {
+              add(lhs, rhs, y, e, numBins);
+            } else if (instruction.opcode == Opcode::Subtract) {
+              subtract(lhs, rhs, y, e, numBins);
+            } else if (instruction.opcode == Opcode::Multiply) {
+              multiply(lhs, rhs, y, e, numBins);
+            } else {
+              divide(lhs, rhs, y, e, numBins);
+            }
+            lhs = Operand();
+            lhs.y = y;
+            lhs.e = e;
+          }
+          lhs.kind = kind;
+          lhs.masked = masked;
+          break;
+        }
+        }
+      }
+
+      // the result is only elsewhere if the expression is a single workspace
+      const auto &result = stack[0];
+      if (result.y != outY) {
+        std::copy(result.y, result.y + numBins, outY);
+        std::copy(result.e, result.e + numBins, outE);
+      }
+      if (result.masked) {
+        PARALLEL_CRITICAL(setMasked) { outSpectrumInfo.setMasked(index, true); }
+      }
+    }
+    progress.report();
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  // as in the binary operations, bins masked in any input of more than one bin are masked in the output
+  for (size_t i = 0; i < numLeaves; ++i) {
+    if (kinds[i] != OperandKind::Full && kinds[i] != OperandKind::Row)
+      continue;
+    const auto &leaf = leaves[i];
+    for (size_t index = 0; index < outputWS->getNumberHistograms(); ++index) {
+      const size_t leafIndex = kinds[i] == OperandKind::Row ? 0 : index;
+      if (!leaf->hasMaskedBins(leafIndex))
+        continue;
+      for (const auto &mask : leaf->maskedBins(leafIndex))
+        outputWS->flagMasked(index, mask.first, mask.second);
+    }
+  }
+
+  setProperty("OutputWorkspace", outputWS);
+}
+
+} // namespace Mantid::Algorithms
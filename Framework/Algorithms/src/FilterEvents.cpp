@@ -998,14 +998,14 @@ void FilterEvents::filterEvents(double progressamount) {
     PARALLEL_START_INTERRUPT_REGION
     if (!m_vecSkip[iws]) {                                                        // Filter the non-skipped
       const DataObjects::EventList &inputEventList = m_eventWS->getSpectrum(iws); // input event list
-      if (!inputEventList.empty()) {                              // nothing to split if there aren't events
-        std::map<int, DataObjects::EventList *> partialEvenLists; // event lists receiving the events from input list
-        for (auto &ws : m_outputWorkspacesMap) {
-          const int index = ws.first;
-          auto &partialEventList = ws.second->getSpectrum(iws);
-          partialEvenLists.emplace(index, &partialEventList);
-        }
-        m_timeSplitter.splitEventList(inputEventList, partialEvenLists, pulseTof, tofCorrect, m_detTofFactors[iws],
+      if (!inputEventList.empty()) { // nothing to split if there aren't events
+        // event list receiving the events from input list for a workspace index. Only the output workspaces that
+        // receive events are visited, which matters when there are thousands of them
+        const auto getPartial = [this, iws](const int index) -> DataObjects::EventList * {
+          const auto ws = m_outputWorkspacesMap.find(index);
+          return ws == m_outputWorkspacesMap.end() ? nullptr : &ws->second->getSpectrum(iws);
+        };
+        m_timeSplitter.splitEventList(inputEventList, getPartial, pulseTof, tofCorrect, m_detTofFactors[iws],
                                       m_detTofOffsets[iws]);
       }
     }
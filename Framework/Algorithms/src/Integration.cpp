@@ -205,6 +205,9 @@ void Integration::exec() {
   }
   PARALLEL_CHECK_INTERRUPT_REGION
 
+  // Each spectrum was given its own copy of the two bin edges, which are usually the same
+  outputWorkspace->shareIdenticalX();
+
   if (rebinned_output) {
     rebinned_output->finalize(false);
   }
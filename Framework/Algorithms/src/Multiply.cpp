@@ -6,6 +6,8 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/Multiply.h"
 
+#include <cmath>
+
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 using namespace Mantid::DataObjects;
@@ -17,18 +19,28 @@ DECLARE_ALGORITHM(Multiply)
 
 void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs, const HistogramData::Histogram &rhs,
                                       HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) {
-  const size_t bins = lhs.e().size();
-  for (size_t j = 0; j < bins; ++j) {
-    // Get references to the input Y's
-    const double leftY = lhs.y()[j];
-    const double rightY = rhs.y()[j];
+  performArrayOperation(lhs.y().data(), lhs.e().data(), rhs.y().data(), rhs.e().data(), YOut.data(), EOut.data(),
+                        lhs.e().size());
+}
+
+void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs, const double rhsY, const double rhsE,
+                                      HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) {
+  performArrayOperation(lhs.y().data(), lhs.e().data(), rhsY, rhsE, YOut.data(), EOut.data(), lhs.e().size());
+}
+
+void Multiply::performArrayOperation(const double *lhsY, const double *lhsE, const double *rhsY, const double *rhsE,
+                                     double *YOut, double *EOut, const std::size_t size) {
+  for (size_t j = 0; j < size; ++j) {
+    // Get the input Y's
+    const double leftY = lhsY[j];
+    const double rightY = rhsY[j];
 
     // error multiplying two uncorrelated numbers, re-arrange so that you don't
     // get infinity if leftY or rightY == 0
     // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
     // (Sc)2 = (Sa c/a)2 + (Sb c/b)2
     //       = (Sa b)2 + (Sb a)2
-    EOut[j] = sqrt(pow(lhs.e()[j] * rightY, 2) + pow(rhs.e()[j] * leftY, 2));
+    EOut[j] = sqrt(pow(lhsE[j] * rightY, 2) + pow(rhsE[j] * leftY, 2));
 
     // Copy the result last in case one of the input workspaces is also any
     // output
@@ -36,15 +48,14 @@ void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs, const
   }
 }
 
-void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs, const double rhsY, const double rhsE,
-                                      HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) {
-  const size_t bins = lhs.e().size();
-  for (size_t j = 0; j < bins; ++j) {
-    // Get reference to input Y
-    const double leftY = lhs.y()[j];
+void Multiply::performArrayOperation(const double *lhsY, const double *lhsE, const double rhsY, const double rhsE,
+                                     double *YOut, double *EOut, const std::size_t size) {
+  for (size_t j = 0; j < size; ++j) {
+    // Get the input Y
+    const double leftY = lhsY[j];
 
     // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhs.e()[j] * rhsY, 2) + pow(rhsE * leftY, 2));
+    EOut[j] = sqrt(pow(lhsE[j] * rhsY, 2) + pow(rhsE * leftY, 2));
 
     // Copy the result last in case one of the input workspaces is also any
     // output
@@ -7,6 +7,9 @@
 #include "MantidAlgorithms/Plus.h"
 #include "MantidKernel/VectorHelper.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 using namespace Mantid::DataObjects;
@@ -20,23 +23,39 @@ DECLARE_ALGORITHM(Plus)
 //---------------------------------------------------------------------------------------------
 void Plus::performBinaryOperation(const HistogramData::Histogram &lhs, const HistogramData::Histogram &rhs,
                                   HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) {
-  std::transform(lhs.y().begin(), lhs.y().end(), rhs.y().begin(), YOut.begin(), std::plus<>());
-  std::transform(lhs.e().begin(), lhs.e().end(), rhs.e().begin(), EOut.begin(), VectorHelper::SumGaussError<double>());
+  performArrayOperation(lhs.y().data(), lhs.e().data(), rhs.y().data(), rhs.e().data(), YOut.data(), EOut.data(),
+                        lhs.y().size());
 }
 
 //---------------------------------------------------------------------------------------------
 void Plus::performBinaryOperation(const HistogramData::Histogram &lhs, const double rhsY, const double rhsE,
                                   HistogramData::HistogramY &YOut, HistogramData::HistogramE &EOut) {
-  using std::placeholders::_1;
-  std::transform(lhs.y().begin(), lhs.y().end(), YOut.begin(), [rhsY](double l) { return l + rhsY; });
-  // Only do E if non-zero, otherwise just copy
+  performArrayOperation(lhs.y().data(), lhs.e().data(), rhsY, rhsE, YOut.data(), EOut.data(), lhs.y().size());
+}
+
+//---------------------------------------------------------------------------------------------
+void Plus::performArrayOperation(const double *lhsY, const double *lhsE, const double *rhsY, const double *rhsE,
+                                 double *YOut, double *EOut, const std::size_t size) {
+  const VectorHelper::SumGaussError<double> sumError;
+  for (std::size_t j = 0; j < size; ++j) {
+    YOut[j] = lhsY[j] + rhsY[j];
+    EOut[j] = sumError(lhsE[j], rhsE[j]);
+  }
+}
 
+//---------------------------------------------------------------------------------------------
+void Plus::performArrayOperation(const double *lhsY, const double *lhsE, const double rhsY, const double rhsE,
+                                 double *YOut, double *EOut, const std::size_t size) {
+  for (std::size_t j = 0; j < size; ++j)
+    YOut[j] = lhsY[j] + rhsY;
+  // Only do E if non-zero, otherwise just copy
   if (rhsE != 0.) {
-    double rhsE2 = rhsE * rhsE;
-    std::transform(lhs.e().begin(), lhs.e().end(), EOut.begin(),
-                   [rhsE2](double l) { return std::sqrt(l * l + rhsE2); });
-  } else
-    EOut = lhs.e();
+    const double rhsE2 = rhsE * rhsE;
+    for (std::size_t j = 0; j < size; ++j)
+      EOut[j] = std::sqrt(lhsE[j] * lhsE[j] + rhsE2);
+  } else if (EOut != lhsE) {
+    std::copy(lhsE, lhsE + size, EOut);
+  }
 }
 
 // ===================================== EVENT LIST BINARY OPERATIONS
@@ -22,6 +22,8 @@
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/VectorHelper.h"
 
+#include <optional>
+
 namespace Mantid {
 
 namespace PropertyNames {
@@ -382,12 +384,25 @@ void Rebin::exec() {
     bool ignoreBinErrors = getProperty(PropertyNames::IGNR_BIN_ERR);
 
     Progress prog(this, 0.0, 1.0, histnumber);
+    // The bin overlaps are reused by each thread while the spectra share the same X. They are only
+    // computed when they will be reused, otherwise a spectrum is rebinned in a single pass.
+    const bool commonBins = inputWS->isCommonBins();
+    std::vector<std::optional<HistogramData::RebinOverlap>> overlaps(PARALLEL_GET_MAX_THREADS);
     PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
     for (int hist = 0; hist < histnumber; ++hist) {
       PARALLEL_START_INTERRUPT_REGION
 
       try {
-        outputWS->setHistogram(hist, HistogramData::rebin(inputWS->histogram(hist), XValues_new));
+        const auto histogram = inputWS->histogram(hist);
+        auto &overlap = overlaps[PARALLEL_THREAD_NUMBER];
+        if (overlap && overlap->appliesTo(histogram, XValues_new)) {
+          outputWS->setHistogram(hist, overlap->rebin(histogram));
+        } else if (commonBins || (hist + 1 < histnumber && inputWS->sharedX(hist + 1) == histogram.sharedX())) {
+          overlap.emplace(histogram, XValues_new);
+          outputWS->setHistogram(hist, overlap->rebin(histogram));
+        } else {
+          outputWS->setHistogram(hist, HistogramData::rebin(histogram, XValues_new));
+        }
       } catch (InvalidBinEdgesError &) {
         if (ignoreBinErrors)
           outputWS->setBinEdges(hist, XValues_new);
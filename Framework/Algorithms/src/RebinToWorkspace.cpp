@@ -12,6 +12,8 @@
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidHistogramData/Rebin.h"
 
+#include <optional>
+
 namespace Mantid::Algorithms {
 
 using namespace API;
@@ -121,7 +123,10 @@ void RebinToWorkspace::rebin(MatrixWorkspace_sptr &toRebin, MatrixWorkspace_sptr
   // everything gets the same bin boundaries as the first spectrum
   const bool matchingX = (toRebin->getNumberHistograms() != toMatch->getNumberHistograms());
 
-  // rebin
+  // rebin, reusing the bin overlaps in each thread while the X are the same. The overlaps are only
+  // computed when they will be reused, otherwise a spectrum is rebinned in a single pass.
+  const bool commonBins = toRebin->isCommonBins() && (matchingX || toMatch->isCommonBins());
+  std::vector<std::optional<HistogramData::RebinOverlap>> overlaps(PARALLEL_GET_MAX_THREADS);
   PARALLEL_FOR_IF(Kernel::threadSafe(*toMatch, *outputWS))
   for (int i = 0; i < numHist; ++i) {
     PARALLEL_START_INTERRUPT_REGION
@@ -129,7 +134,17 @@ void RebinToWorkspace::rebin(MatrixWorkspace_sptr &toRebin, MatrixWorkspace_sptr
     if (m_isEvents) {
       outputWSEvents->getSpectrum(i).setHistogram(edges);
     } else {
-      outputWS->setHistogram(i, HistogramData::rebin(toRebin->histogram(i), edges));
+      const auto histogram = toRebin->histogram(i);
+      auto &overlap = overlaps[PARALLEL_THREAD_NUMBER];
+      if (overlap && overlap->appliesTo(histogram, edges)) {
+        outputWS->setHistogram(i, overlap->rebin(histogram));
+      } else if (commonBins || (i + 1 < numHist && toRebin->sharedX(i + 1) == histogram.sharedX() &&
+                                (matchingX || toMatch->sharedX(i + 1) == toMatch->sharedX(i)))) {
+        overlap.emplace(histogram, edges);
+        outputWS->setHistogram(i, overlap->rebin(histogram));
+      } else {
+        outputWS->setHistogram(i, HistogramData::rebin(histogram, edges));
+      }
     }
     prog.report();
     PARALLEL_END_INTERRUPT_REGION
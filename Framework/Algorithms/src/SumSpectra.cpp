@@ -17,8 +17,12 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/MultiThreaded.h"
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
+#include <numeric>
 
 namespace Mantid::Algorithms {
 
@@ -384,8 +388,116 @@ bool useSpectrum(const SpectrumInfo &spectrumInfo, const size_t wsIndex, const b
   }
   return true;
 }
+
+/// The spectra are split into at most this many blocks that are summed independently
+constexpr size_t MAX_BLOCKS{64};
+/// The smallest number of spectra worth summing in a block of its own
+constexpr size_t MIN_SPECTRA_PER_BLOCK{256};
+
+/**
+ * The number of blocks the spectra are split into. This only depends on the
+ * number of spectra, so the order of the summation, and therefore the result,
+ * does not depend on the number of threads.
+ */
+size_t numberOfBlocks(const size_t numSpectra) {
+  return std::clamp((numSpectra + MIN_SPECTRA_PER_BLOCK - 1) / MIN_SPECTRA_PER_BLOCK, size_t(1), MAX_BLOCKS);
+}
+
+/// The first position of a block in the list of indices
+size_t blockStart(const size_t block, const size_t numBlocks, const size_t numSpectra) {
+  return block * numSpectra / numBlocks;
+}
+
+/// The sum of a block of histograms
+struct PartialSum {
+  PartialSum(const size_t numBins, const bool weighted, const bool fractional)
+      : y(numBins, 0.), e2(numBins, 0.), weight(weighted ? numBins : 0, 0.), nZeros(weighted ? numBins : 0, 0),
+        frac(fractional ? numBins : 0, 0.) {}
+
+  PartialSum &operator+=(const PartialSum &other) {
+    std::transform(y.begin(), y.end(), other.y.begin(), y.begin(), std::plus<double>());
+    std::transform(e2.begin(), e2.end(), other.e2.begin(), e2.begin(), std::plus<double>());
+    std::transform(weight.begin(), weight.end(), other.weight.begin(), weight.begin(), std::plus<double>());
+    std::transform(nZeros.begin(), nZeros.end(), other.nZeros.begin(), nZeros.begin(), std::plus<size_t>());
+    std::transform(frac.begin(), frac.end(), other.frac.begin(), frac.begin(), std::plus<double>());
+    detectorIDs.insert(other.detectorIDs.begin(), other.detectorIDs.end());
+    numSpectra += other.numSpectra;
+    numMasked += other.numMasked;
+    return *this;
+  }
+
+  std::vector<double> y;
+  /// The sum of the squared errors
+  std::vector<double> e2;
+  std::vector<double> weight;
+  std::vector<size_t> nZeros;
+  /// The sum of the fractional areas, only used for RebinnedOutput
+  std::vector<double> frac;
+  std::set<detid_t> detectorIDs;
+  size_t numSpectra{0};
+  size_t numMasked{0};
+};
+
+/// Merge two vectors of events sorted by time-of-flight, leaving the result in the first
+template <class T> void mergeSortedEvents(std::vector<T> &events, std::vector<T> &more) {
+  std::vector<T> merged;
+  merged.reserve(events.size() + more.size());
+  std::merge(events.begin(), events.end(), more.begin(), more.end(), std::back_inserter(merged),
+             [](const T &lhs, const T &rhs) { return lhs.tof() < rhs.tof(); });
+  events.swap(merged);
+  std::vector<T>().swap(more);
+}
+
+/**
+ * Merge two event lists sorted by time-of-flight. The result is sorted and
+ * ends up in the first list, while the second is emptied.
+ * @param eventList the list to merge into
+ * @param more the list to merge from
+ */
+void mergeSortedEventLists(EventList &eventList, EventList &more) {
+  const auto eventType = std::max(eventList.getEventType(), more.getEventType());
+  eventList.switchTo(eventType);
+  more.switchTo(eventType);
+  switch (eventType) {
+  case TOF:
+    mergeSortedEvents(eventList.getEvents(), more.getEvents());
+    break;
+  case WEIGHTED:
+    mergeSortedEvents(eventList.getWeightedEvents(), more.getWeightedEvents());
+    break;
+  case WEIGHTED_NOTIME:
+    mergeSortedEvents(eventList.getWeightedEventsNoTime(), more.getWeightedEventsNoTime());
+    break;
+  }
+  eventList.setSortOrder(TOF_SORT);
+  eventList.addDetectorIDs(more.getDetectorIDs());
+  more.clear();
+}
 } // anonymous namespace
 
+/**
+ * Combine the partial results pairwise, in a fixed tree order, until the total
+ * is in the first element. The pairs at each level are combined in parallel.
+ * @param partials the partial results, the total ends up in the first one
+ * @param combine adds its second argument into the first
+ * @param runParallel whether the pairs may be combined in parallel
+ */
+template <typename T, typename Combine>
+void SumSpectra::reduceInTree(std::vector<T> &partials, const Combine &combine, const bool runParallel) {
+  const size_t numPartials = partials.size();
+  for (size_t stride = 1; stride < numPartials; stride *= 2) {
+    const auto numPairs = static_cast<int64_t>((numPartials + stride - 1) / (2 * stride));
+    PARALLEL_FOR_IF(runParallel)
+    for (int64_t pair = 0; pair < numPairs; ++pair) {
+      PARALLEL_START_INTERRUPT_REGION
+      const auto first = static_cast<size_t>(pair) * 2 * stride;
+      combine(partials[first], partials[first + stride]);
+      PARALLEL_END_INTERRUPT_REGION
+    }
+    PARALLEL_CHECK_INTERRUPT_REGION
+  }
+}
+
 /**
  * This function deals with the logic necessary for summing a Workspace2D.
  * @param outputWorkspace the workspace to hold the summed input
@@ -400,56 +512,73 @@ void SumSpectra::doSimpleSum(const MatrixWorkspace_sptr &outputWorkspace, Progre
                              size_t &numMasked, size_t &numZeros) {
   // Clean workspace of any NANs or Inf values
   auto localworkspace = replaceSpecialValues();
+  const MatrixWorkspace &inputWS = *localworkspace;
 
   // Get references to the output workspaces's data vectors
   auto &outSpec = outputWorkspace->getSpectrum(0);
   auto &YSum = outSpec.mutableY();
   auto &YErrorSum = outSpec.mutableE();
 
-  std::vector<double> Weight;
-  std::vector<size_t> nZeros;
-  if (m_calculateWeightedSum) {
-    Weight.assign(YSum.size(), 0.);
-    nZeros.assign(YSum.size(), 0);
-  }
-
-  const auto &spectrumInfo = localworkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto wsIndex : m_indices) {
-    if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
-      continue;
-    numSpectra++;
-
-    const auto &YValues = localworkspace->y(wsIndex);
-    const auto &YErrors = localworkspace->e(wsIndex);
-
-    if (m_calculateWeightedSum) {
-      // Retrieve the spectrum into a vector
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double yErrorsVal = YErrors[yIndex];
-        if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
-          const double errsq = yErrorsVal * yErrorsVal;
-          YErrorSum[yIndex] += errsq;
-          Weight[yIndex] += 1. / errsq;
-          YSum[yIndex] += YValues[yIndex] / errsq;
-        } else {
-          nZeros[yIndex]++;
+  // Sum blocks of spectra in parallel, then add up the blocks in a fixed order
+  const std::vector<size_t> indices(m_indices.begin(), m_indices.end());
+  const size_t numBlocks = numberOfBlocks(indices.size());
+  std::vector<PartialSum> partials(numBlocks, PartialSum(m_yLength, m_calculateWeightedSum, false));
+
+  const auto &spectrumInfo = inputWS.spectrumInfo();
+  const bool runParallel = Kernel::threadSafe(inputWS);
+  PARALLEL_FOR_IF(runParallel)
+  for (int64_t block = 0; block < static_cast<int64_t>(numBlocks); ++block) {
+    PARALLEL_START_INTERRUPT_REGION
+    auto &partial = partials[block];
+    const size_t end = blockStart(block + 1, numBlocks, indices.size());
+    for (size_t i = blockStart(block, numBlocks, indices.size()); i < end; ++i) {
+      const auto wsIndex = indices[i];
+      if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, partial.numMasked))
+        continue;
+      partial.numSpectra++;
+
+      const auto &YValues = inputWS.y(wsIndex);
+      const auto &YErrors = inputWS.e(wsIndex);
+
+      if (m_calculateWeightedSum) {
+        // Retrieve the spectrum into a vector
+        for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
+          const double yErrorsVal = YErrors[yIndex];
+          if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
+            const double errsq = yErrorsVal * yErrorsVal;
+            partial.e2[yIndex] += errsq;
+            partial.weight[yIndex] += 1. / errsq;
+            partial.y[yIndex] += YValues[yIndex] / errsq;
+          } else {
+            partial.nZeros[yIndex]++;
+          }
         }
+      } else {
+        std::transform(partial.y.begin(), partial.y.end(), YValues.begin(), partial.y.begin(), std::plus<double>());
+        std::transform(partial.e2.begin(), partial.e2.end(), YErrors.begin(), partial.e2.begin(),
+                       [](const double accum, const double yerrorSpec) { return accum + yerrorSpec * yerrorSpec; });
       }
-    } else {
-      YSum += YValues;
-      std::transform(YErrorSum.begin(), YErrorSum.end(), YErrors.begin(), YErrorSum.begin(),
-                     [](const double accum, const double yerrorSpec) { return accum + yerrorSpec * yerrorSpec; });
-    }
 
-    // Map all the detectors onto the spectrum of the output
-    outSpec.addDetectorIDs(localworkspace->getSpectrum(wsIndex).getDetectorIDs());
+      // Map all the detectors onto the spectrum of the output
+      const auto &detectorIDs = inputWS.getSpectrum(wsIndex).getDetectorIDs();
+      partial.detectorIDs.insert(detectorIDs.begin(), detectorIDs.end());
 
-    progress.report();
+      progress.report();
+    }
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  reduceInTree(partials, [](PartialSum &total, const PartialSum &other) { total += other; }, runParallel);
+  auto &total = partials.front();
+  std::copy(total.y.cbegin(), total.y.cend(), YSum.begin());
+  std::copy(total.e2.cbegin(), total.e2.cend(), YErrorSum.begin());
+  outSpec.addDetectorIDs(total.detectorIDs);
+  numSpectra += total.numSpectra;
+  numMasked += total.numMasked;
 
   if (m_calculateWeightedSum) {
-    numZeros = applyWeight(numSpectra, YSum, Weight, nZeros, m_multiplyByNumSpec);
+    numZeros = applyWeight(numSpectra, YSum, total.weight, total.nZeros, m_multiplyByNumSpec);
   } else {
     numZeros = 0;
   }
@@ -475,6 +604,7 @@ void SumSpectra::doFractionalSum(const MatrixWorkspace_sptr &outputWorkspace, Pr
   // Transform to real workspace types
   RebinnedOutput_sptr inWS = std::dynamic_pointer_cast<RebinnedOutput>(localworkspace);
   RebinnedOutput_sptr outWS = std::dynamic_pointer_cast<RebinnedOutput>(outputWorkspace);
+  const RebinnedOutput &inputWS = *inWS;
 
   // Check finalize state prior to the sum process, at the completion
   // the output is unfinalized
@@ -486,56 +616,74 @@ void SumSpectra::doFractionalSum(const MatrixWorkspace_sptr &outputWorkspace, Pr
   auto &YErrorSum = outSpec.mutableE();
   auto &FracSum = outWS->dataF(0);
 
-  std::vector<double> Weight;
-  std::vector<size_t> nZeros;
-  if (m_calculateWeightedSum) {
-    Weight.assign(YSum.size(), 0);
-    nZeros.assign(YSum.size(), 0);
-  }
-
-  const auto &spectrumInfo = localworkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto wsIndex : m_indices) {
-    if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
-      continue;
-    numSpectra++;
-
-    // Retrieve the spectrum into a vector
-    const auto &YValues = localworkspace->y(wsIndex);
-    const auto &YErrors = localworkspace->e(wsIndex);
-    const auto &FracArea = inWS->readF(wsIndex);
+  // Sum blocks of spectra in parallel, then add up the blocks in a fixed order
+  const std::vector<size_t> indices(m_indices.begin(), m_indices.end());
+  const size_t numBlocks = numberOfBlocks(indices.size());
+  std::vector<PartialSum> partials(numBlocks, PartialSum(m_yLength, m_calculateWeightedSum, true));
+
+  const auto &spectrumInfo = inputWS.spectrumInfo();
+  const bool runParallel = Kernel::threadSafe(inputWS);
+  PARALLEL_FOR_IF(runParallel)
+  for (int64_t block = 0; block < static_cast<int64_t>(numBlocks); ++block) {
+    PARALLEL_START_INTERRUPT_REGION
+    auto &partial = partials[block];
+    const size_t end = blockStart(block + 1, numBlocks, indices.size());
+    for (size_t i = blockStart(block, numBlocks, indices.size()); i < end; ++i) {
+      const auto wsIndex = indices[i];
+      if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, partial.numMasked))
+        continue;
+      partial.numSpectra++;
 
-    if (m_calculateWeightedSum) {
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double yErrorsVal = YErrors[yIndex];
-        const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
-        if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
-          const double errsq = yErrorsVal * yErrorsVal * fracVal * fracVal;
-          YErrorSum[yIndex] += errsq;
-          Weight[yIndex] += 1. / errsq;
-          YSum[yIndex] += YValues[yIndex] * fracVal / errsq;
-        } else {
-          nZeros[yIndex]++;
+      // Retrieve the spectrum into a vector
+      const auto &YValues = inputWS.y(wsIndex);
+      const auto &YErrors = inputWS.e(wsIndex);
+      const auto &FracArea = inputWS.readF(wsIndex);
+
+      if (m_calculateWeightedSum) {
+        for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
+          const double yErrorsVal = YErrors[yIndex];
+          const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
+          if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
+            const double errsq = yErrorsVal * yErrorsVal * fracVal * fracVal;
+            partial.e2[yIndex] += errsq;
+            partial.weight[yIndex] += 1. / errsq;
+            partial.y[yIndex] += YValues[yIndex] * fracVal / errsq;
+          } else {
+            partial.nZeros[yIndex]++;
+          }
+        }
+      } else {
+        for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
+          const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
+          partial.y[yIndex] += YValues[yIndex] * fracVal;
+          partial.e2[yIndex] += YErrors[yIndex] * YErrors[yIndex] * fracVal * fracVal;
         }
       }
-    } else {
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
-        YSum[yIndex] += YValues[yIndex] * fracVal;
-        YErrorSum[yIndex] += YErrors[yIndex] * YErrors[yIndex] * fracVal * fracVal;
-      }
-    }
-    // accumulation of fractional weight is the same
-    std::transform(FracSum.begin(), FracSum.end(), FracArea.begin(), FracSum.begin(), std::plus<double>());
+      // accumulation of fractional weight is the same
+      std::transform(partial.frac.begin(), partial.frac.end(), FracArea.begin(), partial.frac.begin(),
+                     std::plus<double>());
 
-    // Map all the detectors onto the spectrum of the output
-    outSpec.addDetectorIDs(localworkspace->getSpectrum(wsIndex).getDetectorIDs());
+      // Map all the detectors onto the spectrum of the output
+      const auto &detectorIDs = inputWS.getSpectrum(wsIndex).getDetectorIDs();
+      partial.detectorIDs.insert(detectorIDs.begin(), detectorIDs.end());
 
-    progress.report();
+      progress.report();
+    }
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  reduceInTree(partials, [](PartialSum &total, const PartialSum &other) { total += other; }, runParallel);
+  auto &total = partials.front();
+  std::copy(total.y.cbegin(), total.y.cend(), YSum.begin());
+  std::copy(total.e2.cbegin(), total.e2.cend(), YErrorSum.begin());
+  std::transform(FracSum.begin(), FracSum.end(), total.frac.cbegin(), FracSum.begin(), std::plus<double>());
+  outSpec.addDetectorIDs(total.detectorIDs);
+  numSpectra += total.numSpectra;
+  numMasked += total.numMasked;
 
   if (m_calculateWeightedSum) {
-    numZeros = applyWeight(numSpectra, YSum, Weight, nZeros, m_multiplyByNumSpec);
+    numZeros = applyWeight(numSpectra, YSum, total.weight, total.nZeros, m_multiplyByNumSpec);
   } else {
     numZeros = 0;
   }
@@ -567,30 +715,49 @@ void SumSpectra::execEvent(const MatrixWorkspace_sptr &outputWorkspace, Progress
   outputEL.setSpectrumNo(m_outSpecNum);
   outputEL.clearDetectorIDs();
 
+  // Each block of spectra is added into its own list, the first of which is the
+  // output. With more than one block the lists are sorted and merged in a fixed order.
+  const std::vector<size_t> indices(m_indices.begin(), m_indices.end());
+  const size_t numBlocks = numberOfBlocks(indices.size());
+  std::vector<EventList> blockLists(numBlocks - 1);
+  std::vector<EventList *> partials{&outputEL};
+  std::transform(blockLists.begin(), blockLists.end(), std::back_inserter(partials),
+                 [](EventList &eventList) { return &eventList; });
+  std::vector<size_t> blockNumSpectra(numBlocks, 0), blockNumMasked(numBlocks, 0), blockNumZeros(numBlocks, 0);
+
   const auto &spectrumInfo = inputWorkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto i : m_indices) {
-    if (spectrumInfo.hasDetectors(i)) {
-      // Skip monitors, if the property is set to do so
-      if (!m_keepMonitors && spectrumInfo.isMonitor(i))
-        continue;
-      // Skip masked detectors
-      if (spectrumInfo.isMasked(i)) {
-        numMasked++;
+  const bool runParallel = Kernel::threadSafe(*inputWorkspace);
+  PARALLEL_FOR_IF(runParallel)
+  for (int64_t block = 0; block < static_cast<int64_t>(numBlocks); ++block) {
+    PARALLEL_START_INTERRUPT_REGION
+    EventList &partialEL = *partials[block];
+    const size_t end = blockStart(block + 1, numBlocks, indices.size());
+    for (size_t i = blockStart(block, numBlocks, indices.size()); i < end; ++i) {
+      const auto wsIndex = indices[i];
+      if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, blockNumMasked[block]))
         continue;
+      blockNumSpectra[block]++;
+
+      // Add the event lists with the operator
+      const EventList &inputEL = inputWorkspace->getSpectrum(wsIndex);
+      if (inputEL.empty()) {
+        blockNumZeros[block]++;
       }
-    }
-    numSpectra++;
+      partialEL += inputEL;
 
-    // Add the event lists with the operator
-    const EventList &inputEL = inputWorkspace->getSpectrum(i);
-    if (inputEL.empty()) {
-      ++numZeros;
+      progress.report();
     }
-    outputEL += inputEL;
-
-    progress.report();
+    if (numBlocks > 1)
+      partialEL.sortTof();
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  reduceInTree(
+      partials, [](EventList *total, EventList *other) { mergeSortedEventLists(*total, *other); }, runParallel);
+  numSpectra += std::accumulate(blockNumSpectra.begin(), blockNumSpectra.end(), size_t(0));
+  numMasked += std::accumulate(blockNumMasked.begin(), blockNumMasked.end(), size_t(0));
+  numZeros += std::accumulate(blockNumZeros.begin(), blockNumZeros.end(), size_t(0));
 }
 
 } // namespace Mantid::Algorithms
@@ -237,14 +237,85 @@ public:
     run_rebin_parameters_test(inputWS, groupWS, "Workspace2D", false);
   }
 
-  void create_test_workspace_input(std::string inputWS, std::string groupWS, std::string workspaceType = "Histogram") {
+  void test_compress_tolerance() {
+    std::string inputWS("DiffractionFocussing2TestCompress_ws");
+    std::string groupWS("DiffractionFocussing2TestCompress_groups");
+    create_test_workspace_input(inputWS, groupWS, "Event");
+
+    auto uncompressed = std::dynamic_pointer_cast<const EventWorkspace>(
+        run_DiffractionFocussing2(inputWS, groupWS, {200}, {600}, {400}, true));
+    TS_ASSERT(uncompressed);
+
+    DiffractionFocussing2 focus;
+    focus.initialize();
+    focus.setPropertyValue("InputWorkspace", inputWS);
+    focus.setPropertyValue("OutputWorkspace", "DiffractionFocussing2TestCompress_out");
+    focus.setPropertyValue("GroupingWorkspace", groupWS);
+    focus.setProperty("DMin", std::vector<double>{200});
+    focus.setProperty("DMax", std::vector<double>{600});
+    focus.setProperty("Delta", std::vector<double>{400});
+    focus.setProperty("CompressTolerance", 10.);
+    TS_ASSERT_THROWS_NOTHING(focus.execute());
+    auto compressed =
+        AnalysisDataService::Instance().retrieveWS<const EventWorkspace>("DiffractionFocussing2TestCompress_out");
+    TS_ASSERT(compressed);
+
+    if (uncompressed && compressed) {
+      TS_ASSERT_EQUALS(compressed->getNumberHistograms(), 2);
+      TS_ASSERT_EQUALS(compressed->getEventType(), WEIGHTED_NOTIME);
+      TS_ASSERT_LESS_THAN(compressed->getNumberEvents(), uncompressed->getNumberEvents());
+      for (size_t i = 0; i < compressed->getNumberHistograms(); ++i) {
+        TS_ASSERT_EQUALS(compressed->getSpectrum(i).getDetectorIDs(), uncompressed->getSpectrum(i).getDetectorIDs());
+        TS_ASSERT_DELTA(compressed->y(i)[0], uncompressed->y(i)[0], 1e-10);
+      }
+    }
+
+    AnalysisDataService::Instance().remove(inputWS);
+    AnalysisDataService::Instance().remove(groupWS);
+    AnalysisDataService::Instance().remove(inputWS + "_focussed");
+    AnalysisDataService::Instance().remove("DiffractionFocussing2TestCompress_out");
+  }
+
+  void test_event_order_does_not_depend_on_threads() {
+    std::string inputWS("DiffractionFocussing2TestOrder_ws");
+    std::string groupWS("DiffractionFocussing2TestOrder_groups");
+    // 400 spectra per group, so that every group is split into several chunks
+    constexpr size_t bankPixelWidth{20};
+    create_test_workspace_input(inputWS, groupWS, "Event", bankPixelWidth, true);
+    auto input = AnalysisDataService::Instance().retrieveWS<const EventWorkspace>(inputWS);
+
+    auto output = std::dynamic_pointer_cast<const EventWorkspace>(
+        run_DiffractionFocussing2(inputWS, groupWS, {200}, {600}, {400}, true));
+    TS_ASSERT(output);
+    if (output) {
+      TS_ASSERT_EQUALS(output->getNumberHistograms(), 2);
+      // The events of each group are those of its spectra in workspace index order, as in a serial run
+      const size_t spectraPerBank = bankPixelWidth * bankPixelWidth;
+      for (size_t group = 0; group < output->getNumberHistograms(); ++group) {
+        std::vector<double> expected;
+        for (size_t wi = group * spectraPerBank; wi < (group + 1) * spectraPerBank; ++wi) {
+          const auto tofs = input->getSpectrum(wi).getTofs();
+          expected.insert(expected.end(), tofs.begin(), tofs.end());
+        }
+        TS_ASSERT_EQUALS(output->getSpectrum(group).getTofs(), expected);
+      }
+    }
+
+    AnalysisDataService::Instance().remove(inputWS);
+    AnalysisDataService::Instance().remove(groupWS);
+    AnalysisDataService::Instance().remove(inputWS + "_focussed");
+  }
+
+  void create_test_workspace_input(std::string inputWS, std::string groupWS, std::string workspaceType = "Histogram",
+                                   size_t bankPixelWidth = 2, bool random = false) {
     auto createWS = AlgorithmFactory::Instance().create("CreateSampleWorkspace", -1);
     createWS->initialize();
     createWS->setProperty("WorkspaceType", workspaceType);
     createWS->setProperty("XUnit", "dSpacing");
     createWS->setProperty("NumBanks", 2);
-    createWS->setProperty("BankPixelWidth", 2);
+    createWS->setProperty("BankPixelWidth", static_cast<int>(bankPixelWidth));
     createWS->setProperty("Function", "Flat background");
+    createWS->setProperty("Random", random);
     createWS->setProperty("XMin", 200.);
     createWS->setProperty("XMax", 600.);
     createWS->setProperty("BinWidth", 10.);
@@ -0,0 +1,370 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/AlgorithmHistory.h"
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
+#include "MantidAlgorithms/EvaluateWorkspaceExpression.h"
+#include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
+
+using Mantid::Algorithms::EvaluateWorkspaceExpression;
+using namespace Mantid::API;
+using Opcode = EvaluateWorkspaceExpression::Instruction::Opcode;
+
+namespace {
+MatrixWorkspace_sptr createVariedWorkspace(const std::string &name, const double offset, const double error,
+                                           const int nHist = 5, const int nBins = 7) {
+  MatrixWorkspace_sptr ws = WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(nHist, nBins);
+  for (size_t i = 0; i < static_cast<size_t>(nHist); ++i) {
+    auto &y = ws->mutableY(i);
+    auto &e = ws->mutableE(i);
+    for (size_t j = 0; j < static_cast<size_t>(nBins); ++j) {
+      y[j] = offset + 0.37 * static_cast<double>(i) + 0.11 * static_cast<double>(j);
+      e[j] = error + 0.013 * static_cast<double>(j);
+    }
+  }
+  AnalysisDataService::Instance().addOrReplace(name, ws);
+  return ws;
+}
+
+MatrixWorkspace_sptr evaluate(const std::string &expression) {
+  EvaluateWorkspaceExpression alg;
+  alg.setChild(true);
+  alg.setRethrows(true);
+  alg.initialize();
+  alg.setPropertyValue("Expression", expression);
+  alg.setPropertyValue("OutputWorkspace", "dummy");
+  alg.execute();
+  return alg.getProperty("OutputWorkspace");
+}
+
+void assertIdentical(const MatrixWorkspace_sptr &actual, const MatrixWorkspace_sptr &expected) {
+  TS_ASSERT_EQUALS(actual->getNumberHistograms(), expected->getNumberHistograms());
+  for (size_t i = 0; i < expected->getNumberHistograms(); ++i) {
+    TS_ASSERT_EQUALS(actual->x(i).rawData(), expected->x(i).rawData());
+    TS_ASSERT_EQUALS(actual->y(i).rawData(), expected->y(i).rawData());
+    TS_ASSERT_EQUALS(actual->e(i).rawData(), expected->e(i).rawData());
+  }
+}
+
+void assertSameMasking(const MatrixWorkspace_sptr &actual, const MatrixWorkspace_sptr &expected) {
+  const auto &actualInfo = actual->spectrumInfo();
+  const auto &expectedInfo = expected->spectrumInfo();
+  for (size_t i = 0; i < expected->getNumberHistograms(); ++i) {
+    TS_ASSERT_EQUALS(actualInfo.isMasked(i), expectedInfo.isMasked(i));
+    TS_ASSERT_EQUALS(actual->hasMaskedBins(i), expected->hasMaskedBins(i));
+    if (expected->hasMaskedBins(i))
+      TS_ASSERT_EQUALS(actual->maskedBins(i), expected->maskedBins(i));
+  }
+}
+
+/// Shorten some of the spectra so that the workspace is ragged
+void makeRagged(const MatrixWorkspace_sptr &ws) {
+  for (size_t i = 1; i < ws->getNumberHistograms(); i += 2) {
+    auto histogram = ws->histogram(i);
+    histogram.resize(ws->y(i).size() - i);
+    ws->setHistogram(i, histogram);
+  }
+}
+} // namespace
+
+class EvaluateWorkspaceExpressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EvaluateWorkspaceExpressionTest *createSuite() { return new EvaluateWorkspaceExpressionTest(); }
+  static void destroySuite(EvaluateWorkspaceExpressionTest *suite) { delete suite; }
+
+  void setUp() override {
+    m_a = createVariedWorkspace("a", 1.0, 0.1);
+    m_b = createVariedWorkspace("b", -3.0, 0.2);
+    m_c = createVariedWorkspace("c", 2.5, 0.05);
+  }
+
+  void tearDown() override { AnalysisDataService::Instance().clear(); }
+
+  void test_compile_lists_each_workspace_once() {
+    const auto program = EvaluateWorkspaceExpression::compile("a * b + a");
+    TS_ASSERT_EQUALS(program.workspaceNames, (std::vector<std::string>{"a", "b"}));
+    TS_ASSERT_EQUALS(program.instructions[3].workspace, 0);
+  }
+
+  void test_compile_follows_precedence() {
+    const auto program = EvaluateWorkspaceExpression::compile("a - 'b 2' / 2");
+    TS_ASSERT_EQUALS(program.workspaceNames, (std::vector<std::string>{"a", "b 2"}));
+    TS_ASSERT_EQUALS(program.stackDepth, 3);
+    const std::vector<Opcode> expected{Opcode::PushWorkspace, Opcode::PushWorkspace, Opcode::PushValue,
+                                       Opcode::Divide, Opcode::Subtract};
+    TS_ASSERT_EQUALS(program.instructions.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+      TS_ASSERT(program.instructions[i].opcode == expected[i]);
+    TS_ASSERT_EQUALS(program.instructions[1].workspace, 1);
+    TS_ASSERT_EQUALS(program.instructions[2].value, 2.);
+  }
+
+  void test_compile_invalid_expressions_throw() {
+    for (const auto &expression : {"a +", "(a - b", "a b", "'a", "a $ b", "2 * 3", "a * ()"})
+      TS_ASSERT_THROWS(EvaluateWorkspaceExpression::compile(expression), const std::invalid_argument &);
+  }
+
+  void test_expression_declares_input_workspace_properties() {
+    EvaluateWorkspaceExpression alg;
+    alg.initialize();
+    alg.setPropertyValue("Expression", "a * b + a");
+    TS_ASSERT_EQUALS(alg.getPropertyValue("InputWorkspace"), "a");
+    TS_ASSERT_EQUALS(alg.getPropertyValue("InputWorkspace_1"), "b");
+    TS_ASSERT(!alg.existsProperty("InputWorkspace_2"));
+
+    alg.setPropertyValue("Expression", "c");
+    TS_ASSERT_EQUALS(alg.getPropertyValue("InputWorkspace"), "c");
+    TS_ASSERT(!alg.existsProperty("InputWorkspace_1"));
+  }
+
+  void test_operand_not_in_the_ADS_can_be_set_directly() {
+    MatrixWorkspace_sptr unnamed = m_a->clone();
+    EvaluateWorkspaceExpression alg;
+    alg.setChild(true);
+    alg.setRethrows(true);
+    alg.initialize();
+    alg.setPropertyValue("Expression", "x + b");
+    alg.setProperty("InputWorkspace", unnamed);
+    alg.setPropertyValue("OutputWorkspace", "dummy");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr out = alg.getProperty("OutputWorkspace");
+    assertIdentical(out, m_a + m_b);
+  }
+
+  void test_unknown_workspace_is_rejected() {
+    EvaluateWorkspaceExpression alg;
+    alg.initialize();
+    alg.setPropertyValue("Expression", "a + not_there");
+    alg.setPropertyValue("OutputWorkspace", "out");
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &);
+  }
+
+  void test_matches_chained_operations() {
+    assertIdentical(evaluate("(a - b) / c * 2"), (m_a - m_b) / m_c * 2.0);
+    assertIdentical(evaluate("a + b * c - 0.5"), m_a + m_b * m_c - 0.5);
+  }
+
+  void test_number_divided_by_workspace() {
+    // Divide does not accept a single value on the left, so compare with the error formula
+    auto out = evaluate("3 / (a * a)");
+    auto squared = m_a * m_a;
+    for (size_t i = 0; i < m_a->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < m_a->blocksize(); ++j) {
+        const double b = squared->y(i)[j], sb = squared->e(i)[j];
+        TS_ASSERT_EQUALS(out->y(i)[j], 3. / b);
+        TS_ASSERT_EQUALS(out->e(i)[j], sqrt(pow(3. * sb / b, 2)) / fabs(b));
+      }
+    }
+  }
+
+  void test_single_value_workspace() {
+    MatrixWorkspace_sptr d = WorkspaceCreationHelper::createWorkspaceSingleValueWithError(3, 0.5);
+    AnalysisDataService::Instance().addOrReplace("d", d);
+    assertIdentical(evaluate("a * d + b / d - d"), m_a * d + m_b / d - d);
+  }
+
+  void test_unary_minus() {
+    auto out = evaluate("-a - -2");
+    for (size_t i = 0; i < m_a->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < m_a->blocksize(); ++j) {
+        TS_ASSERT_EQUALS(out->y(i)[j], -m_a->y(i)[j] + 2.);
+        TS_ASSERT_EQUALS(out->e(i)[j], m_a->e(i)[j]);
+      }
+    }
+  }
+
+  void test_single_workspace_is_copied() { assertIdentical(evaluate("(a)"), m_a); }
+
+  void test_masked_spectra_are_propagated() {
+    m_b->mutableSpectrumInfo().setMasked(2, true);
+    auto out = evaluate("a + b");
+    const auto &spectrumInfo = out->spectrumInfo();
+    for (size_t i = 0; i < out->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(spectrumInfo.isMasked(i), i == 2);
+    }
+    TS_ASSERT_EQUALS(out->y(2)[0], 0.);
+    TS_ASSERT_EQUALS(out->e(2)[0], 0.);
+    TS_ASSERT_EQUALS(out->y(1)[0], m_a->y(1)[0] + m_b->y(1)[0]);
+  }
+
+  void test_masked_bins_are_propagated() {
+    m_a->flagMasked(1, 3);
+    m_b->flagMasked(2, 0, 0.5);
+    auto out = evaluate("a * 2 + b");
+    TS_ASSERT(!out->hasMaskedBins(0));
+    TS_ASSERT_EQUALS(out->maskedBins(1), (MatrixWorkspace::MaskList{{3, 1.0}}));
+    TS_ASSERT_EQUALS(out->maskedBins(2), (MatrixWorkspace::MaskList{{0, 0.5}}));
+    // flagging only records the weights, as in the binary operations
+    TS_ASSERT_EQUALS(out->y(1)[3], 2. * m_a->y(1)[3] + m_b->y(1)[3]);
+  }
+
+  void test_single_spectrum_operand_matches_chained_operations() {
+    auto row = createVariedWorkspace("row", 0.5, 0.3, 1);
+    assertIdentical(evaluate("a * row - b"), m_a * row - m_b);
+    assertIdentical(evaluate("row * (a + row)"), row * (m_a + row));
+    // as for Minus and Divide, the left-hand side must not be smaller
+    TS_ASSERT_THROWS(evaluate("row - a"), const std::invalid_argument &);
+  }
+
+  void test_single_bin_operand_matches_chained_operations() {
+    auto column = createVariedWorkspace("column", 2.0, 0.1, 5, 1);
+    assertIdentical(evaluate("a / column - b"), m_a / column - m_b);
+    assertIdentical(evaluate("column * a + column"), column * m_a + column);
+    createVariedWorkspace("row", 0.5, 0.3, 1);
+    TS_ASSERT_THROWS(evaluate("a + row * column"), const std::invalid_argument &);
+  }
+
+  void test_ragged_workspaces_match_chained_operations() {
+    makeRagged(m_a);
+    makeRagged(m_b);
+    assertIdentical(evaluate("(a - b) * a + 2"), (m_a - m_b) * m_a + 2.0);
+    auto column = createVariedWorkspace("column", 2.0, 0.1, 5, 1);
+    assertIdentical(evaluate("a * column"), m_a * column);
+    TS_ASSERT_THROWS(evaluate("a + c"), const std::invalid_argument &);
+  }
+
+  void test_masking_matches_chained_operations() {
+    m_a->mutableSpectrumInfo().setMasked(1, true);
+    m_b->mutableSpectrumInfo().setMasked(3, true);
+    m_b->flagMasked(2, 4);
+    auto row = createVariedWorkspace("row", 0.5, 0.3, 1);
+    row->flagMasked(0, 1, 0.5);
+    auto column = createVariedWorkspace("column", 2.0, 0.1, 5, 1);
+    column->mutableSpectrumInfo().setMasked(4, true);
+    column->flagMasked(0, 0);
+    // a single value keeps the values of a masked spectrum, two workspaces zero it
+    for (const auto &[expression, chained] :
+         {std::make_pair("a * 2 + 1", m_a * 2.0 + 1.0), std::make_pair("2 * a + b", 2.0 * m_a + m_b),
+          std::make_pair("a * row", m_a * row), std::make_pair("b / column", m_b / column),
+          std::make_pair("(a - row) * 3 - b", (m_a - row) * 3.0 - m_b)}) {
+      const auto out = evaluate(expression);
+      assertIdentical(out, chained);
+      assertSameMasking(out, chained);
+    }
+  }
+
+  void test_y_units_follow_the_binary_operations() {
+    m_a->setYUnit("Counts");
+    m_b->setYUnit("Counts");
+    m_c->setYUnit("Time");
+    for (const auto &[expression, chained] : {std::make_pair("a / b", m_a / m_b),
+                                              std::make_pair("(a + b) / c * 2", (m_a + m_b) / m_c * 2.0),
+                                              std::make_pair("a * c - b * c", m_a * m_c - m_b * m_c)}) {
+      auto out = evaluate(expression);
+      TS_ASSERT_EQUALS(out->YUnit(), chained->YUnit());
+      TS_ASSERT_EQUALS(out->isDistribution(), chained->isDistribution());
+    }
+    TS_ASSERT_EQUALS(evaluate("a / b")->YUnit(), "");
+    TS_ASSERT(evaluate("a / b")->isDistribution());
+    TS_ASSERT_EQUALS(evaluate("(a + b) / c")->YUnit(), "Counts/Time");
+
+    TS_ASSERT_THROWS(evaluate("a + c"), const std::invalid_argument &);
+    m_b->setDistribution(true);
+    TS_ASSERT_THROWS(evaluate("a - b"), const std::invalid_argument &);
+  }
+
+  void test_runs_follow_the_binary_operations() {
+    m_a->mutableRun().addProperty("gd_prtn_chrg", 1.5, true);
+    m_b->mutableRun().addProperty("gd_prtn_chrg", 2.0, true);
+    m_c->mutableRun().addProperty("gd_prtn_chrg", 4.0, true);
+    for (const auto &[expression, chained] :
+         {std::make_pair("a + b", m_a + m_b), std::make_pair("(a + b) / c", (m_a + m_b) / m_c),
+          std::make_pair("c * 2 - a", m_c * 2.0 - m_a), std::make_pair("2 - (a + c)", 2.0 - (m_a + m_c))}) {
+      TS_ASSERT_EQUALS(evaluate(expression)->run().getPropertyValueAsType<double>("gd_prtn_chrg"),
+                       chained->run().getPropertyValueAsType<double>("gd_prtn_chrg"));
+    }
+    TS_ASSERT_EQUALS(evaluate("(a + b) / c")->run().getPropertyValueAsType<double>("gd_prtn_chrg"), 3.5);
+  }
+
+  void test_mismatched_workspaces_throw() {
+    createVariedWorkspace("small", 1.0, 0.1, 5, 6);
+    TS_ASSERT_THROWS(evaluate("a + small"), const std::invalid_argument &);
+    createVariedWorkspace("fewer", 1.0, 0.1, 4, 7);
+    TS_ASSERT_THROWS(evaluate("a * fewer"), const std::invalid_argument &);
+  }
+
+  void test_output_adds_a_single_history_entry_to_those_of_the_inputs() {
+    const auto run = [](const std::string &expression, const std::string &output) {
+      EvaluateWorkspaceExpression alg;
+      alg.initialize();
+      alg.setPropertyValue("Expression", expression);
+      alg.setPropertyValue("OutputWorkspace", output);
+      TS_ASSERT_THROWS_NOTHING(alg.execute());
+      return AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(output);
+    };
+    TS_ASSERT_EQUALS(run("(a - b) / c * 2", "result")->getHistory().size(), 1);
+
+    run("a * 2", "doubled");
+    run("b + 1", "shifted");
+    const auto &history = run("doubled / shifted", "ratio")->getHistory();
+    TS_ASSERT_EQUALS(history.size(), 3);
+    TS_ASSERT_EQUALS(history.getAlgorithmHistory(0)->getPropertyValue("Expression"), "a * 2");
+    TS_ASSERT_EQUALS(history.getAlgorithmHistory(1)->getPropertyValue("Expression"), "b + 1");
+    TS_ASSERT_EQUALS(history.getAlgorithmHistory(2)->getPropertyValue("Expression"), "doubled / shifted");
+    TS_ASSERT_EQUALS(history.getAlgorithmHistory(2)->getPropertyValue("InputWorkspace_1"), "shifted");
+  }
+
+  void test_WorkspaceExpression_builds_expression() {
+    const auto expression = (WorkspaceExpression(m_a) - m_b) / m_c * 2. + -0.25;
+    TS_ASSERT_EQUALS(expression.str(), "(((('a' - 'b') / 'c') * 2) + (-0.25))");
+    TS_ASSERT_EQUALS((1. / -WorkspaceExpression(m_a)).str(), "(1 / (-'a'))");
+  }
+
+  void test_WorkspaceExpression_with_workspaces_not_in_the_ADS() {
+    MatrixWorkspace_sptr unnamed = m_a->clone();
+    const auto expression = (WorkspaceExpression(unnamed) - m_b) * unnamed;
+    TS_ASSERT_EQUALS(expression.str().find("__unnamed_"), 3);
+    assertIdentical(expression.evaluate(), (m_a - m_b) * m_a);
+  }
+
+  void test_WorkspaceExpression_rejects_two_workspaces_with_the_same_name() {
+    const auto expression = WorkspaceExpression(m_a);
+    auto replacement = createVariedWorkspace("a", 2.0, 0.1);
+    TS_ASSERT_THROWS(expression + replacement, const std::invalid_argument &);
+  }
+
+  void test_WorkspaceExpression_evaluate() {
+    const auto expression = (WorkspaceExpression(m_a) - m_b) / m_c * 2.;
+    assertIdentical(expression.evaluate(), (m_a - m_b) / m_c * 2.0);
+
+    auto stored = expression.evaluate("stored");
+    TS_ASSERT(AnalysisDataService::Instance().doesExist("stored"));
+    assertIdentical(stored, (m_a - m_b) / m_c * 2.0);
+  }
+
+private:
+  MatrixWorkspace_sptr m_a;
+  MatrixWorkspace_sptr m_b;
+  MatrixWorkspace_sptr m_c;
+};
+
+class EvaluateWorkspaceExpressionTestPerformance : public CxxTest::TestSuite {
+public:
+  static EvaluateWorkspaceExpressionTestPerformance *createSuite() {
+    return new EvaluateWorkspaceExpressionTestPerformance();
+  }
+  static void destroySuite(EvaluateWorkspaceExpressionTestPerformance *suite) { delete suite; }
+
+  void setUp() override {
+    for (const auto &name : {"a", "b", "c"})
+      AnalysisDataService::Instance().addOrReplace(name, WorkspaceCreationHelper::create2DWorkspace(10000, 1000));
+  }
+
+  void tearDown() override { AnalysisDataService::Instance().clear(); }
+
+  void test_chained_expression() { evaluate("(a - b) / c * 2"); }
+};
@@ -316,6 +316,59 @@ public:
     performTest(work_in1,work_in2);
   }
 
+  void test_2D_2D_many_spectra_matches_bin_by_bin_result()
+  {
+    // more spectra than are handed to the array operation in one block
+    constexpr int nHist{150}, nBins{7};
+    MatrixWorkspace_sptr lhs = WorkspaceCreationHelper::create2DWorkspaceVaried(nHist, nBins, 1.0, 0.1);
+    MatrixWorkspace_sptr rhs = WorkspaceCreationHelper::create2DWorkspaceVaried(nHist, nBins, -3.0, 0.2);
+    MatrixWorkspace_sptr out = DO_DIVIDE ? lhs / rhs : lhs * rhs;
+    for (size_t i = 0; i < nHist; ++i)
+    {
+      for (size_t j = 0; j < nBins; ++j)
+      {
+        const double a = lhs->y(i)[j], sa = lhs->e(i)[j], b = rhs->y(i)[j], sb = rhs->e(i)[j];
+        // the results are bit for bit those of the error formulae
+        if (DO_DIVIDE)
+        {
+          TS_ASSERT_EQUALS(out->y(i)[j], a / b);
+          TS_ASSERT_EQUALS(out->e(i)[j], sqrt(pow(sa, 2) + pow(a * sb / b, 2)) / fabs(b));
+        }
+        else
+        {
+          TS_ASSERT_EQUALS(out->y(i)[j], a * b);
+          TS_ASSERT_EQUALS(out->e(i)[j], sqrt(pow(sa * b, 2) + pow(sb * a, 2)));
+        }
+      }
+    }
+  }
+
+  void test_2D_SingleValue_many_spectra_matches_bin_by_bin_result()
+  {
+    constexpr int nHist{150}, nBins{7};
+    MatrixWorkspace_sptr lhs = WorkspaceCreationHelper::create2DWorkspaceVaried(nHist, nBins, 1.0, 0.1);
+    const double b = 1.7, sb = 0.3;
+    MatrixWorkspace_sptr rhs = WorkspaceCreationHelper::createWorkspaceSingleValueWithError(b, sb);
+    MatrixWorkspace_sptr out = DO_DIVIDE ? lhs / rhs : lhs * rhs;
+    for (size_t i = 0; i < nHist; ++i)
+    {
+      for (size_t j = 0; j < nBins; ++j)
+      {
+        const double a = lhs->y(i)[j], sa = lhs->e(i)[j];
+        if (DO_DIVIDE)
+        {
+          TS_ASSERT_EQUALS(out->y(i)[j], a / b);
+          TS_ASSERT_EQUALS(out->e(i)[j], sqrt(pow(sa, 2) + pow(a, 2) * pow(sb / b, 2)) / fabs(b));
+        }
+        else
+        {
+          TS_ASSERT_EQUALS(out->y(i)[j], a * b);
+          TS_ASSERT_EQUALS(out->e(i)[j], sqrt(pow(sa * b, 2) + pow(sb * a, 2)));
+        }
+      }
+    }
+  }
+
 
 
 
@@ -1101,4 +1154,27 @@ public:
       MatrixWorkspace_sptr out = m_ws2D_1 * m_ws2D_2;
     }
   }
+
+  void test_large_2D_inPlace()
+  {
+    constexpr bool doDivide{@MULTIPLYDIVIDETEST_DO_DIVIDE@};
+    // work on a copy, the other tests use the same inputs
+    MatrixWorkspace_sptr out = m_ws2D_1->clone();
+    if (doDivide) {
+      out /= m_ws2D_2;
+    } else {
+      out *= m_ws2D_2;
+    }
+  }
+
+  void test_large_2D_SingleValue()
+  {
+    constexpr bool doDivide{@MULTIPLYDIVIDETEST_DO_DIVIDE@};
+    MatrixWorkspace_sptr rhs = WorkspaceCreationHelper::createWorkspaceSingleValueWithError(2.0, 0.1);
+    if (doDivide) {
+      MatrixWorkspace_sptr out = m_ws2D_1 / rhs;
+    } else {
+      MatrixWorkspace_sptr out = m_ws2D_1 * rhs;
+    }
+  }
 };
@@ -332,6 +332,43 @@ public:
     performTest(work_in1,work_in2);
   }
 
+  void test_2D_2D_many_spectra_matches_bin_by_bin_result()
+  {
+    // more spectra than are handed to the array operation in one block
+    constexpr int nHist{150}, nBins{7};
+    MatrixWorkspace_sptr lhs = WorkspaceCreationHelper::create2DWorkspaceVaried(nHist, nBins, 1.0, 0.1);
+    MatrixWorkspace_sptr rhs = WorkspaceCreationHelper::create2DWorkspaceVaried(nHist, nBins, -3.0, 0.2);
+    MatrixWorkspace_sptr out = DO_PLUS ? lhs + rhs : lhs - rhs;
+    for (size_t i = 0; i < nHist; ++i)
+    {
+      for (size_t j = 0; j < nBins; ++j)
+      {
+        const double a = lhs->y(i)[j], sa = lhs->e(i)[j], b = rhs->y(i)[j], sb = rhs->e(i)[j];
+        // the results are bit for bit those of the error formula
+        TS_ASSERT_EQUALS(out->y(i)[j], DO_PLUS ? a + b : a - b);
+        TS_ASSERT_EQUALS(out->e(i)[j], sqrt(sa * sa + sb * sb));
+      }
+    }
+  }
+
+  void test_2D_SingleValue_many_spectra_matches_bin_by_bin_result()
+  {
+    constexpr int nHist{150}, nBins{7};
+    MatrixWorkspace_sptr lhs = WorkspaceCreationHelper::create2DWorkspaceVaried(nHist, nBins, 1.0, 0.1);
+    const double b = 1.7, sb = 0.3;
+    MatrixWorkspace_sptr rhs = WorkspaceCreationHelper::createWorkspaceSingleValueWithError(b, sb);
+    MatrixWorkspace_sptr out = DO_PLUS ? lhs + rhs : lhs - rhs;
+    for (size_t i = 0; i < nHist; ++i)
+    {
+      for (size_t j = 0; j < nBins; ++j)
+      {
+        const double a = lhs->y(i)[j], sa = lhs->e(i)[j];
+        TS_ASSERT_EQUALS(out->y(i)[j], DO_PLUS ? a + b : a - b);
+        TS_ASSERT_EQUALS(out->e(i)[j], sqrt(sa * sa + sb * sb));
+      }
+    }
+  }
+
   //============================================================================================
   //========================================= EventWorkspaces ==================================
   //============================================================================================
@@ -1183,4 +1220,27 @@ public:
     }
   }
 
+  void test_large_2D_inPlace()
+  {
+    constexpr bool doPlus{@PLUSMINUSTEST_DO_PLUS@};
+    // work on a copy, the other tests use the same inputs
+    MatrixWorkspace_sptr out = m_ws2D_1->clone();
+    if (doPlus) {
+      out += m_ws2D_2;
+    } else {
+      out -= m_ws2D_2;
+    }
+  }
+
+  void test_large_2D_SingleValue()
+  {
+    constexpr bool doPlus{@PLUSMINUSTEST_DO_PLUS@};
+    MatrixWorkspace_sptr rhs = WorkspaceCreationHelper::createWorkspaceSingleValueWithError(2.0, 0.1);
+    if (doPlus) {
+      MatrixWorkspace_sptr out = m_ws2D_1 + rhs;
+    } else {
+      MatrixWorkspace_sptr out = m_ws2D_1 - rhs;
+    }
+  }
+
 }; // end of class @PLUSMINUSTEST_CLASS@Performance
@@ -1558,7 +1558,13 @@ public:
   static RebinTestPerformance *createSuite() { return new RebinTestPerformance(); }
   static void destroySuite(RebinTestPerformance *suite) { delete suite; }
 
-  RebinTestPerformance() { ws = WorkspaceCreationHelper::create2DWorkspaceBinned(5000, 20000); }
+  RebinTestPerformance() {
+    ws = WorkspaceCreationHelper::create2DWorkspaceBinned(5000, 20000);
+    // every spectrum has its own X, so no bin overlaps can be reused
+    distinctXWS = WorkspaceCreationHelper::create2DWorkspaceBinned(1000, 20000);
+    for (size_t i = 0; i < distinctXWS->getNumberHistograms(); ++i)
+      distinctXWS->mutableX(i) += 0.001 * static_cast<double>(i);
+  }
 
   void test_rebin() {
     Rebin rebin;
@@ -1569,6 +1575,16 @@ public:
     TS_ASSERT(rebin.execute());
   }
 
+  void test_rebin_distinct_x_per_spectrum() {
+    Rebin rebin;
+    rebin.initialize();
+    rebin.setProperty("InputWorkspace", distinctXWS);
+    rebin.setPropertyValue("OutputWorkspace", "out");
+    rebin.setPropertyValue("Params", "50,1.77,18801");
+    TS_ASSERT(rebin.execute());
+  }
+
 private:
   MatrixWorkspace_sptr ws;
+  MatrixWorkspace_sptr distinctXWS;
 };
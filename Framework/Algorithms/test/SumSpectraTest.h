@@ -12,6 +12,7 @@
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
+#include <algorithm>
 #include <boost/lexical_cast.hpp>
 #include <cmath>
 #include <cxxtest/TestSuite.h>
@@ -247,6 +248,51 @@ public:
     TS_ASSERT_THROWS(dotestExecEvent("testEvent", "testEvent2", "5-10,-10"), const std::runtime_error &);
   }
 
+  void testExecManySpectra() {
+    // enough spectra to be summed in several blocks
+    constexpr int numHist = 1000;
+    auto input = WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(numHist, 10);
+    input->mutableSpectrumInfo().setMasked(3, true);
+
+    Mantid::Algorithms::SumSpectra alg2;
+    alg2.setChild(true);
+    alg2.initialize();
+    alg2.setProperty("InputWorkspace", input);
+    alg2.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(alg2.execute());
+    MatrixWorkspace_sptr output = alg2.getProperty("OutputWorkspace");
+
+    for (size_t i = 0; i < 10; ++i) {
+      TS_ASSERT_EQUALS(output->y(0)[i], 2. * (numHist - 1));
+      TS_ASSERT_DELTA(output->e(0)[i], std::sqrt(2. * (numHist - 1)), 1e-10);
+    }
+    const auto &spec = output->getSpectrum(0);
+    TS_ASSERT_EQUALS(spec.getDetectorIDs().size(), numHist - 1);
+    TS_ASSERT(!spec.hasDetectorID(4));
+    TS_ASSERT_EQUALS(output->run().getLogData("NumAllSpectra")->value(), std::to_string(numHist - 1));
+    TS_ASSERT_EQUALS(output->run().getLogData("NumMaskSpectra")->value(), "1");
+  }
+
+  void testExecEventManySpectraIsSorted() {
+    constexpr int numPixels = 1000;
+    constexpr int numEvents = 20;
+    EventWorkspace_sptr input = WorkspaceCreationHelper::createEventWorkspace(numPixels, 20, numEvents);
+
+    Mantid::Algorithms::SumSpectra alg2;
+    alg2.setChild(true);
+    alg2.initialize();
+    alg2.setProperty("InputWorkspace", input);
+    alg2.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(alg2.execute());
+    EventWorkspace_sptr output = alg2.getProperty("OutputWorkspace");
+
+    TS_ASSERT_EQUALS(output->getNumberEvents(), numPixels * numEvents);
+    const auto &eventList = output->getSpectrum(0);
+    TS_ASSERT_EQUALS(eventList.getDetectorIDs().size(), numPixels);
+    const auto tofs = eventList.getTofs();
+    TS_ASSERT(std::is_sorted(tofs.cbegin(), tofs.cend()));
+  }
+
   void dotestExecEvent(const std::string &inName, const std::string &outName, const std::string &indices_list) {
     int numPixels = 100;
     int numBins = 20;
@@ -39,6 +39,10 @@ public:
   /// Do we pre-count the # of events in each pixel ID?
   bool precount;
 
+  /// Memory, in bytes, for reading a bank in slabs while the previous slab is
+  /// processed. Zero to read every bank at once.
+  std::size_t readBufferSize;
+
   /// Offset in the pixelID_to_wi_vector to use.
   detid_t pixelID_to_wi_offset;
 
@@ -73,6 +77,13 @@ public:
   /// index)
   std::vector<size_t> pixelID_to_wi_vector;
 
+  /// Vector where (index = event ID + eventId_to_wi_offset), value = workspace
+  /// index. Only filled when histogramming on load.
+  std::vector<size_t> eventId_to_wi_vector;
+
+  /// Offset in the eventId_to_wi_vector to use.
+  detid_t eventId_to_wi_offset{0};
+
   /// One entry of pulse times for each preprocessor
   std::vector<std::shared_ptr<BankPulseTimes>> m_bankPulseTimes;
 
@@ -0,0 +1,96 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidDataHandling/DllConfig.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** EventHistogramAccumulator : Histograms events as they are read from file so
+ * that they never need to be stored individually. The x value of an event is
+ * (tof + tofOffset) * xFactor[workspace index], so a factor of one bins in
+ * time-of-flight and a factor of 1/DIFC bins in d-spacing.
+ *
+ * Loader tasks gather the (workspace index, bin, weight) of their events in
+ * blocks and add each block with addEvents(). The output spectra are guarded
+ * by striped locks, so tasks working on different banks do not contend.
+ */
+class MANTID_DATAHANDLING_DLL EventHistogramAccumulator {
+public:
+  /// A single event that has been assigned to a bin
+  struct Contribution {
+    std::size_t workspaceIndex;
+    std::size_t bin;
+    double weight;
+  };
+
+  EventHistogramAccumulator(std::vector<double> binEdges, std::vector<double> xFactors, const double tofOffset,
+                            const bool weighted);
+
+  /** Find the bin of an event
+   * @param workspaceIndex :: the spectrum that the event belongs to
+   * @param tof :: time-of-flight of the event
+   * @param bin :: set to the bin index if the event is inside the binning range
+   * @return true if the event falls into a bin
+   */
+  bool findBin(const std::size_t workspaceIndex, const double tof, std::size_t &bin) const {
+    const double factor = m_xFactors[workspaceIndex];
+    if (factor == 0.)
+      return false;
+    const double x = (tof + m_tofOffset) * factor;
+    if (!(x >= m_binEdges.front() && x < m_binEdges.back()))
+      return false;
+    bin = findBinIndex(x);
+    return true;
+  }
+
+  void addEvents(std::vector<Contribution> &contributions);
+
+  /// Number of spectra being accumulated
+  std::size_t numberOfSpectra() const { return m_xFactors.size(); }
+  /// Number of bins in each spectrum
+  std::size_t numberOfBins() const { return m_binEdges.size() - 1; }
+  /// Number of events that were added to the histograms
+  std::size_t numberOfEvents() const { return m_numEvents; }
+  /// The bin edges shared by all spectra
+  const std::vector<double> &binEdges() const { return m_binEdges; }
+
+  void moveInto(API::MatrixWorkspace &workspace);
+
+private:
+  std::size_t findBinIndex(const double x) const;
+
+  /// Bin edges in the output unit
+  const std::vector<double> m_binEdges;
+  /// Per workspace index factor converting time-of-flight to the output unit; zero to skip the spectrum
+  const std::vector<double> m_xFactors;
+  /// Offset added to every time-of-flight before it is converted
+  const double m_tofOffset;
+  /// True if the events carry weights, in which case the squared errors are accumulated separately
+  const bool m_weighted;
+  /// Constant bin width if the bins are linear, zero otherwise
+  double m_linearStep{0.};
+  /// Counts of each spectrum
+  std::vector<std::vector<double>> m_counts;
+  /// Squared errors of each spectrum, only used for weighted events
+  std::vector<std::vector<double>> m_errorsSquared;
+  /// Locks for blocks of consecutive spectra
+  std::unique_ptr<std::mutex[]> m_locks;
+  /// Total number of events added
+  std::atomic<std::size_t> m_numEvents{0};
+};
+
+} // namespace DataHandling
+} // namespace Mantid
@@ -43,6 +43,7 @@ public:
 
   void setNPeriods(size_t nPeriods, std::unique_ptr<const Kernel::TimeSeriesProperty<int>> &periodLog);
   void reserveEventListAt(size_t wi, size_t size);
+  void reserveEventListAt(size_t wi, size_t periodIndex, size_t size);
   size_t nPeriods() const;
   DataObjects::EventWorkspace_sptr getSingleHeldWorkspace();
   API::Workspace_sptr combinedWorkspace();
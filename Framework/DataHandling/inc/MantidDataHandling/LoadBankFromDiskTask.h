@@ -12,6 +12,7 @@
 #include "MantidKernel/ThreadScheduler.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace NeXus {
 class File;
@@ -44,6 +45,14 @@ private:
   std::unique_ptr<std::vector<float>> loadTof(::NeXus::File &file);
   std::unique_ptr<std::vector<float>> loadEventWeights(::NeXus::File &file);
   int64_t recalculateDataSize(const int64_t size);
+  int64_t getSlabSize(const int64_t numEvents) const;
+  void loadAndProcessInSlabs(::NeXus::File &file, const std::shared_ptr<std::vector<uint64_t>> &event_index,
+                             const int64_t start_event, const int64_t stop_event, const int64_t slabSize);
+  std::vector<std::shared_ptr<Kernel::Task>>
+  createProcessingTasks(const std::shared_ptr<std::vector<uint32_t>> &event_id,
+                        const std::shared_ptr<std::vector<float>> &event_time_of_flight,
+                        const std::shared_ptr<std::vector<float>> &event_weight,
+                        const std::shared_ptr<std::vector<uint64_t>> &event_index);
 
   /// Algorithm being run
   DefaultEventLoader &m_loader;
@@ -59,6 +68,8 @@ private:
   std::shared_ptr<BankPulseTimes> thisBankPulseTimes;
   /// Did we get an error in loading
   bool m_loadError;
+  /// None of the detector IDs last read by loadEventId() are in the instrument
+  bool m_noValidIds;
   // Old names in the file are different
   std::string m_detIdFieldName;
   std::string m_timeOfFlightFieldName;
@@ -12,6 +12,7 @@
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataHandling/BankPulseTimes.h"
 #include "MantidDataHandling/DllConfig.h"
+#include "MantidDataHandling/EventHistogramAccumulator.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
 #include "MantidDataHandling/LoadGeometry.h"
 #include "MantidDataObjects/EventList.h"
@@ -162,6 +163,9 @@ public:
 
   bool filter_bad_pulses{false};
   std::shared_ptr<Mantid::Kernel::TimeROI> bad_pulses_timeroi;
+  /// Times when the run was not paused. Only set when histogramming on load,
+  /// where paused pulses are skipped while binning.
+  std::shared_ptr<Mantid::Kernel::TimeROI> pause_timeroi;
 
   /// Mutex protecting tof limits
   std::mutex m_tofMutex;
@@ -181,6 +185,9 @@ public:
   double compressTolerance;
   bool compressEvents;
 
+  /// Histograms being filled while loading; null when the events are kept
+  std::unique_ptr<EventHistogramAccumulator> histogramAccumulator;
+
   /// Pulse times for ALL banks, taken from proton_charge log.
   std::shared_ptr<BankPulseTimes> m_allBanksPulseTimes;
 
@@ -206,6 +213,8 @@ private:
   DataObjects::EventWorkspace_sptr createEmptyEventWorkspace();
 
   void loadEvents(API::Progress *const prog, const bool monitors);
+  void setupHistogramOnLoad(const Kernel::NexusHDF5Descriptor &descriptor, const bool haveWeights);
+  API::MatrixWorkspace_sptr createHistogramWorkspace();
   void createSpectraMapping(const std::string &nxsfile, const bool monitorsOnly,
                             const std::vector<std::string> &bankNames = std::vector<std::string>());
   void deleteBanks(const EventWorkspaceCollection_sptr &workspace, const std::vector<std::string> &bankNames);
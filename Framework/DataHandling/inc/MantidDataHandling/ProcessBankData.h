@@ -19,6 +19,7 @@ class Progress;
 }
 namespace DataHandling {
 class DefaultEventLoader;
+class PulseIndexer;
 
 /** This task does the disk IO from loading the NXS file,
  * and so will be on a disk IO mutex */
@@ -52,7 +53,7 @@ public:
 
 private:
   size_t getWorkspaceIndexFromPixelID(const detid_t pixID);
-  void preCountAndReserveMem();
+  void preCountAndReserveMem(const PulseIndexer &pulseIndexer);
 
   /// Algorithm being run
   DefaultEventLoader &m_loader;
@@ -0,0 +1,68 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataHandling/BankPulseTimes.h"
+#include "MantidDataHandling/DllConfig.h"
+#include "MantidGeometry/IDTypes.h"
+#include "MantidKernel/Task.h"
+
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class Progress; // forward declare
+}
+namespace DataHandling {
+class DefaultEventLoader; // forward declare
+
+/** ProcessBankHistogram : Histograms the events of (part of) a bank straight
+ * into the loader's EventHistogramAccumulator, without creating event lists.
+ * The same pulse, time-of-flight and bad pulse filtering as ProcessBankData is
+ * applied.
+ */
+class MANTID_DATAHANDLING_DLL ProcessBankHistogram : public Mantid::Kernel::Task {
+public:
+  ProcessBankHistogram(DefaultEventLoader &loader, const std::string &entry_name, API::Progress *prog,
+                       std::shared_ptr<std::vector<uint32_t>> event_id,
+                       std::shared_ptr<std::vector<float>> event_time_of_flight, size_t numEvents, size_t startAt,
+                       std::shared_ptr<std::vector<uint64_t>> event_index,
+                       std::shared_ptr<BankPulseTimes> thisBankPulseTimes,
+                       std::shared_ptr<std::vector<float>> event_weight, detid_t min_event_id, detid_t max_event_id);
+
+  void run() override;
+
+private:
+  /// Algorithm being run
+  DefaultEventLoader &m_loader;
+  /// NXS path to bank
+  const std::string m_entry_name;
+  /// Progress reporting
+  API::Progress *m_prog;
+  /// event pixel ID array
+  const std::shared_ptr<std::vector<uint32_t>> m_event_id;
+  /// event TOF array
+  const std::shared_ptr<std::vector<float>> m_event_tof;
+  /// # of events in arrays
+  const size_t m_numEvents;
+  /// index of the first event from event_index
+  const size_t m_startAt;
+  /// vector of event index (length of # of pulses)
+  const std::shared_ptr<std::vector<uint64_t>> m_event_index;
+  /// Pulse times for this bank
+  const std::shared_ptr<BankPulseTimes> m_bankPulseTimes;
+  /// event weights array, null if the events are not weighted
+  const std::shared_ptr<std::vector<float>> m_event_weight;
+  /// Minimum pixel id (inclusive)
+  const detid_t m_min_id;
+  /// Maximum pixel id (inclusive)
+  const detid_t m_max_id;
+};
+
+} // namespace DataHandling
+} // namespace Mantid
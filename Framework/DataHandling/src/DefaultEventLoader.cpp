@@ -8,11 +8,19 @@
 #include "MantidAPI/Progress.h"
 #include "MantidDataHandling/LoadBankFromDiskTask.h"
 #include "MantidDataHandling/LoadEventNexus.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
 
+#include <algorithm>
+
 using namespace Mantid::Kernel;
 
+namespace {
+/// Memory used to read large banks in slabs when loadeventnexus.readbuffer.size is not set
+constexpr int DEFAULT_READ_BUFFER_MB{1024};
+} // namespace
+
 namespace Mantid::DataHandling {
 
 void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws, bool haveWeights,
@@ -58,7 +66,21 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollec
     pixelID_to_wi_vector = m_ws.getDetectorIDToWorkspaceIndexVector(pixelID_to_wi_offset, true);
 
   // Cache a map for speed.
-  if (!haveWeights) {
+  if (alg->histogramAccumulator) {
+    // Events go straight into histograms, so only the workspace index of each event ID is needed
+    if (event_id_is_spec) {
+      const auto *ax1 = m_ws.getAxis(1);
+      for (size_t i = 0; i < ax1->length(); i++) {
+        const auto spec = static_cast<size_t>(ax1->spectraNo(i));
+        if (spec >= eventId_to_wi_vector.size())
+          eventId_to_wi_vector.resize(spec + 1, m_ws.getNumberHistograms());
+        eventId_to_wi_vector[spec] = i;
+      }
+    } else {
+      eventId_to_wi_vector = pixelID_to_wi_vector;
+      eventId_to_wi_offset = pixelID_to_wi_offset;
+    }
+  } else if (!haveWeights) {
     if (alg->compressEvents && alg->compressTolerance != 0) {
       // Convert to weighted events
       for (size_t i = 0; i < m_ws.getNumberHistograms(); i++) {
@@ -83,6 +105,11 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollec
   // split banks up if the number of cores is more than twice the number of
   // banks
   splitProcessing = bool(numBanks * 2 < ThreadPool::getNumPhysicalCores());
+
+  // memory for reading large banks in slabs, given in MB
+  const auto readBufferSizeConfigVal = ConfigService::Instance().getValue<int>("loadeventnexus.readbuffer.size");
+  const int readBufferMB = readBufferSizeConfigVal.value_or(DEFAULT_READ_BUFFER_MB);
+  readBufferSize = static_cast<std::size_t>(std::max(readBufferMB, 0)) * 1024 * 1024;
 }
 
 std::pair<size_t, size_t> DefaultEventLoader::setupChunking(std::vector<std::string> &bankNames,
@@ -0,0 +1,150 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataHandling/EventHistogramAccumulator.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidHistogramData/Counts.h"
+#include "MantidHistogramData/CountVariances.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid::DataHandling {
+
+namespace {
+/// Number of consecutive spectra that share a lock
+constexpr std::size_t SPECTRA_PER_LOCK{1024};
+/// Relative tolerance on the bin widths for the bins to be treated as linear
+constexpr double LINEAR_BINS_TOLERANCE{1.e-9};
+} // namespace
+
+/** Constructor
+ * @param binEdges :: bin edges, in the output unit, used for every spectrum
+ * @param xFactors :: per workspace index factor converting time-of-flight to the output unit. Events in spectra with a
+ * factor of zero are not histogrammed.
+ * @param tofOffset :: offset added to each time-of-flight before it is converted
+ * @param weighted :: whether the events carry weights
+ */
+EventHistogramAccumulator::EventHistogramAccumulator(std::vector<double> binEdges, std::vector<double> xFactors,
+                                                     const double tofOffset, const bool weighted)
+    : m_binEdges(std::move(binEdges)), m_xFactors(std::move(xFactors)), m_tofOffset(tofOffset), m_weighted(weighted) {
+  if (m_binEdges.size() < 2)
+    throw std::invalid_argument("At least two bin edges are needed to histogram events");
+  if (!std::is_sorted(m_binEdges.cbegin(), m_binEdges.cend()))
+    throw std::invalid_argument("The bin edges to histogram events into must be increasing");
+
+  // check for constant bin widths, which allows the bin to be calculated rather than searched for
+  const double step = (m_binEdges.back() - m_binEdges.front()) / static_cast<double>(numberOfBins());
+  bool linear = step > 0.;
+  for (std::size_t i = 1; linear && i < m_binEdges.size(); ++i)
+    linear = std::abs((m_binEdges[i] - m_binEdges[i - 1]) - step) <= LINEAR_BINS_TOLERANCE * step;
+  if (linear)
+    m_linearStep = step;
+
+  m_counts.resize(m_xFactors.size());
+  if (m_weighted)
+    m_errorsSquared.resize(m_xFactors.size());
+  m_locks = std::make_unique<std::mutex[]>(m_xFactors.size() / SPECTRA_PER_LOCK + 1);
+}
+
+/** Find the bin that contains x, which must be inside the binning range
+ * @param x :: value in the output unit
+ * @return index of the bin
+ */
+std::size_t EventHistogramAccumulator::findBinIndex(const double x) const {
+  const std::size_t lastBin = numberOfBins() - 1;
+  if (m_linearStep > 0.) {
+    auto bin = std::min(static_cast<std::size_t>((x - m_binEdges.front()) / m_linearStep), lastBin);
+    // correct for rounding in the estimate
+    while (bin > 0 && x < m_binEdges[bin])
+      --bin;
+    while (bin < lastBin && x >= m_binEdges[bin + 1])
+      ++bin;
+    return bin;
+  }
+  const auto upper = std::upper_bound(m_binEdges.cbegin(), m_binEdges.cend(), x);
+  return std::min(static_cast<std::size_t>(std::distance(m_binEdges.cbegin(), upper)) - 1, lastBin);
+}
+
+/** Add a block of events to the histograms. The events are grouped by lock
+ * first so that each lock is taken once per block.
+ * @param contributions :: the events to add. This is cleared on return.
+ */
+void EventHistogramAccumulator::addEvents(std::vector<Contribution> &contributions) {
+  if (contributions.empty())
+    return;
+
+  // group the contributions by lock with a counting sort, which keeps their order within each lock
+  const std::size_t numLocks = m_xFactors.size() / SPECTRA_PER_LOCK + 1;
+  std::vector<std::size_t> offsets(numLocks + 1, 0);
+  for (const auto &contribution : contributions)
+    ++offsets[contribution.workspaceIndex / SPECTRA_PER_LOCK + 1];
+  for (std::size_t lock = 0; lock < numLocks; ++lock)
+    offsets[lock + 1] += offsets[lock];
+  std::vector<Contribution> grouped(contributions.size());
+  {
+    auto next = offsets;
+    for (const auto &contribution : contributions)
+      grouped[next[contribution.workspaceIndex / SPECTRA_PER_LOCK]++] = contribution;
+  }
+
+  const std::size_t numBins = numberOfBins();
+  for (std::size_t lock = 0; lock < numLocks; ++lock) {
+    if (offsets[lock] == offsets[lock + 1])
+      continue;
+    std::lock_guard<std::mutex> _lock(m_locks[lock]);
+    for (std::size_t i = offsets[lock]; i < offsets[lock + 1]; ++i) {
+      const auto &contribution = grouped[i];
+      auto &counts = m_counts[contribution.workspaceIndex];
+      if (counts.empty())
+        counts.resize(numBins, 0.);
+      counts[contribution.bin] += contribution.weight;
+      if (m_weighted) {
+        auto &errorsSquared = m_errorsSquared[contribution.workspaceIndex];
+        if (errorsSquared.empty())
+          errorsSquared.resize(numBins, 0.);
+        errorsSquared[contribution.bin] += contribution.weight * contribution.weight;
+      }
+    }
+  }
+
+  m_numEvents += contributions.size();
+  contributions.clear();
+}
+
+/** Move the accumulated histograms into a workspace. The workspace must have
+ * the same number of spectra and bins; its bin edges are not changed. The
+ * accumulator is empty afterwards.
+ * @param workspace :: the workspace to set the counts and errors of
+ */
+void EventHistogramAccumulator::moveInto(API::MatrixWorkspace &workspace) {
+  if (workspace.getNumberHistograms() != numberOfSpectra())
+    throw std::invalid_argument("The workspace to hold the histograms has the wrong number of spectra");
+  if (workspace.blocksize() != numberOfBins())
+    throw std::invalid_argument("The workspace to hold the histograms has the wrong number of bins");
+
+  const std::size_t numBins = numberOfBins();
+  for (std::size_t wi = 0; wi < numberOfSpectra(); ++wi) {
+    auto counts = std::move(m_counts[wi]);
+    if (counts.empty())
+      counts.resize(numBins, 0.);
+    std::vector<double> variances;
+    if (m_weighted) {
+      variances = std::move(m_errorsSquared[wi]);
+      if (variances.empty())
+        variances.resize(numBins, 0.);
+    } else {
+      variances = counts;
+    }
+    workspace.setCounts(wi, std::move(counts));
+    workspace.setCountVariances(wi, std::move(variances));
+  }
+  m_counts.clear();
+  m_errorsSquared.clear();
+}
+
+} // namespace Mantid::DataHandling
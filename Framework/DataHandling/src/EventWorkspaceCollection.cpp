@@ -105,6 +105,23 @@ void EventWorkspaceCollection::reserveEventListAt(size_t wi, size_t size) {
   }
 }
 
+/** Reserve room for more events in the event list of a single period. An
+ * empty list is reserved for exactly the new events. A list that already
+ * holds events, e.g. from an earlier slab of the bank, and is too small is at
+ * least doubled. Filling a list in many steps then reallocates it only a
+ * logarithmic number of times, and its capacity stays within twice the final
+ * number of events.
+ * @param wi :: workspace index of the event list
+ * @param periodIndex :: index of the period workspace
+ * @param size :: number of events that will be added
+ */
+void EventWorkspaceCollection::reserveEventListAt(size_t wi, size_t periodIndex, size_t size) {
+  auto &eventList = m_WsVec[periodIndex]->getSpectrum(wi);
+  const size_t numEvents = eventList.getNumberEvents();
+  if (numEvents + size > eventList.capacity())
+    eventList.reserve(std::max(numEvents + size, 2 * numEvents));
+}
+
 size_t EventWorkspaceCollection::nPeriods() const { return m_WsVec.size(); }
 
 DataObjects::EventWorkspace_sptr EventWorkspaceCollection::getSingleHeldWorkspace() { return m_WsVec.front(); }
@@ -10,6 +10,7 @@
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidDataHandling/ProcessBankCompressed.h"
 #include "MantidDataHandling/ProcessBankData.h"
+#include "MantidDataHandling/ProcessBankHistogram.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/VectorHelper.h"
@@ -17,16 +18,108 @@
 #include "MantidNexusCpp/NeXusException.hpp"
 #include "MantidNexusCpp/NeXusFile.hpp"
 
+#include <H5Cpp.h>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <utility>
 
 namespace {
 // this is used for unit conversion to correct units
 const std::string MICROSEC("microseconds");
+
+/// Number of values in each HDF5 chunk of a one dimensional dataset, or 1 if
+/// it is not chunked or cannot be inspected
+int64_t getChunkLength(const std::string &filename, const std::string &path) {
+  try {
+    // a missing or unchunked dataset is expected, do not print the HDF5 error stack
+    H5::Exception::dontPrint();
+    H5::H5File file(filename, H5F_ACC_RDONLY);
+    const auto createPlist = file.openDataSet(path).getCreatePlist();
+    if (createPlist.getLayout() == H5D_CHUNKED) {
+      hsize_t chunkDims[1] = {1};
+      createPlist.getChunk(1, chunkDims);
+      return std::max<int64_t>(static_cast<int64_t>(chunkDims[0]), 1);
+    }
+  } catch (const H5::Exception &) {
+    // fall through to reading unaligned slabs
+  }
+  return 1;
+}
 } // namespace
 
 namespace Mantid::DataHandling {
 
+namespace {
+/** Wraps a processing task of one slab of a bank, so that the bank reader can
+ * wait for it to finish, or run it itself if no thread has started it yet.
+ */
+class SlabTask : public Kernel::Task {
+public:
+  explicit SlabTask(std::shared_ptr<Kernel::Task> task) : Kernel::Task(task->cost()), m_task(std::move(task)) {}
+
+  void run() override { runOnce(); }
+
+  /// Block until the task has run, running it in this thread if needed
+  void wait() {
+    if (runOnce())
+      return;
+    std::unique_lock<std::mutex> lock(m_doneMutex);
+    m_doneCondition.wait(lock, [this] { return m_done; });
+  }
+
+private:
+  /// Run the task unless it was already started. Returns false if it was.
+  bool runOnce() {
+    if (m_started.exchange(true))
+      return false;
+    try {
+      m_task->run();
+    } catch (...) {
+      markDone();
+      throw;
+    }
+    markDone();
+    return true;
+  }
+
+  void markDone() {
+    // the events are no longer needed
+    m_task.reset();
+    {
+      std::lock_guard<std::mutex> lock(m_doneMutex);
+      m_done = true;
+    }
+    m_doneCondition.notify_all();
+  }
+
+  std::shared_ptr<Kernel::Task> m_task;
+  std::atomic<bool> m_started{false};
+  bool m_done{false};
+  std::mutex m_doneMutex;
+  std::condition_variable m_doneCondition;
+};
+
+/// Releases a locked mutex for the lifetime of the object, so that other
+/// tasks can use the disk while this one waits on processing
+class ScopedUnlock {
+public:
+  explicit ScopedUnlock(std::shared_ptr<std::mutex> mutex) : m_mutex(std::move(mutex)) {
+    if (m_mutex)
+      m_mutex->unlock();
+  }
+  ~ScopedUnlock() {
+    if (m_mutex)
+      m_mutex->lock();
+  }
+  ScopedUnlock(const ScopedUnlock &) = delete;
+  ScopedUnlock &operator=(const ScopedUnlock &) = delete;
+
+private:
+  std::shared_ptr<std::mutex> m_mutex;
+};
+} // namespace
+
 /** Constructor
  *
  * @param loader :: Handle to the main loader
@@ -44,7 +137,7 @@ LoadBankFromDiskTask::LoadBankFromDiskTask(DefaultEventLoader &loader, std::stri
                                            API::Progress *prog, std::shared_ptr<std::mutex> ioMutex,
                                            Kernel::ThreadScheduler &scheduler, std::vector<int> framePeriodNumbers)
     : m_loader(loader), entry_name(std::move(entry_name)), entry_type(std::move(entry_type)), prog(prog),
-      scheduler(scheduler), m_loadError(false), m_have_weight(false),
+      scheduler(scheduler), m_loadError(false), m_noValidIds(false), m_have_weight(false),
       m_framePeriodNumbers(std::move(framePeriodNumbers)) {
   setMutex(ioMutex);
   m_cost = static_cast<double>(numEvents);
@@ -181,7 +274,8 @@ std::unique_ptr<std::vector<uint32_t>> LoadBankFromDiskTask::loadEventId(::NeXus
   }
 
   // Now we allocate the required arrays
-  auto event_id = std::make_unique<std::vector<uint32_t>>(dim0);
+  auto event_id = std::make_unique<std::vector<uint32_t>>(m_loadSize[0]);
+  m_noValidIds = false;
 
   if (!m_loadError) {
     Mantid::NeXus::NeXusIOHelper::readNexusSlab<uint32_t, Mantid::NeXus::NeXusIOHelper::PreventNarrowing>(
@@ -198,8 +292,8 @@ std::unique_ptr<std::vector<uint32_t>> LoadBankFromDiskTask::loadEventId(::NeXus
     if (m_min_id > static_cast<uint32_t>(m_loader.eventid_max)) {
       // All the detector IDs in the bank are higher than the highest 'known'
       // (from the IDF)
-      // ID. Setting this will abort the loading of the bank.
-      m_loadError = true;
+      // ID. There is nothing to process in these events.
+      m_noValidIds = true;
     }
     // fixup the minimum pixel id in the case that it's lower than the lowest
     // 'known' id. We test this by checking that when we add the offset we
@@ -225,10 +319,6 @@ std::unique_ptr<std::vector<float>> LoadBankFromDiskTask::loadTof(::NeXus::File
   // Get the list of event_time_of_flight's
   file.openData(m_timeOfFlightFieldName);
 
-  // This is the data size
-  ::NeXus::Info id_info = file.getInfo();
-  const int64_t dim0 = recalculateDataSize(id_info.dims[0]);
-
   // Check that the required space is there in the file.
   ::NeXus::Info tof_info = file.getInfo();
   int64_t tof_dim0 = recalculateDataSize(tof_info.dims[0]);
@@ -240,7 +330,7 @@ std::unique_ptr<std::vector<float>> LoadBankFromDiskTask::loadTof(::NeXus::File
   }
 
   // Allocate the array
-  auto event_time_of_flight = std::make_unique<std::vector<float>>(dim0);
+  auto event_time_of_flight = std::make_unique<std::vector<float>>(m_loadSize[0]);
 
   // Mantid assumes event_time_offset to be float.
   // Nexus only requires event_time_offset to be a NXNumber.
@@ -323,6 +413,7 @@ void LoadBankFromDiskTask::run() {
   std::unique_ptr<std::vector<float>> event_time_of_flight;
   std::unique_ptr<std::vector<float>> event_weight;
   std::unique_ptr<std::vector<uint64_t>> event_index;
+  bool loadedInSlabs = false;
 
   // Open the file
   ::NeXus::File file(m_loader.alg->m_filename);
@@ -366,15 +457,25 @@ void LoadBankFromDiskTask::run() {
       m_loadStart[0] = start_event;
       m_loadSize[0] = stop_event - start_event;
 
-      if ((m_loader.alg->compressEvents) || ((m_loadSize[0] > 0) && (m_loadStart[0] >= 0))) {
+      const int64_t slabSize = event_index ? this->getSlabSize(m_loadSize[0]) : 0;
+      if ((slabSize > 0) && (m_loadStart[0] >= 0)) {
+        // large bank, process it in pieces while it is read
+        file.closeData();
+        this->loadAndProcessInSlabs(file, std::move(event_index), start_event, stop_event, slabSize);
+        loadedInSlabs = true;
+      } else if ((m_loader.alg->compressEvents) || ((m_loadSize[0] > 0) && (m_loadStart[0] >= 0))) {
         if (m_loader.alg->getCancel()) {
           m_loader.alg->getLogger().error() << "Loading bank " << entry_name << " is cancelled.\n";
           m_loadError = true; // To allow cancelling the algorithm
         }
 
         // Load pixel IDs
-        if (!m_loadError)
+        if (!m_loadError) {
           event_id = this->loadEventId(file);
+          // abort the loading of the bank if none of the IDs are known
+          if (m_noValidIds)
+            m_loadError = true;
+        }
 
         // for compression the number of events needs to come from elsewhere
         if (!event_index)
@@ -416,11 +517,35 @@ void LoadBankFromDiskTask::run() {
   file.closeGroup();
   file.close();
 
-  // Abort if anything failed
-  if (m_loadError) {
+  // Abort if anything failed, or if the events were already handed over
+  if (m_loadError || loadedInSlabs) {
     return;
   }
 
+  // No error? Launch new tasks to process that data.
+  for (auto &task : this->createProcessingTasks(std::move(event_id), std::move(event_time_of_flight),
+                                                std::move(event_weight), std::move(event_index)))
+    scheduler.push(task);
+
+#ifndef _WIN32
+  if (m_loader.alg->getLogger().isDebug())
+    m_loader.alg->getLogger().debug() << "Time to LoadBankFromDisk " << entry_name << " " << timer << "\n";
+#endif
+}
+
+/** Create the tasks that process the events that have been read, which are
+ * the ones described by m_loadStart and m_loadSize
+ * @param event_id :: detector or spectrum ID of each event
+ * @param event_time_of_flight :: time-of-flight of each event
+ * @param event_weight :: weight of each event, null if the events are not weighted
+ * @param event_index :: index of the first event of each pulse
+ * @returns the tasks to schedule, which is empty if none of the events are wanted
+ */
+std::vector<std::shared_ptr<Kernel::Task>>
+LoadBankFromDiskTask::createProcessingTasks(const std::shared_ptr<std::vector<uint32_t>> &event_id,
+                                            const std::shared_ptr<std::vector<float>> &event_time_of_flight,
+                                            const std::shared_ptr<std::vector<float>> &event_weight,
+                                            const std::shared_ptr<std::vector<uint64_t>> &event_index) {
   const auto bank_size = m_max_id - m_min_id;
   const auto minSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMin);
   const auto maxSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMax);
@@ -430,7 +555,7 @@ void LoadBankFromDiskTask::run() {
   if (minSpectraToLoad != emptyInt && m_min_id < minSpectraToLoad) {
     if (minSpectraToLoad > m_max_id) { // the minimum spectra to load is more
                                        // than the max of this bank
-      return;
+      return {};
     }
     // the min spectra to load is higher than the min for this bank
     m_min_id = minSpectraToLoad;
@@ -438,7 +563,7 @@ void LoadBankFromDiskTask::run() {
   if (maxSpectraToLoad != emptyInt && m_max_id > maxSpectraToLoad) {
     if (maxSpectraToLoad < m_min_id) {
       // the maximum spectra to load is less than the minimum of this bank
-      return;
+      return {};
     }
     // the max spectra to load is lower than the max for this bank
     m_max_id = maxSpectraToLoad;
@@ -446,7 +571,7 @@ void LoadBankFromDiskTask::run() {
   if (m_min_id > m_max_id) {
     // the min is now larger than the max, this means the entire block of
     // spectra to load is outside this bank
-    return;
+    return {};
   }
 
   // schedule the job to generate the event lists
@@ -456,22 +581,28 @@ void LoadBankFromDiskTask::run() {
     // of the whole bank
     mid_id = (m_max_id + m_min_id) / 2;
 
-  // No error? Launch a new task to process that data.
   const auto numEvents = static_cast<size_t>(m_loadSize[0]);
   const auto startAt = static_cast<size_t>(m_loadStart[0]);
 
-  // convert things to shared_arrays to share between tasks
-  std::shared_ptr<std::vector<uint32_t>> event_id_shrd(std::move(event_id));
-  std::shared_ptr<std::vector<float>> event_time_of_flight_shrd(std::move(event_time_of_flight));
-  std::shared_ptr<std::vector<float>> event_weight_shrd(std::move(event_weight));
-  std::shared_ptr<std::vector<uint64_t>> event_index_shrd(std::move(event_index));
-
-  if ((m_loader.alg->compressEvents) && (!event_weight_shrd) && (m_loader.alg->compressTolerance != 0)) {
+  std::vector<std::shared_ptr<Task>> tasks;
+  if (m_loader.alg->histogramAccumulator) {
+    // histogram the events while loading without creating event lists
+    std::shared_ptr<Task> newTask1 = std::make_shared<ProcessBankHistogram>(
+        m_loader, entry_name, prog, event_id, event_time_of_flight, numEvents, startAt, event_index,
+        thisBankPulseTimes, event_weight, m_min_id, mid_id);
+    tasks.push_back(std::move(newTask1));
+    if (m_loader.splitProcessing && (mid_id < m_max_id)) {
+      std::shared_ptr<Task> newTask2 = std::make_shared<ProcessBankHistogram>(
+          m_loader, entry_name, prog, event_id, event_time_of_flight, numEvents, startAt, event_index,
+          thisBankPulseTimes, event_weight, (mid_id + 1), m_max_id);
+      tasks.push_back(std::move(newTask2));
+    }
+  } else if ((m_loader.alg->compressEvents) && (!event_weight) && (m_loader.alg->compressTolerance != 0)) {
     // this method is for unweighted events that the user wants compressed on load
 
     // TODO should this be created elsewhere?
     const auto [tof_min, tof_max] =
-        std::minmax_element(event_time_of_flight_shrd->cbegin(), event_time_of_flight_shrd->cend());
+        std::minmax_element(event_time_of_flight->cbegin(), event_time_of_flight->cend());
 
     const bool log_compression = (m_loader.alg->compressTolerance < 0);
 
@@ -515,33 +646,111 @@ void LoadBankFromDiskTask::run() {
 
     // create the tasks
     std::shared_ptr<Task> newTask1 = std::make_shared<ProcessBankCompressed>(
-        m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd, startAt, event_index_shrd,
+        m_loader, entry_name, prog, event_id, event_time_of_flight, startAt, event_index,
         thisBankPulseTimes, m_min_id, mid_id, histogram_bin_edges, m_loader.alg->compressTolerance);
-    scheduler.push(newTask1);
+    tasks.push_back(std::move(newTask1));
     if (m_loader.splitProcessing && (mid_id < m_max_id)) {
       std::shared_ptr<Task> newTask2 = std::make_shared<ProcessBankCompressed>(
-          m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd, startAt, event_index_shrd,
+          m_loader, entry_name, prog, event_id, event_time_of_flight, startAt, event_index,
           thisBankPulseTimes, (mid_id + 1), m_max_id, histogram_bin_edges, m_loader.alg->compressTolerance);
-      scheduler.push(newTask2);
+      tasks.push_back(std::move(newTask2));
     }
   } else {
     // create all events using traditional method
     std::shared_ptr<Task> newTask1 = std::make_shared<ProcessBankData>(
-        m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd, numEvents, startAt, event_index_shrd,
-        thisBankPulseTimes, m_have_weight, event_weight_shrd, m_min_id, mid_id);
-    scheduler.push(newTask1);
+        m_loader, entry_name, prog, event_id, event_time_of_flight, numEvents, startAt, event_index,
+        thisBankPulseTimes, m_have_weight, event_weight, m_min_id, mid_id);
+    tasks.push_back(std::move(newTask1));
     if (m_loader.splitProcessing && (mid_id < m_max_id)) {
       std::shared_ptr<Task> newTask2 = std::make_shared<ProcessBankData>(
-          m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd, numEvents, startAt, event_index_shrd,
-          thisBankPulseTimes, m_have_weight, event_weight_shrd, (mid_id + 1), m_max_id);
-      scheduler.push(newTask2);
+          m_loader, entry_name, prog, event_id, event_time_of_flight, numEvents, startAt, event_index,
+          thisBankPulseTimes, m_have_weight, event_weight, (mid_id + 1), m_max_id);
+      tasks.push_back(std::move(newTask2));
     }
   }
 
-#ifndef _WIN32
-  if (m_loader.alg->getLogger().isDebug())
-    m_loader.alg->getLogger().debug() << "Time to LoadBankFromDisk " << entry_name << " " << timer << "\n";
-#endif
+  return tasks;
+}
+
+/** Work out how many events to read at a time so that reading a large bank
+ * can overlap with processing the events that were already read. Slabs are
+ * whole HDF5 chunks of the event_id field, so no chunk is read twice.
+ * @param numEvents :: the number of events to load from this bank
+ * @returns the number of events in each slab, or 0 to read the bank at once
+ */
+int64_t LoadBankFromDiskTask::getSlabSize(const int64_t numEvents) const {
+  const auto *alg = m_loader.alg;
+  // compressed events are accumulated over the whole bank
+  if (m_loader.readBufferSize == 0 || (alg->compressEvents && alg->compressTolerance != 0))
+    return 0;
+
+  // one slab is processed while the next one is read
+  const std::size_t bytesPerEvent = sizeof(uint32_t) + sizeof(float) + (m_have_weight ? sizeof(float) : 0);
+  const auto slabSize = static_cast<int64_t>(m_loader.readBufferSize / (2 * bytesPerEvent));
+  if (numEvents <= slabSize)
+    return 0;
+
+  const auto chunkLength = getChunkLength(alg->m_filename, "/" + alg->m_top_entry_name + "/" + entry_name + "/" +
+                                                               m_detIdFieldName);
+  return std::max<int64_t>(slabSize / chunkLength, 1) * chunkLength;
+}
+
+/** Read the events of the bank in slabs. The processing tasks of each slab
+ * are scheduled as soon as it has been read, so that they run while the next
+ * slab is read. They must finish before the tasks of the next slab are
+ * scheduled, which keeps the events in file order and limits the memory used
+ * to two slabs. Tasks that no thread has picked up by then are run here.
+ * @param file :: File handle for the NeXus file, opened at the bank
+ * @param event_index :: index of the first event of each pulse
+ * @param start_event :: index of the first event to load
+ * @param stop_event :: index of the last event to load + 1
+ * @param slabSize :: number of events in each slab
+ */
+void LoadBankFromDiskTask::loadAndProcessInSlabs(::NeXus::File &file,
+                                                 const std::shared_ptr<std::vector<uint64_t>> &event_index,
+                                                 const int64_t start_event, const int64_t stop_event,
+                                                 const int64_t slabSize) {
+  std::vector<std::shared_ptr<SlabTask>> previousSlab;
+  int64_t slabStart = start_event;
+  while (slabStart < stop_event) {
+    // slabs end on chunk boundaries
+    const int64_t slabStop = std::min(stop_event, (slabStart / slabSize + 1) * slabSize);
+    m_loadStart[0] = slabStart;
+    m_loadSize[0] = slabStop - slabStart;
+    slabStart = slabStop;
+
+    if (m_loader.alg->getCancel()) {
+      m_loader.alg->getLogger().error() << "Loading bank " << entry_name << " is cancelled.\n";
+      m_loadError = true; // To allow cancelling the algorithm
+      return;
+    }
+
+    file.openData(m_detIdFieldName);
+    std::shared_ptr<std::vector<uint32_t>> event_id = this->loadEventId(file);
+    if (m_loadError)
+      return;
+    if (m_noValidIds) // none of the detector IDs in this slab are in the instrument
+      continue;
+    std::shared_ptr<std::vector<float>> event_time_of_flight = this->loadTof(file);
+    std::shared_ptr<std::vector<float>> event_weight;
+    if (m_have_weight)
+      event_weight = this->loadEventWeights(file);
+    if (m_loadError)
+      return;
+
+    auto tasks = this->createProcessingTasks(event_id, event_time_of_flight, event_weight, event_index);
+    if (!previousSlab.empty()) {
+      // the disk lock, taken by the thread pool, is not needed to process events
+      ScopedUnlock unlockDisk(getMutex());
+      for (const auto &task : previousSlab)
+        task->wait();
+      previousSlab.clear();
+    }
+    for (auto &task : tasks) {
+      previousSlab.emplace_back(std::make_shared<SlabTask>(std::move(task)));
+      scheduler.push(previousSlab.back());
+    }
+  }
 }
 
 /**
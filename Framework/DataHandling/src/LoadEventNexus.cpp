@@ -13,12 +13,15 @@
 #include "MantidAPI/RegisterFileLoader.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/Sample.h"
+#include "MantidAPI/SpectrumInfo.h"
 #include "MantidDataHandling/DefaultEventLoader.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
 #include "MantidDataHandling/LoadEventNexusIndexSetup.h"
 #include "MantidDataHandling/LoadHelper.h"
 #include "MantidDataHandling/ParallelEventLoader.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/Goniometer.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
@@ -29,15 +32,18 @@
 #include "MantidKernel/EnumeratedString.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Strings.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/UnitFactory.h"
+#include "MantidKernel/VectorHelper.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 #include "MantidNexus/NexusIOHelper.h"
 
 #include <H5Cpp.h>
 #include <boost/format.hpp>
 #include <memory>
+#include <optional>
 
 #include <regex>
 
@@ -71,7 +77,32 @@ namespace PropertyNames {
 const std::string COMPRESS_TOL("CompressTolerance");
 const std::string COMPRESS_MODE("CompressBinningMode");
 const std::string BAD_PULSES_CUTOFF("FilterBadPulsesLowerCutoff");
+const std::string COMPRESS_PULSE_TIMES("CompressPulseTimes");
 } // namespace PropertyNames
+
+/** The times when the run was not paused, computed from the "pause" log in the
+ * same way as FilterByLogValue does for filterDuringPause().
+ * @param run :: the run holding the logs
+ * @param existingROI :: a TimeROI to intersect the result with, or nullptr
+ * @return the ROI, or nothing if pauses are not filtered for this run
+ */
+std::optional<TimeROI> runningTimeROI(const Run &run, const TimeROI *existingROI) {
+  if (ConfigService::Instance().hasProperty("loadeventnexus.keeppausedevents") || !run.hasProperty("pause"))
+    return std::nullopt;
+  const auto *pauseLog = dynamic_cast<const ITimeSeriesProperty *>(run.getLogData("pause"));
+  if (!pauseLog || run.getLogData("pause")->size() <= 1)
+    return std::nullopt;
+  // The log value is set to 1 when the run is paused, 0 otherwise.
+  if (pauseLog->realSize() > 0 && run.hasProperty(LOG_CHARGE_NAME)) {
+    try {
+      const TimeInterval pulses(run.getFirstPulseTime(), run.getLastPulseTime());
+      return pauseLog->makeFilterByValue(0.0, 0.0, true, pulses, 0., false, existingROI);
+    } catch (std::runtime_error &) {
+      // no pulse times, so the edges of the log cannot be extended
+    }
+  }
+  return pauseLog->makeFilterByValue(0.0, 0.0, false, TimeInterval(0, 1), 0., false, existingROI);
+}
 } // namespace
 
 /**
@@ -202,6 +233,11 @@ void LoadEventNexus::init() {
       "Binning behavior can be specified in the usual way through sign of binwidth and other properties ('Default'); "
       "or can be set to one of the allowed binning modes. "
       "This will override all other specification or default behavior.");
+  declareProperty(
+      std::make_unique<PropertyWithValue<bool>>(PropertyNames::COMPRESS_PULSE_TIMES, false, Direction::Input),
+      "Store the pulse time of each event as an index into a table of the pulse times of the run "
+      "(optional, default False). This saves about a quarter of the memory used by the events, "
+      "while keeping them and their pulse times unchanged.");
 
   auto mustBePositive = std::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
@@ -220,6 +256,7 @@ void LoadEventNexus::init() {
   setPropertyGroup("Precount", grp3);
   setPropertyGroup(PropertyNames::COMPRESS_TOL, grp3);
   setPropertyGroup(PropertyNames::COMPRESS_MODE, grp3);
+  setPropertyGroup(PropertyNames::COMPRESS_PULSE_TIMES, grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
 
@@ -287,14 +324,16 @@ void LoadEventNexus::init() {
   std::vector<std::string> loadType{"Default"};
 
 #ifndef _WIN32
+  loadType.emplace_back("Multiprocess");
+  // kept so that existing scripts continue to work
   loadType.emplace_back("Multiprocess (experimental)");
 #endif // _WIN32
 
   auto loadTypeValidator = std::make_shared<StringListValidator>(loadType);
   declareProperty("LoadType", "Default", loadTypeValidator,
-                  "Set type of loader. 2 options {Default, Multiproceess},"
-                  "'Multiprocess' should work faster for big files and it is "
-                  "experimental, available only in Linux");
+                  "Set type of loader. 'Multiprocess' splits the events across several processes, "
+                  "which can read the file in parallel, and is only available on Linux and macOS. "
+                  "It falls back to 'Default' for the options that it does not support.");
 
   declareProperty(std::make_unique<PropertyWithValue<bool>>("LoadNexusInstrumentXML", true, Direction::Input),
                   "Reads the embedded Instrument XML from the NeXus file "
@@ -314,6 +353,20 @@ void LoadEventNexus::init() {
                                                                                 Direction::Input),
                   "If specified, these logs will NOT be loaded from the file (each "
                   "separated by a space).");
+
+  declareProperty(std::make_unique<ArrayProperty<double>>("HistogramBinning"),
+                  "Optional: Rebin parameters (x1, dx1, x2, ...) to histogram the events with while loading. If "
+                  "set, the individual events are not kept and a Workspace2D is produced instead of an "
+                  "EventWorkspace, which uses far less memory.");
+  declareProperty("HistogramUnits", "TOF",
+                  std::make_shared<StringListValidator>(std::vector<std::string>{"TOF", "dSpacing"}),
+                  "The units of HistogramBinning. d-spacing is calculated from the time-of-flight using the "
+                  "uncalibrated DIFC of each spectrum.");
+  setPropertySettings("HistogramUnits", std::make_unique<VisibleWhenProperty>("HistogramBinning", IS_NOT_DEFAULT));
+
+  std::string grp5 = "Histogram On Load";
+  setPropertyGroup("HistogramBinning", grp5);
+  setPropertyGroup("HistogramUnits", grp5);
 }
 
 std::map<std::string, std::string> LoadEventNexus::validateInputs() {
@@ -325,6 +378,18 @@ std::map<std::string, std::string> LoadEventNexus::validateInputs() {
       result[PropertyNames::BAD_PULSES_CUTOFF] = "Must be empty or between 0 and 100";
   }
 
+  if (!isDefault("HistogramBinning")) {
+    const std::vector<double> binning = getProperty("HistogramBinning");
+    if (binning.size() < 3 || binning.size() % 2 == 0)
+      result["HistogramBinning"] = "Must be of the form x1, dx1, x2, ..., xn";
+    if (getPropertyValue("LoadType") != "Default")
+      result["HistogramBinning"] = "Histogramming while loading is only supported by the Default loader";
+    if (!isDefault(PropertyNames::COMPRESS_TOL))
+      result[PropertyNames::COMPRESS_TOL] = "Events cannot be compressed when they are histogrammed while loading";
+    if (!isDefault(PropertyNames::COMPRESS_PULSE_TIMES))
+      result[PropertyNames::COMPRESS_PULSE_TIMES] = "No events are kept when they are histogrammed while loading";
+  }
+
   return result;
 }
 
@@ -470,14 +535,25 @@ void LoadEventNexus::execLoader() {
                            "These events were discarded.\n";
   }
 
-  // If the run was paused at any point, filter out those events (SNS only, I
-  // think)
-  filterDuringPause(m_ws->getSingleHeldWorkspace());
-
   // add filename
   m_ws->mutableRun().addProperty("Filename", m_filename);
-  // Save output
-  this->setProperty("OutputWorkspace", m_ws->combinedWorkspace());
+
+  if (histogramAccumulator) {
+    // paused pulses were already excluded while histogramming
+    this->setProperty("OutputWorkspace", createHistogramWorkspace());
+  } else {
+    // If the run was paused at any point, filter out those events (SNS only, I
+    // think)
+    filterDuringPause(m_ws->getSingleHeldWorkspace());
+    if (getProperty(PropertyNames::COMPRESS_PULSE_TIMES)) {
+      m_ws->applyFilter([](EventWorkspace_sptr workspace) {
+        workspace->compressPulseTimes();
+        return workspace;
+      });
+    }
+    // Save output
+    this->setProperty("OutputWorkspace", m_ws->combinedWorkspace());
+  }
 
   // close the file since LoadNexusMonitors will take care of its own file
   // handle
@@ -1183,6 +1259,9 @@ void LoadEventNexus::loadEvents(API::Progress *const prog, const bool monitors)
   for (size_t i = 0; i < m_ws->getNumberHistograms(); i++)
     m_ws->getSpectrum(i).setSortOrder(DataObjects::PULSETIME_SORT);
 
+  if (!monitors && !isDefault("HistogramBinning"))
+    setupHistogramOnLoad(*descriptor, haveWeights);
+
   // Count the limits to time of flight
   shortest_tof = static_cast<double>(std::numeric_limits<uint32_t>::max()) * 0.1;
   longest_tof = 0.;
@@ -1206,8 +1285,10 @@ void LoadEventNexus::loadEvents(API::Progress *const prog, const bool monitors)
     };
 
     try {
+      const auto startTime = std::chrono::high_resolution_clock::now();
       ParallelEventLoader::loadMultiProcess(*ws, m_filename, m_top_entry_name, bankNames, event_id_is_spec,
                                             getProperty("Precount"));
+      addTimer("loadEvents", startTime, std::chrono::high_resolution_clock::now());
       g_log.information() << "Used Multiprocess ParallelEventLoader.\n";
       loaded = true;
       shortest_tof = 0.0;
@@ -1232,7 +1313,8 @@ void LoadEventNexus::loadEvents(API::Progress *const prog, const bool monitors)
   }
 
   // Info reporting
-  const std::size_t eventsLoaded = m_ws->getNumberEvents();
+  const std::size_t eventsLoaded =
+      histogramAccumulator ? histogramAccumulator->numberOfEvents() : m_ws->getNumberEvents();
   g_log.information() << "Read " << eventsLoaded << " events"
                       << ". Shortest TOF: " << shortest_tof << " microsec; longest TOF: " << longest_tof
                       << " microsec.\n";
@@ -1252,7 +1334,8 @@ void LoadEventNexus::loadEvents(API::Progress *const prog, const bool monitors)
     if (!instrumentT0.empty()) {
       const double mT0 = instrumentT0.front();
       if (mT0 != 0.0) {
-        auto numHistograms = static_cast<int64_t>(m_ws->getNumberHistograms());
+        // histograms already had the offset applied while binning
+        auto numHistograms = histogramAccumulator ? 0 : static_cast<int64_t>(m_ws->getNumberHistograms());
         PARALLEL_FOR_IF(Kernel::threadSafe(*m_ws))
         for (int64_t i = 0; i < numHistograms; ++i) {
           PARALLEL_START_INTERRUPT_REGION
@@ -1304,6 +1387,77 @@ void LoadEventNexus::loadEvents(API::Progress *const prog, const bool monitors)
   }
 }
 
+//-----------------------------------------------------------------------------
+/** Prepare to histogram the events while they are loaded instead of keeping
+ * them. The instrument T0 offset is applied during binning and paused pulses
+ * are excluded along with the bad pulses, as neither can be filtered out of a
+ * histogram afterwards.
+ * @param descriptor :: descriptor of the file being loaded
+ * @param haveWeights :: whether the events in the file are weighted
+ */
+void LoadEventNexus::setupHistogramOnLoad(const Kernel::NexusHDF5Descriptor &descriptor, const bool haveWeights) {
+  if (m_ws->nPeriods() > 1)
+    throw std::invalid_argument("HistogramBinning cannot be used with multi-period data");
+  if (descriptor.isEntry("/" + m_top_entry_name + "/detector_1_events"))
+    throw std::invalid_argument("HistogramBinning cannot be used with ISIS event files, whose time-of-flight "
+                                "is spread within the time channels after loading");
+
+  double tofOffset{0.};
+  if (m_ws->getInstrument()->hasParameter("T0")) {
+    const std::vector<double> instrumentT0 = m_ws->getInstrument()->getNumberParameter("T0", true);
+    if (!instrumentT0.empty())
+      tofOffset = instrumentT0.front();
+  }
+
+  // Paused pulses are only skipped while binning. The TimeROI of the run is
+  // set after loading, as filterDuringPause() does for events.
+  if (auto running = runningTimeROI(m_ws->run(), nullptr)) {
+    g_log.notice("Excluding the pulses when the run was marked as paused. "
+                 "Set the loadeventnexus.keeppausedevents configuration "
+                 "property to override this.");
+    pause_timeroi = std::make_shared<TimeROI>(std::move(*running));
+  }
+
+  const size_t numHistograms = m_ws->getNumberHistograms();
+  std::vector<double> xFactors(numHistograms, 1.);
+  if (getPropertyValue("HistogramUnits") == "dSpacing") {
+    const auto &spectrumInfo = m_ws->getSingleHeldWorkspace()->spectrumInfo();
+    for (size_t i = 0; i < numHistograms; ++i) {
+      if (spectrumInfo.hasDetectors(i) && !spectrumInfo.isMonitor(i))
+        xFactors[i] = 1. / spectrumInfo.difcUncalibrated(i);
+      else
+        xFactors[i] = 0.;
+    }
+  }
+
+  std::vector<double> binEdges;
+  VectorHelper::createAxisFromRebinParams(getProperty("HistogramBinning"), binEdges);
+  histogramAccumulator =
+      std::make_unique<EventHistogramAccumulator>(std::move(binEdges), std::move(xFactors), tofOffset, haveWeights);
+}
+
+//-----------------------------------------------------------------------------
+/** Create the output workspace when the events were histogrammed while
+ * loading. The metadata, instrument and spectra come from the (empty) event
+ * workspace.
+ * @return the histogrammed data
+ */
+MatrixWorkspace_sptr LoadEventNexus::createHistogramWorkspace() {
+  const auto eventWS = m_ws->getSingleHeldWorkspace();
+  MatrixWorkspace_sptr outWS =
+      DataObjects::create<Workspace2D>(*eventWS, HistogramData::BinEdges(histogramAccumulator->binEdges()));
+  histogramAccumulator->moveInto(*outWS);
+  histogramAccumulator.reset();
+  if (pause_timeroi) {
+    // as FilterByLogValue filtering in place, which leaves the logs untouched
+    if (const auto running = runningTimeROI(outWS->run(), &outWS->run().getTimeROI()))
+      outWS->mutableRun().setTimeROI(*running);
+  }
+  outWS->getAxis(0)->setUnit(getPropertyValue("HistogramUnits"));
+  outWS->setYUnit("Counts");
+  return outWS;
+}
+
 //-----------------------------------------------------------------------------
 /** Load the instrument from the nexus file
  *
@@ -1704,27 +1858,43 @@ void LoadEventNexus::safeOpenFile(const std::string &fname) {
   }
 }
 
-/// The parallel loader currently has no support for a series of special
-/// cases, as indicated by the return value of this method.
+/// The multiprocess loader currently has no support for a series of special
+/// cases, as indicated by the return value of this method. If one of them
+/// applies the reason is logged and the default loader is used.
 LoadEventNexus::LoaderType LoadEventNexus::defineLoaderType(const bool haveWeights, const bool oldNeXusFileNames,
                                                             const std::string &classType) const {
   auto propVal = getPropertyValue("LoadType");
   if (propVal == "Default")
     return LoaderType::DEFAULT;
 
-  bool noParallelConstrictions = true;
-  noParallelConstrictions &= !(m_ws->nPeriods() != 1);
-  noParallelConstrictions &= !haveWeights;
-  noParallelConstrictions &= !oldNeXusFileNames;
-  noParallelConstrictions &= !(filter_tof_range);
-  noParallelConstrictions &= !((filter_time_start != Types::Core::DateAndTime::minimum() ||
-                                filter_time_stop != Types::Core::DateAndTime::maximum()));
-  noParallelConstrictions &= !((!isDefault(PropertyNames::COMPRESS_TOL) || !isDefault("SpectrumMin") ||
-                                !isDefault("SpectrumMax") || !isDefault("SpectrumList") || !isDefault("ChunkNumber")));
-  noParallelConstrictions &= !(classType != "NXevent_data");
-
-  if (!noParallelConstrictions)
+  std::vector<std::string> unsupported;
+  if (m_ws->nPeriods() != 1)
+    unsupported.emplace_back("multi-period data");
+  if (haveWeights)
+    unsupported.emplace_back("weighted events");
+  if (oldNeXusFileNames)
+    unsupported.emplace_back("old NeXus field names");
+  if (classType != "NXevent_data")
+    unsupported.emplace_back(classType + " entries");
+  if (filter_tof_range)
+    unsupported.emplace_back("filtering by time-of-flight");
+  if (filter_time_start != Types::Core::DateAndTime::minimum() ||
+      filter_time_stop != Types::Core::DateAndTime::maximum())
+    unsupported.emplace_back("filtering by time");
+  if (filter_bad_pulses)
+    unsupported.emplace_back("filtering bad pulses");
+  if (!isDefault(PropertyNames::COMPRESS_TOL))
+    unsupported.emplace_back("compressing events");
+  if (!isDefault("SpectrumMin") || !isDefault("SpectrumMax") || !isDefault("SpectrumList"))
+    unsupported.emplace_back("selecting spectra");
+  if (!isDefault("ChunkNumber"))
+    unsupported.emplace_back("loading in chunks");
+
+  if (!unsupported.empty()) {
+    g_log.notice() << "The multiprocess loader does not support "
+                   << Strings::join(unsupported.cbegin(), unsupported.cend(), ", ") << ". Using the default loader.\n";
     return LoaderType::DEFAULT;
+  }
   return LoaderType::MULTIPROCESS;
 }
 } // namespace Mantid::DataHandling
@@ -40,34 +40,52 @@ ProcessBankData::ProcessBankData(DefaultEventLoader &m_loader, const std::string
 }
 
 /*
- * Pre-counting the events per pixel ID allows for allocating the proper amount of memory in each output event vector
+ * Pre-counting the events per period and pixel ID allows for allocating the proper amount of memory in each output
+ * event vector. Only the events that will be kept, i.e. those in the pulses being loaded and inside the
+ * time-of-flight range, are counted so that the reservation is exact.
+ * @param pulseIndexer :: the pulses that will be loaded
  */
-void ProcessBankData::preCountAndReserveMem() {
-  // ---- Pre-counting events per pixel ID ----
-  std::vector<size_t> counts(m_max_detid - m_min_detid + 1, 0);
-  for (size_t i = 0; i < numEvents; i++) {
-    const auto thisId = static_cast<detid_t>((*event_detid)[i]);
-    if (!(thisId < m_min_detid || thisId > m_max_detid)) // or allows for skipping out early
-      counts[thisId - m_min_detid]++;
+void ProcessBankData::preCountAndReserveMem(const PulseIndexer &pulseIndexer) {
+  const auto *alg = m_loader.alg;
+  const double TOF_MIN = alg->filter_tof_min;
+  const double TOF_MAX = alg->filter_tof_max;
+  const bool NO_TOF_FILTERING = !(alg->filter_tof_range);
+
+  // ---- Pre-counting events per period and pixel ID ----
+  auto &outputWS = m_loader.m_ws;
+  const size_t numPeriods = outputWS.nPeriods();
+  const auto numDetIds = static_cast<size_t>(m_max_detid - m_min_detid + 1);
+  std::vector<size_t> counts(numPeriods * numDetIds, 0);
+  for (const auto &pulseIter : pulseIndexer) {
+    const auto periodIndex = static_cast<size_t>(thisBankPulseTimes->periodNumber(pulseIter.pulseIndex) - 1);
+    auto *periodCounts = counts.data() + periodIndex * numDetIds;
+    for (std::size_t eventIndex = pulseIter.eventIndexStart; eventIndex < pulseIter.eventIndexStop; ++eventIndex) {
+      const auto thisId = static_cast<detid_t>((*event_detid)[eventIndex]);
+      if (thisId < m_min_detid || thisId > m_max_detid) // or allows for skipping out early
+        continue;
+      const auto tof = static_cast<double>((*event_time_of_flight)[eventIndex]);
+      if ((NO_TOF_FILTERING) || ((tof - TOF_MIN) * (tof - TOF_MAX) <= 0.))
+        periodCounts[thisId - m_min_detid]++;
+    }
   }
 
   // Now we pre-allocate (reserve) the vectors of events in each pixel
   // counted
-  auto &outputWS = m_loader.m_ws;
-  const auto *alg = m_loader.alg;
   const size_t numEventLists = outputWS.getNumberHistograms();
   for (detid_t pixID = m_min_detid; pixID <= m_max_detid; ++pixID) {
-    const auto pixelIndex = pixID - m_min_detid; // index from zero
-    if (counts[pixelIndex] > 0) {
-      const size_t wi = getWorkspaceIndexFromPixelID(pixID);
-      // Find the workspace index corresponding to that pixel ID
-      // Allocate it
-      if (wi < numEventLists) {
-        outputWS.reserveEventListAt(wi, counts[pixelIndex]);
-      }
-      if ((wi % 20 == 0) && alg->getCancel())
-        return; // User cancellation
+    const auto pixelIndex = static_cast<size_t>(pixID - m_min_detid); // index from zero
+    // Find the workspace index corresponding to that pixel ID
+    const size_t wi = getWorkspaceIndexFromPixelID(pixID);
+    if (wi >= numEventLists)
+      continue;
+    // Allocate it
+    for (size_t periodIndex = 0; periodIndex < numPeriods; ++periodIndex) {
+      const auto count = counts[periodIndex * numDetIds + pixelIndex];
+      if (count > 0)
+        outputWS.reserveEventListAt(wi, periodIndex, count);
     }
+    if ((wi % 20 == 0) && alg->getCancel())
+      return; // User cancellation
   }
 }
 
@@ -85,21 +103,10 @@ void ProcessBankData::run() {
   size_t badTofs = 0;
   size_t my_discarded_events(0);
 
-  prog->report(entry_name + ": precount");
-  // ---- Pre-counting events per pixel ID ----
-  if (m_loader.precount) {
-    this->preCountAndReserveMem();
-    if (m_loader.alg->getCancel())
-      return; // User cancellation
-  }
-
   // this assumes that pulse indices are sorted
   if (!std::is_sorted(event_index->cbegin(), event_index->cend()))
     throw std::runtime_error("Event index is not sorted");
 
-  // And there are this many pulses
-  prog->report(entry_name + ": filling events");
-
   auto *alg = m_loader.alg;
 
   // Will we need to compress?
@@ -125,6 +132,17 @@ void ProcessBankData::run() {
 
   const PulseIndexer pulseIndexer(event_index, startAt, numEvents, entry_name, pulseROI);
 
+  prog->report(entry_name + ": precount");
+  // ---- Pre-counting events per pixel ID ----
+  if (m_loader.precount) {
+    this->preCountAndReserveMem(pulseIndexer);
+    if (alg->getCancel())
+      return; // User cancellation
+  }
+
+  // And there are this many pulses
+  prog->report(entry_name + ": filling events");
+
   // loop over all pulses
   for (const auto &pulseIter : pulseIndexer) {
     // Save the pulse time at this index for creating those events
@@ -0,0 +1,144 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataHandling/ProcessBankHistogram.h"
+#include "MantidDataHandling/DefaultEventLoader.h"
+#include "MantidDataHandling/EventHistogramAccumulator.h"
+#include "MantidDataHandling/LoadEventNexus.h"
+#include "MantidDataHandling/PulseIndexer.h"
+#include "MantidKernel/Timer.h"
+
+namespace Mantid::DataHandling {
+
+namespace {
+/// Number of binned events gathered before they are added to the shared histograms
+constexpr size_t CONTRIBUTIONS_PER_BLOCK{65536};
+} // namespace
+
+ProcessBankHistogram::ProcessBankHistogram(DefaultEventLoader &loader, const std::string &entry_name,
+                                           API::Progress *prog, std::shared_ptr<std::vector<uint32_t>> event_id,
+                                           std::shared_ptr<std::vector<float>> event_time_of_flight, size_t numEvents,
+                                           size_t startAt, std::shared_ptr<std::vector<uint64_t>> event_index,
+                                           std::shared_ptr<BankPulseTimes> thisBankPulseTimes,
+                                           std::shared_ptr<std::vector<float>> event_weight, detid_t min_event_id,
+                                           detid_t max_event_id)
+    : Task(), m_loader(loader), m_entry_name(entry_name), m_prog(prog), m_event_id(std::move(event_id)),
+      m_event_tof(std::move(event_time_of_flight)), m_numEvents(numEvents), m_startAt(startAt),
+      m_event_index(std::move(event_index)), m_bankPulseTimes(std::move(thisBankPulseTimes)),
+      m_event_weight(std::move(event_weight)), m_min_id(min_event_id), m_max_id(max_event_id) {
+  // Cost is approximately proportional to the number of events to process.
+  m_cost = static_cast<double>(numEvents);
+
+  if (m_max_id < m_min_id) {
+    std::stringstream msg;
+    msg << "max detid (" << m_max_id << ") < min (" << m_min_id << ")";
+    throw std::runtime_error(msg.str());
+  }
+}
+
+/** Run the data processing
+ */
+void ProcessBankHistogram::run() {
+  Mantid::Kernel::Timer timer;
+  auto *alg = m_loader.alg;
+  auto &histograms = *alg->histogramAccumulator;
+  m_prog->report(m_entry_name + ": setting up histogramming");
+
+  // this assumes that pulse indices are sorted
+  if (!std::is_sorted(m_event_index->cbegin(), m_event_index->cend()))
+    throw std::runtime_error("Event index is not sorted");
+
+  const double TOF_MIN = alg->filter_tof_min;
+  const double TOF_MAX = alg->filter_tof_max;
+  const bool NO_TOF_FILTERING = !(alg->filter_tof_range);
+
+  // set up wall-clock filtering if it was requested
+  std::vector<size_t> pulseROI;
+  if (alg->m_is_time_filtered) {
+    pulseROI = m_bankPulseTimes->getPulseIndices(alg->filter_time_start, alg->filter_time_stop);
+  }
+
+  if (alg->filter_bad_pulses) {
+    pulseROI = Mantid::Kernel::ROI::calculate_intersection(
+        pulseROI, m_bankPulseTimes->getPulseIndices(alg->bad_pulses_timeroi->toTimeIntervals()));
+  }
+
+  if (alg->pause_timeroi) {
+    pulseROI = Mantid::Kernel::ROI::calculate_intersection(
+        pulseROI, m_bankPulseTimes->getPulseIndices(alg->pause_timeroi->toTimeIntervals()));
+  }
+
+  const PulseIndexer pulseIndexer(m_event_index, m_startAt, m_numEvents, m_entry_name, pulseROI);
+
+  m_prog->report(m_entry_name + ": histogramming events");
+
+  const auto &eventId_to_wi = m_loader.eventId_to_wi_vector;
+  const size_t numSpectra = histograms.numberOfSpectra();
+  double my_shortest_tof = static_cast<double>(std::numeric_limits<uint32_t>::max()) * 0.1;
+  double my_longest_tof = 0.;
+  size_t badTofs = 0;
+  size_t my_discarded_events(0);
+
+  std::vector<EventHistogramAccumulator::Contribution> contributions;
+  contributions.reserve(CONTRIBUTIONS_PER_BLOCK);
+  for (const auto &pulseIter : pulseIndexer) {
+    for (std::size_t eventIndex = pulseIter.eventIndexStart; eventIndex < pulseIter.eventIndexStop; ++eventIndex) {
+      const auto eventId = static_cast<detid_t>((*m_event_id)[eventIndex]);
+      if (eventId < m_min_id || eventId > m_max_id)
+        continue;
+      const auto tof = static_cast<double>((*m_event_tof)[eventIndex]);
+      // this is fancy for check if value is in range
+      if (!((NO_TOF_FILTERING) || ((tof - TOF_MIN) * (tof - TOF_MAX) <= 0.)))
+        continue;
+
+      const auto lookup = static_cast<int64_t>(eventId) + m_loader.eventId_to_wi_offset;
+      const size_t wi = (lookup >= 0 && lookup < static_cast<int64_t>(eventId_to_wi.size()))
+                            ? eventId_to_wi[static_cast<size_t>(lookup)]
+                            : numSpectra;
+      if (wi >= numSpectra) {
+        ++my_discarded_events;
+        continue;
+      }
+
+      // tof limits from things observed here
+      if (tof < 2e8) {
+        my_longest_tof = std::max(my_longest_tof, tof);
+        my_shortest_tof = std::min(my_shortest_tof, tof);
+      } else {
+        badTofs++;
+      }
+
+      size_t bin;
+      if (!histograms.findBin(wi, tof, bin))
+        continue;
+      const double weight = m_event_weight ? static_cast<double>((*m_event_weight)[eventIndex]) : 1.;
+      contributions.push_back({wi, bin, weight});
+      if (contributions.size() == CONTRIBUTIONS_PER_BLOCK)
+        histograms.addEvents(contributions);
+    }
+    // check if cancelled after each 100s of pulses (assumes 60Hz)
+    if ((pulseIter.pulseIndex % 6000 == 0) && alg->getCancel())
+      return;
+  }
+  histograms.addEvents(contributions);
+  m_prog->report(m_entry_name + ": histogrammed events");
+
+  // Join back up the tof limits to the global ones
+  {
+    std::lock_guard<std::mutex> _lock(alg->m_tofMutex);
+    alg->shortest_tof = std::min(alg->shortest_tof, my_shortest_tof);
+    alg->longest_tof = std::max(alg->longest_tof, my_longest_tof);
+    alg->bad_tofs += badTofs;
+    alg->discarded_events += my_discarded_events;
+  }
+
+#ifndef _WIN32
+  if (alg->getLogger().isDebug())
+    alg->getLogger().debug() << "Time to ProcessBankHistogram " << m_entry_name << " " << timer << "\n";
+#endif
+}
+
+} // namespace Mantid::DataHandling
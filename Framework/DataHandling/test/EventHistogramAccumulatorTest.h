@@ -0,0 +1,130 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataHandling/EventHistogramAccumulator.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
+
+using Mantid::DataHandling::EventHistogramAccumulator;
+using Contributions = std::vector<EventHistogramAccumulator::Contribution>;
+
+class EventHistogramAccumulatorTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventHistogramAccumulatorTest *createSuite() { return new EventHistogramAccumulatorTest(); }
+  static void destroySuite(EventHistogramAccumulatorTest *suite) { delete suite; }
+
+  void test_bad_bin_edges_throw() {
+    TS_ASSERT_THROWS(EventHistogramAccumulator({1.}, {1.}, 0., false), const std::invalid_argument &);
+    TS_ASSERT_THROWS(EventHistogramAccumulator({1., 3., 2.}, {1.}, 0., false), const std::invalid_argument &);
+  }
+
+  void test_findBin_linear() {
+    EventHistogramAccumulator accumulator({0., 10., 20., 30.}, {1., 2.}, 0., false);
+    TS_ASSERT_EQUALS(accumulator.numberOfSpectra(), 2);
+    TS_ASSERT_EQUALS(accumulator.numberOfBins(), 3);
+
+    size_t bin = 99;
+    TS_ASSERT(accumulator.findBin(0, 0., bin));
+    TS_ASSERT_EQUALS(bin, 0);
+    TS_ASSERT(accumulator.findBin(0, 10., bin));
+    TS_ASSERT_EQUALS(bin, 1);
+    TS_ASSERT(accumulator.findBin(0, 29.9, bin));
+    TS_ASSERT_EQUALS(bin, 2);
+    // the upper edge is exclusive
+    TS_ASSERT(!accumulator.findBin(0, 30., bin));
+    TS_ASSERT(!accumulator.findBin(0, -1., bin));
+    // the second spectrum doubles the time-of-flight
+    TS_ASSERT(accumulator.findBin(1, 10., bin));
+    TS_ASSERT_EQUALS(bin, 2);
+    TS_ASSERT(!accumulator.findBin(1, 15., bin));
+  }
+
+  void test_findBin_logarithmic() {
+    EventHistogramAccumulator accumulator({1., 2., 4., 8., 16.}, {1.}, 0., false);
+    size_t bin = 99;
+    TS_ASSERT(accumulator.findBin(0, 1.5, bin));
+    TS_ASSERT_EQUALS(bin, 0);
+    TS_ASSERT(accumulator.findBin(0, 4., bin));
+    TS_ASSERT_EQUALS(bin, 2);
+    TS_ASSERT(accumulator.findBin(0, 15., bin));
+    TS_ASSERT_EQUALS(bin, 3);
+    TS_ASSERT(!accumulator.findBin(0, 0.5, bin));
+  }
+
+  void test_findBin_offset_and_skipped_spectrum() {
+    EventHistogramAccumulator accumulator({0., 10., 20.}, {1., 0.}, 5., false);
+    size_t bin = 99;
+    TS_ASSERT(accumulator.findBin(0, 6., bin));
+    TS_ASSERT_EQUALS(bin, 1);
+    // events in spectra with a factor of zero are never binned, even if the binning includes zero
+    TS_ASSERT(!accumulator.findBin(1, 6., bin));
+  }
+
+  void test_unweighted_events() {
+    EventHistogramAccumulator accumulator({0., 1., 2.}, {1., 1., 1.}, 0., false);
+    Contributions contributions{{0, 0, 1.}, {0, 0, 1.}, {2, 1, 1.}};
+    accumulator.addEvents(contributions);
+    TS_ASSERT(contributions.empty());
+    contributions = {{2, 1, 1.}};
+    accumulator.addEvents(contributions);
+    TS_ASSERT_EQUALS(accumulator.numberOfEvents(), 4);
+
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(3, 2);
+    accumulator.moveInto(*ws);
+    TS_ASSERT_EQUALS(ws->y(0)[0], 2.);
+    TS_ASSERT_EQUALS(ws->y(0)[1], 0.);
+    TS_ASSERT_EQUALS(ws->y(1)[0], 0.);
+    TS_ASSERT_EQUALS(ws->y(1)[1], 0.);
+    TS_ASSERT_EQUALS(ws->y(2)[1], 2.);
+    TS_ASSERT_DELTA(ws->e(0)[0], std::sqrt(2.), 1e-12);
+    TS_ASSERT_DELTA(ws->e(2)[1], std::sqrt(2.), 1e-12);
+    TS_ASSERT_EQUALS(ws->e(1)[0], 0.);
+  }
+
+  void test_weighted_events() {
+    EventHistogramAccumulator accumulator({0., 1., 2.}, {1.}, 0., true);
+    Contributions contributions{{0, 1, 2.}, {0, 1, 3.}};
+    accumulator.addEvents(contributions);
+
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(1, 2);
+    accumulator.moveInto(*ws);
+    TS_ASSERT_EQUALS(ws->y(0)[0], 0.);
+    TS_ASSERT_EQUALS(ws->y(0)[1], 5.);
+    TS_ASSERT_EQUALS(ws->e(0)[0], 0.);
+    TS_ASSERT_DELTA(ws->e(0)[1], std::sqrt(13.), 1e-12);
+  }
+
+  void test_events_spread_over_many_locks() {
+    const size_t numSpectra = 5000;
+    EventHistogramAccumulator accumulator({0., 1.}, std::vector<double>(numSpectra, 1.), 0., false);
+    Contributions contributions;
+    for (size_t wi = numSpectra; wi > 0; --wi)
+      for (size_t i = 0; i < wi % 3; ++i)
+        contributions.push_back({wi - 1, 0, 1.});
+    const size_t numEvents = contributions.size();
+    accumulator.addEvents(contributions);
+    TS_ASSERT_EQUALS(accumulator.numberOfEvents(), numEvents);
+
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(numSpectra, 1);
+    accumulator.moveInto(*ws);
+    for (size_t wi = 0; wi < numSpectra; ++wi)
+      TS_ASSERT_EQUALS(ws->y(wi)[0], static_cast<double>((wi + 1) % 3));
+  }
+
+  void test_moveInto_wrong_shape_throws() {
+    EventHistogramAccumulator accumulator({0., 1., 2.}, {1., 1.}, 0., false);
+    auto tooFewSpectra = WorkspaceCreationHelper::create2DWorkspaceBinned(1, 2);
+    TS_ASSERT_THROWS(accumulator.moveInto(*tooFewSpectra), const std::invalid_argument &);
+    auto tooManyBins = WorkspaceCreationHelper::create2DWorkspaceBinned(2, 3);
+    TS_ASSERT_THROWS(accumulator.moveInto(*tooManyBins), const std::invalid_argument &);
+  }
+};
@@ -151,4 +151,51 @@ public:
       TS_ASSERT_EQUALS(eventWS->sample().getThickness(), thickness);
     }
   }
+
+  void test_reserveEventListAt_single_period() {
+    EventWorkspaceCollection collection;
+    auto periodLog = std::make_unique<const TimeSeriesProperty<int>>("period_log");
+    collection.setNPeriods(2, periodLog);
+    collection.setIndexInfo(Indexing::IndexInfo({1, 2}));
+
+    collection.reserveEventListAt(1, 1, 100);
+    const auto ws = std::dynamic_pointer_cast<WorkspaceGroup>(collection.combinedWorkspace());
+    const auto period1 = std::dynamic_pointer_cast<EventWorkspace>(ws->getItem(0));
+    const auto period2 = std::dynamic_pointer_cast<EventWorkspace>(ws->getItem(1));
+    TSM_ASSERT_EQUALS("Other periods should not be reserved", period1->getSpectrum(1).getMemorySize(),
+                      period2->getSpectrum(0).getMemorySize());
+    TS_ASSERT_EQUALS(period2->getSpectrum(1).getMemorySize() - period2->getSpectrum(0).getMemorySize(),
+                     100 * sizeof(Types::Event::TofEvent));
+  }
+
+  void test_reserveEventListAt_grows_geometrically_over_slabs() {
+    EventWorkspaceCollection collection;
+    auto periodLog = std::make_unique<const TimeSeriesProperty<int>>("period_log");
+    collection.setNPeriods(1, periodLog);
+    collection.setIndexInfo(Indexing::IndexInfo({1, 2}));
+    auto &eventList = collection.getSingleHeldWorkspace()->getSpectrum(0);
+
+    // fill the list as the loader does with the slabs of a bank
+    const size_t numSlabs = 64;
+    const size_t eventsPerSlab = 1000;
+    size_t reallocations = 0;
+    const Types::Event::TofEvent *storage = nullptr;
+    for (size_t slab = 0; slab < numSlabs; ++slab) {
+      collection.reserveEventListAt(0, 0, eventsPerSlab);
+      if (eventList.getEvents().data() != storage) {
+        storage = eventList.getEvents().data();
+        ++reallocations;
+      }
+      for (size_t i = 0; i < eventsPerSlab; ++i)
+        eventList.addEventQuickly(Types::Event::TofEvent(static_cast<double>(slab * eventsPerSlab + i)));
+    }
+
+    const size_t numEvents = numSlabs * eventsPerSlab;
+    const auto &events = eventList.getEvents();
+    TS_ASSERT_EQUALS(events.size(), numEvents);
+    for (size_t i = 0; i < numEvents; ++i)
+      TS_ASSERT_EQUALS(events[i].tof(), static_cast<double>(i));
+    TS_ASSERT_LESS_THAN_EQUALS(reallocations, 7);
+    TS_ASSERT_LESS_THAN_EQUALS(events.capacity(), 2 * events.size());
+  }
 };
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/Axis.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/Run.h"
@@ -20,6 +21,7 @@
 #include "MantidIndexing/SpectrumNumber.h"
 #include "MantidKernel/Property.h"
 #include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidKernel/Unit.h"
 #include "MantidNexusGeometry/Hdf5Version.h"
 
 #include "Poco/Path.h"
@@ -38,7 +40,7 @@ void run_multiprocess_load(const std::string &file, bool precount) {
   Mantid::API::FrameworkManager::Instance();
   LoadEventNexus ld;
   ld.initialize();
-  ld.setPropertyValue("Loadtype", "Multiprocess (experimental)");
+  ld.setPropertyValue("Loadtype", "Multiprocess");
   std::string outws_name = "multiprocess";
   ld.setPropertyValue("Filename", file);
   ld.setPropertyValue("OutputWorkspace", outws_name);
@@ -344,6 +346,47 @@ public:
     TS_ASSERT_EQUALS(eventWS->indexInfo().spectrumNumber(2), 3);
   }
 
+  void test_load_in_slabs_matches_single_read() {
+    const std::string file = "SANS2D_ESS_example.nxs";
+    const std::string bufferKey = "loadeventnexus.readbuffer.size";
+    const bool hasBufferSize = ConfigService::Instance().hasProperty(bufferKey);
+    const auto origBufferSize = ConfigService::Instance().getString(bufferKey);
+
+    auto loadWithBufferSize = [&](const std::string &bufferSize) {
+      ConfigService::Instance().setString(bufferKey, bufferSize);
+      LoadEventNexus alg;
+      alg.setChild(true);
+      alg.setRethrows(true);
+      alg.initialize();
+      alg.setProperty("Filename", file);
+      alg.setProperty("OutputWorkspace", "dummy_for_child");
+      alg.setProperty("NumberOfBins", 1);
+      alg.execute();
+      Workspace_sptr ws = alg.getProperty("OutputWorkspace");
+      return std::dynamic_pointer_cast<EventWorkspace>(ws);
+    };
+    // 0 reads each bank at once, 1 MB splits the detector banks in many slabs
+    const auto singleRead = loadWithBufferSize("0");
+    const auto slabs = loadWithBufferSize("1");
+    if (hasBufferSize)
+      ConfigService::Instance().setString(bufferKey, origBufferSize);
+    else
+      ConfigService::Instance().remove(bufferKey);
+
+    TS_ASSERT(singleRead);
+    TS_ASSERT(slabs);
+    TS_ASSERT_EQUALS(slabs->getNumberEvents(), 14258850);
+    TS_ASSERT_EQUALS(slabs->getNumberEvents(), singleRead->getNumberEvents());
+    TS_ASSERT_EQUALS(slabs->getNumberHistograms(), singleRead->getNumberHistograms());
+    size_t mismatched = 0;
+    for (size_t i = 0; i < singleRead->getNumberHistograms(); ++i) {
+      // the events of each spectrum keep the order of the file
+      if (slabs->getSpectrum(i).getTofs() != singleRead->getSpectrum(i).getTofs())
+        ++mismatched;
+    }
+    TS_ASSERT_EQUALS(mismatched, 0);
+  }
+
 #ifdef _WIN32
   bool windows = true;
 #else
@@ -363,6 +406,14 @@ public:
     }
   }
 
+  void test_multiprocess_loader_old_name_is_accepted() {
+    if (!windows) {
+      LoadEventNexus ld;
+      ld.initialize();
+      TS_ASSERT_THROWS_NOTHING(ld.setPropertyValue("LoadType", "Multiprocess (experimental)"));
+    }
+  }
+
   void test_SingleBank_PixelsOnlyInThatBank() { doTestSingleBank(true, false); }
 
   void test_load_event_nexus_ornl_eqsans() {
@@ -989,6 +1040,41 @@ public:
     AnalysisDataService::Instance().remove(compressed_name);
   }
 
+  void test_Load_And_CompressPulseTimes() {
+    Mantid::API::FrameworkManager::Instance();
+
+    std::vector<EventWorkspace_sptr> workspaces;
+    for (const bool compressPulseTimes : {false, true}) {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setChild(true);
+      ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+      ld.setPropertyValue("OutputWorkspace", "unused");
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      ld.setProperty<bool>("CompressPulseTimes", compressPulseTimes);
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+      Workspace_sptr output = ld.getProperty("OutputWorkspace");
+      workspaces.emplace_back(std::dynamic_pointer_cast<EventWorkspace>(output));
+      TS_ASSERT(workspaces.back());
+    }
+    const auto &uncompressed = *workspaces[0];
+    const auto &compressed = *workspaces[1];
+
+    TS_ASSERT_EQUALS(compressed.getNumberEvents(), uncompressed.getNumberEvents());
+    TS_ASSERT_EQUALS(compressed.getPulseTimeMin(), uncompressed.getPulseTimeMin());
+    TS_ASSERT_EQUALS(compressed.getPulseTimeMax(), uncompressed.getPulseTimeMax());
+    TS_ASSERT_LESS_THAN(compressed.getMemorySize(), uncompressed.getMemorySize());
+    for (size_t wi = 0; wi < uncompressed.getNumberHistograms(); wi += 97) {
+      const auto &eventList = compressed.getSpectrum(wi);
+      if (eventList.empty())
+        continue;
+      TS_ASSERT(eventList.hasCompressedPulseTimes());
+      TS_ASSERT_EQUALS(eventList.getPulseTimes(), uncompressed.getSpectrum(wi).getPulseTimes());
+      TS_ASSERT_EQUALS(eventList.getTofs(), uncompressed.getSpectrum(wi).getTofs());
+    }
+  }
+
   void test_Load_And_CompressEvents_with_nperiod_data() {
     constexpr std::size_t NUM_HIST{40960};
     const std::string filename{"LARMOR00003368.nxs"};
@@ -1737,7 +1823,96 @@ public:
     AnalysisDataService::Instance().remove(wsname);
   }
 
+  void test_histogram_on_load_matches_load_and_rebin() {
+    const std::string binning{"40000,500,70000"};
+    auto histogrammed = loadCNCSHistogrammed(binning, "TOF");
+    auto expected = rebinToWorkspace2D(loadCNCSChild(), binning);
+
+    TS_ASSERT_EQUALS(histogrammed->getAxis(0)->unit()->unitID(), "TOF");
+    compareHistogrammed(histogrammed, expected, 0.);
+  }
+
+  void test_histogram_on_load_in_dSpacing_matches_convert_units_and_rebin() {
+    const std::string binning{"0,0.25,20"};
+    auto histogrammed = loadCNCSHistogrammed(binning, "dSpacing");
+
+    auto convert = AlgorithmManager::Instance().createUnmanaged("ConvertUnits");
+    convert->initialize();
+    convert->setChild(true);
+    convert->setProperty("InputWorkspace", loadCNCSChild());
+    convert->setProperty("Target", "dSpacing");
+    convert->setPropertyValue("OutputWorkspace", "unused");
+    convert->execute();
+    TS_ASSERT(convert->isExecuted());
+    MatrixWorkspace_sptr converted = convert->getProperty("OutputWorkspace");
+    auto expected = rebinToWorkspace2D(converted, binning);
+
+    TS_ASSERT_EQUALS(histogrammed->getAxis(0)->unit()->unitID(), "dSpacing");
+    // d-spacing is computed with a different operation order, so an event on a bin edge may change bin
+    compareHistogrammed(histogrammed, expected, 1e-5);
+  }
+
 private:
+  MatrixWorkspace_sptr loadCNCSChild(const std::string &binning = "", const std::string &units = "TOF") {
+    auto load = AlgorithmManager::Instance().createUnmanaged("LoadEventNexus");
+    load->initialize();
+    load->setChild(true);
+    load->setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    load->setPropertyValue("OutputWorkspace", "unused");
+    if (!binning.empty()) {
+      load->setPropertyValue("HistogramBinning", binning);
+      load->setPropertyValue("HistogramUnits", units);
+    }
+    load->execute();
+    TS_ASSERT(load->isExecuted());
+    Workspace_sptr ws = load->getProperty("OutputWorkspace");
+    return std::dynamic_pointer_cast<MatrixWorkspace>(ws);
+  }
+
+  MatrixWorkspace_sptr loadCNCSHistogrammed(const std::string &binning, const std::string &units) {
+    auto ws = loadCNCSChild(binning, units);
+    TS_ASSERT(ws);
+    TS_ASSERT(!std::dynamic_pointer_cast<EventWorkspace>(ws));
+    return ws;
+  }
+
+  MatrixWorkspace_sptr rebinToWorkspace2D(const MatrixWorkspace_sptr &ws, const std::string &binning) {
+    auto rebin = AlgorithmManager::Instance().createUnmanaged("Rebin");
+    rebin->initialize();
+    rebin->setChild(true);
+    rebin->setProperty("InputWorkspace", ws);
+    rebin->setPropertyValue("Params", binning);
+    rebin->setProperty("PreserveEvents", false);
+    rebin->setPropertyValue("OutputWorkspace", "unused");
+    rebin->execute();
+    TS_ASSERT(rebin->isExecuted());
+    return rebin->getProperty("OutputWorkspace");
+  }
+
+  /// Compare Y and E bin by bin, allowing a fraction of all counts to be in a different bin
+  void compareHistogrammed(const MatrixWorkspace_sptr &histogrammed, const MatrixWorkspace_sptr &expected,
+                           const double movedFraction) {
+    TS_ASSERT_EQUALS(histogrammed->getNumberHistograms(), expected->getNumberHistograms());
+    TS_ASSERT_EQUALS(histogrammed->blocksize(), expected->blocksize());
+    // the run is filtered as for the event load, so the proton charge is the same
+    TS_ASSERT_DELTA(histogrammed->run().getProtonCharge(), expected->run().getProtonCharge(), 1e-9);
+
+    double total{0.}, moved{0.}, errorMismatch{0.};
+    for (size_t i = 0; i < expected->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(histogrammed->x(i).rawData(), expected->x(i).rawData());
+      const auto &y = histogrammed->y(i);
+      const auto &yExpected = expected->y(i);
+      for (size_t j = 0; j < yExpected.size(); ++j) {
+        total += yExpected[j];
+        moved += std::abs(y[j] - yExpected[j]);
+        errorMismatch += std::abs(histogrammed->e(i)[j] * histogrammed->e(i)[j] - y[j]);
+      }
+    }
+    TS_ASSERT_LESS_THAN(0., total);
+    TS_ASSERT_DELTA(errorMismatch, 0., 1e-6);
+    TS_ASSERT_LESS_THAN_EQUALS(moved, movedFraction * total);
+  }
+
   std::string wsSpecFilterAndEventMonitors;
 };
 
@@ -1758,7 +1933,7 @@ public:
       loader.initialize();
       loader.setPropertyValue("Filename", "SANS2D00022048.nxs");
       loader.setPropertyValue("OutputWorkspace", "ws");
-      loader.setPropertyValue("Loadtype", "Multiprocess (experimental)");
+      loader.setPropertyValue("Loadtype", "Multiprocess");
       loader.setPropertyValue("Precount", std::to_string(true));
       TS_ASSERT(loader.execute());
     }
@@ -1769,11 +1944,19 @@ public:
       loader.initialize();
       loader.setPropertyValue("Filename", "SANS2D00022048.nxs");
       loader.setPropertyValue("OutputWorkspace", "ws");
-      loader.setPropertyValue("Loadtype", "Multiprocess (experimental)");
+      loader.setPropertyValue("Loadtype", "Multiprocess");
       loader.setPropertyValue("Precount", std::to_string(false));
       TS_ASSERT(loader.execute());
     }
   }
+  // same file as the multiprocess tests, for comparison
+  void testDefaultLoadSANS2D() {
+    LoadEventNexus loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename", "SANS2D00022048.nxs");
+    loader.setPropertyValue("OutputWorkspace", "ws");
+    TS_ASSERT(loader.execute());
+  }
   void testDefaultLoad() {
     LoadEventNexus loader;
     loader.initialize();
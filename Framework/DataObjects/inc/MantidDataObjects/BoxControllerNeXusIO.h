@@ -9,9 +9,13 @@
 #include "MantidAPI/BoxController.h"
 #include "MantidAPI/IBoxControllerIO.h"
 #include "MantidDataObjects/DllConfig.h"
+#include "MantidKernel/AsyncIOQueue.h"
 #include "MantidNexusCpp/NeXusFile.hpp"
 
+#include <deque>
+#include <map>
 #include <mutex>
+#include <variant>
 
 namespace Mantid {
 namespace DataObjects {
@@ -20,6 +24,11 @@ namespace DataObjects {
 /** The class responsible for saving events into nexus file using generic box
   controller interface
   * Expected to provide thread-safe file access.
+  *
+  * File operations are overlapped with computations by a dedicated IO thread
+  * (one per file, as NeXus is not thread safe): saved blocks are written behind
+  * the caller, and blocks announced by prefetchBlock are read ahead into a
+  * bounded buffer, from which the following loadBlock takes them.
 
     @date March 15, 2013
 */
@@ -46,9 +55,30 @@ public:
   void loadBlock(std::vector<double> & /* Block */, const uint64_t /*blockPosition*/,
                  const size_t /*BlockSize*/) const override;
 
+  void prefetchBlock(const uint64_t /*blockPosition*/, const size_t /*BlockSize*/) const override;
+
   void flushData() const override;
+  void flushDataBehind() const override;
   void closeFile() override;
 
+  /// Counters describing the asynchronous IO of this file
+  struct IOStatistics {
+    /// usage of the IO thread queue: depth and the time callers stalled on it
+    Kernel::AsyncIOQueue::Statistics queue;
+    /// number of blocks loaded from the read-ahead buffer
+    uint64_t readAheadHits;
+    /// number of blocks loaded directly from the file
+    uint64_t directReads;
+    /// number of blocks written behind the caller
+    uint64_t writesBehind;
+  };
+  IOStatistics getIOStatistics() const;
+
+  /// Set the number of events the read-ahead buffer may hold; 0 disables read-ahead
+  void setReadAheadBufferSize(const uint64_t nEvents) { m_readAheadSize = nEvents; }
+  /// @return the number of events the read-ahead buffer may hold
+  uint64_t getReadAheadBufferSize() const { return m_readAheadSize; }
+
   ~BoxControllerNeXusIO() override;
   // Auxiliary functions. Used to change default state of this object which is
   // not fully supported. Should be replaced by some IBoxControllerIO factory
@@ -58,7 +88,10 @@ public:
   // Auxiliary functions (non-virtual, used for testing)
   int64_t getNDataColums() const { return m_BlockSize[1]; }
   // get pointer to the Nexus file --> compatribility testing only.
-  ::NeXus::File *getFile() { return m_File.get(); }
+  ::NeXus::File *getFile() {
+    m_ioQueue.wait();
+    return m_File.get();
+  }
 
   /**@brief The version of the "event_data" Nexus dataset
    *
@@ -110,6 +143,8 @@ private:
   /// Default size of the events block which can be written in the NeXus array
   /// at once identified by efficiency or some other external reasons
   enum { DATA_CHUNK = 10000 };
+  /// Default number of events the read-ahead buffer may hold
+  enum { READ_AHEAD_EVENTS = 100 * DATA_CHUNK };
 
   /// full file name (with path) of the Nexis file responsible for the IO
   /// operations (as NeXus filename has very strange properties and often
@@ -134,6 +169,43 @@ private:
   /// lock Nexus file operations as Nexus is not thread safe
   mutable std::mutex m_fileMutex;
 
+  //------ asynchronous IO
+  /// A block read ahead of its use, or the placeholder of one being read
+  struct ReadAheadBlock {
+    /// identifies the prefetch request, so a superseded read is discarded
+    uint64_t id;
+    /// number of events in the block
+    size_t nPoints;
+    /// the ticket of the read in the IO queue; 0 until queued
+    Kernel::AsyncIOQueue::Ticket ticket;
+    /// true when the data has been read successfully
+    bool loaded;
+    std::variant<std::vector<float>, std::vector<double>> data;
+  };
+  /// A write queued on the IO thread and not known to be finished
+  struct PendingWrite {
+    uint64_t position;
+    uint64_t nPoints;
+    Kernel::AsyncIOQueue::Ticket ticket;
+  };
+  /// the IO thread doing the read-ahead and write-behind
+  mutable Kernel::AsyncIOQueue m_ioQueue;
+  /// lock for the read-ahead buffer, the pending writes and the counters
+  mutable std::mutex m_bufferMutex;
+  /// the read-ahead buffer, by the block position in the file
+  mutable std::map<uint64_t, ReadAheadBlock> m_readAhead;
+  /// number of events held or being read into the read-ahead buffer
+  mutable uint64_t m_readAheadUsed;
+  /// maximal number of events in the read-ahead buffer
+  uint64_t m_readAheadSize;
+  /// the id given to the last prefetch request
+  mutable uint64_t m_lastReadAheadId;
+  /// writes which may still be queued, in the order of queueing
+  mutable std::deque<PendingWrite> m_pendingWrites;
+  mutable uint64_t m_readAheadHits;
+  mutable uint64_t m_directReads;
+  mutable uint64_t m_writesBehind;
+
   // Mainly static information which may be split into different IO classes
   // selected through chein of responsibility.
   /// number of bytes in the event coordinates (coord_t length). Set by
@@ -190,6 +262,17 @@ private:
   /// Load generic data block from the opened NeXus file.
   template <typename Type>
   void loadGenericBlock(std::vector<Type> &Block, const uint64_t blockPosition, const size_t nPoints) const;
+  /// Read a data block from the file, converting it to the requested type
+  void readBlock(std::vector<float> &Block, const uint64_t blockPosition, const size_t nPoints) const;
+  void readBlock(std::vector<double> &Block, const uint64_t blockPosition, const size_t nPoints) const;
+
+  template <typename Type> void saveBlockBehind(const std::vector<Type> &DataBlock, const uint64_t blockPosition) const;
+  template <typename Type>
+  void loadBufferedBlock(std::vector<Type> &Block, const uint64_t blockPosition, const size_t nPoints) const;
+  template <typename Type>
+  bool takeReadAhead(std::vector<Type> &Block, const uint64_t blockPosition, const size_t nPoints) const;
+  void dropReadAhead(const uint64_t blockPosition, const uint64_t nPoints) const;
+  void waitForWrites(const uint64_t blockPosition, const uint64_t nPoints) const;
 };
 } // namespace DataObjects
 } // namespace Mantid
@@ -0,0 +1,79 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/Events.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** EventColumns holds the events of a single EventList in structure-of-arrays
+ * (columnar) form. Each event field lives in its own contiguous array so that
+ * passes which only read the time-of-flight (histogramming, unit conversion,
+ * integration of unweighted events) do not drag the pulse times and weights
+ * through the cache.
+ *
+ * Which columns are populated depends on the event type that was stored:
+ *  - TofEvent: tof and pulseTime (weights are implicitly 1)
+ *  - WeightedEvent: tof, pulseTime, weight and errorSquared
+ *  - WeightedEventNoTime: tof, weight and errorSquared
+ *
+ * The pulse times can be compressed with compressPulseTimes(). The 64-bit
+ * pulseTime column is then replaced by a 32-bit index into a sorted table of
+ * pulse times that is shared between all of the lists of a workspace, which
+ * saves a quarter of the memory of a TofEvent.
+ */
+struct MANTID_DATAOBJECTS_DLL EventColumns {
+  /// The time-of-flight (or converted x value) of each event
+  std::vector<double> tof;
+  /// The pulse time of each event in nanoseconds since the epoch
+  std::vector<int64_t> pulseTime;
+  /// The weight of each event
+  std::vector<float> weight;
+  /// The SQUARE of the error of each event
+  std::vector<float> errorSquared;
+  /// Sorted unique pulse times in nanoseconds. Only set when the pulse times are compressed.
+  std::shared_ptr<const std::vector<int64_t>> pulseTable;
+  /// Index into pulseTable of the pulse time of each event. Replaces pulseTime when the pulse times are compressed.
+  std::vector<uint32_t> pulseIndex;
+
+  /// Number of events held
+  std::size_t size() const { return tof.size(); }
+  /// True if there are no events held
+  bool empty() const { return tof.empty(); }
+  /// True if the pulse times are held as indices into pulseTable
+  bool hasCompressedPulseTimes() const { return static_cast<bool>(pulseTable); }
+  /// The pulse time of event i in nanoseconds, wherever it is stored
+  int64_t pulseTimeAt(const std::size_t i) const { return pulseTable ? (*pulseTable)[pulseIndex[i]] : pulseTime[i]; }
+
+  void clear();
+  void shrinkToFit();
+  std::size_t getMemorySize() const;
+
+  void assign(const std::vector<Types::Event::TofEvent> &events);
+  void assign(const std::vector<WeightedEvent> &events);
+  void assign(const std::vector<WeightedEventNoTime> &events);
+
+  void extract(std::vector<Types::Event::TofEvent> &events) const;
+  void extract(std::vector<WeightedEvent> &events) const;
+  void extract(std::vector<WeightedEventNoTime> &events) const;
+
+  void sortByTof();
+  void reverse();
+
+  bool compressPulseTimes(const std::shared_ptr<const std::vector<int64_t>> &table);
+  void filterByPulseTime(const int64_t start, const int64_t stop, EventColumns &output) const;
+  void getPulseTimeMinMax(int64_t &tMin, int64_t &tMax) const;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
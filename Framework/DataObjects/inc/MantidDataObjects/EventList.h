@@ -12,7 +12,11 @@
 #include "MantidKernel/TimeROI.h"
 #include "MantidKernel/cow_ptr.h"
 
+#include <atomic>
 #include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <vector>
 
 namespace Mantid {
@@ -22,10 +26,12 @@ class DateAndTime;
 }
 } // namespace Types
 namespace Kernel {
+struct ClosedFormConversion;
 class Unit;
 } // namespace Kernel
 namespace DataObjects {
 class EventWorkspaceMRU;
+struct EventColumns;
 
 /// How the event list is sorted.
 enum EventSortType {
@@ -98,6 +104,8 @@ public:
   /** Append an event to the histogram, without clearing the cache, to make it
    *faster.
    * NOTE: Only call this on a un-weighted event list!
+   * NOTE: A list in columnar storage must be converted back by reserve() or
+   *switchTo() before the first event is appended.
    *
    * @param event :: TofEvent to add at the end of the list.
    * */
@@ -110,6 +118,8 @@ public:
   // --------------------------------------------------------------------------
   /** Append an event to the histogram, without clearing the cache, to make it
    * faster.
+   * NOTE: A list in columnar storage must be converted back by reserve() or
+   * switchTo() before the first event is appended.
    * @param event :: WeightedEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEvent &event) {
@@ -121,6 +131,8 @@ public:
   // --------------------------------------------------------------------------
   /** Append an event to the histogram, without clearing the cache, to make it
    * faster.
+   * NOTE: A list in columnar storage must be converted back by reserve() or
+   * switchTo() before the first event is appended.
    * @param event :: WeightedEventNoTime to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEventNoTime &event) {
@@ -152,6 +164,7 @@ public:
   void clearData() override;
 
   void reserve(size_t num) override;
+  size_t capacity() const;
 
   void sort(const EventSortType order) const;
 
@@ -165,6 +178,14 @@ public:
 
   bool isSortedByTof() const override;
 
+  void setColumnarStorage(const bool columnar);
+  bool hasColumnarStorage() const;
+  bool compressPulseTimes(const std::shared_ptr<const std::vector<int64_t>> &pulseTable);
+  bool hasCompressedPulseTimes() const;
+
+  /// Counter that changes whenever the events or the bin edges are modified
+  uint64_t getHistogramGeneration() const { return m_histogramGeneration; }
+
   EventSortType getSortType() const;
 
   // X-vector accessors. These reset the MRU for this spectrum
@@ -290,6 +311,7 @@ public:
   void divide(const MantidVec &X, const MantidVec &Y, const MantidVec &E) override;
 
   void convertUnitsViaTof(Mantid::Kernel::Unit const *fromUnit, Mantid::Kernel::Unit const *toUnit);
+  void convertUnitsViaTof(const Mantid::Kernel::ClosedFormConversion &conversion);
   void convertUnitsQuickly(const double &factor, const double &power);
 
   /// Returns a copy of the Histogram associated with this spectrum.
@@ -346,9 +368,24 @@ private:
   /// MRU lists of the parent EventWorkspace
   mutable EventWorkspaceMRU *mru;
 
+  /// Incremented on every change to the events or X, so that histograms cached
+  /// for an earlier generation are not used
+  uint64_t m_histogramGeneration{0};
+
   /// Mutex that is locked while sorting an event list
   mutable std::mutex m_sortMutex;
 
+  /// Structure-of-arrays copy of the events. When set, it holds all of the
+  /// events and the event vector of the current type is empty.
+  mutable std::unique_ptr<EventColumns> m_columns;
+  /// True while m_columns is set, so that const methods can check for
+  /// columnar storage without taking m_sortMutex
+  mutable std::atomic<bool> m_isColumnar{false};
+
+  void setColumns(std::unique_ptr<EventColumns> columns) const;
+  std::unique_lock<std::mutex> lockColumns() const;
+  void materializeRows() const;
+
   template <class T>
   static typename std::vector<T>::const_iterator findFirstPulseEvent(const std::vector<T> &events,
                                                                      const double seek_pulsetime);
@@ -360,6 +397,8 @@ private:
 
   void generateCountsHistogram(const MantidVec &X, MantidVec &Y) const;
   void generateCountsHistogram(const double step, const MantidVec &X, MantidVec &Y) const;
+  void generateHistogramFromColumns(const MantidVec &X, MantidVec &Y, MantidVec &E, const bool skipError,
+                                    const std::optional<double> step) const;
 
 public:
   static std::optional<size_t> findLinearBin(const MantidVec &X, const double tof, const double divisor,
@@ -447,6 +486,9 @@ private:
   void convertUnitsViaTofHelper(typename std::vector<T> &events, Mantid::Kernel::Unit const *fromUnit,
                                 Mantid::Kernel::Unit const *toUnit);
   template <class T>
+  void convertUnitsViaTofHelper(typename std::vector<T> &events,
+                                const Mantid::Kernel::ClosedFormConversion &conversion);
+  template <class T>
   void convertUnitsQuicklyHelper(typename std::vector<T> &events, const double &factor, const double &power);
 };
 
@@ -10,6 +10,7 @@
 #include "MantidAPI/ISpectrum.h"
 #include "MantidDataObjects/DllConfig.h"
 #include "MantidDataObjects/EventList.h"
+#include "MantidDataObjects/EventWorkspaceMRU.h"
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <string>
 
@@ -19,7 +20,6 @@ class Progress;
 }
 
 namespace DataObjects {
-class EventWorkspaceMRU;
 
 /** \class EventWorkspace
 
@@ -130,6 +130,11 @@ public:
   // Change the event type
   void switchEventType(const Mantid::API::EventType type);
 
+  // Change the storage layout of the events
+  void setColumnarEventStorage(const bool columnar);
+  bool hasColumnarEventStorage() const;
+  void compressPulseTimes();
+
   // Returns true always - an EventWorkspace always represents histogramm-able
   // data
   bool isHistogramData() const override;
@@ -138,6 +143,9 @@ public:
 
   void clearMRU() const override;
 
+  void setHistogramCacheSize(const std::size_t memoryBudget) const;
+  EventWorkspaceMRU::Statistics getHistogramCacheStatistics() const;
+
   EventSortType getSortType() const;
 
   // Sort all event lists. Uses a parallelized algorithm
@@ -15,7 +15,12 @@
 
 #include "Poco/RWLock.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace Mantid {
@@ -43,6 +48,9 @@ public:
   /// Unique index value.
   uintptr_t m_index;
 
+  /// Histogram generation of the EventList the data was made from
+  uint64_t m_generation{0};
+
   /// Pointer to a vector of data
   T m_data;
 
@@ -57,6 +65,13 @@ public:
 //============================================================================
 /** This is a container for the MRU (most-recently-used) list
  * of generated histograms.
+ *
+ * Each thread has a short MRU list, which keeps the histograms it used last
+ * alive so that references to their data stay valid. Behind these is a cache
+ * shared by all threads that holds as many histograms as fit in a memory
+ * budget, so a sweep over all of the spectra of a workspace does not have to
+ * generate them again. Entries are tagged with the histogram generation of
+ * the EventList, and are ignored once the list has been changed.
  */
 class MANTID_DATAOBJECTS_DLL EventWorkspaceMRU {
 public:
@@ -68,17 +83,31 @@ public:
   using mru_listY = Kernel::MRUList<YWithMarker>;
   using mru_listE = Kernel::MRUList<EWithMarker>;
 
+  /// Usage of the histogram cache
+  struct Statistics {
+    /// Number of histograms found in the cache
+    std::size_t hits{0};
+    /// Number of histograms that had to be generated
+    std::size_t misses{0};
+    /// Number of histograms held in the shared cache
+    std::size_t entries{0};
+    /// Memory used by the histograms in the shared cache, in bytes
+    std::size_t memory{0};
+  };
+
+  EventWorkspaceMRU();
+  explicit EventWorkspaceMRU(const std::size_t memoryBudget);
   ~EventWorkspaceMRU();
 
   void ensureEnoughBuffersY(size_t thread_num) const;
   void ensureEnoughBuffersE(size_t thread_num) const;
+  void ensureEnoughBuffers(size_t thread_num) const;
 
   void clear();
 
-  YType findY(size_t thread_num, const EventList *index);
-  EType findE(size_t thread_num, const EventList *index);
-  void insertY(size_t thread_num, YType data, const EventList *index);
-  void insertE(size_t thread_num, EType data, const EventList *index);
+  YType findY(size_t thread_num, const EventList *index, const uint64_t generation);
+  EType findE(size_t thread_num, const EventList *index, const uint64_t generation);
+  void insert(size_t thread_num, YType yData, EType eData, const EventList *index, const uint64_t generation);
 
   void deleteIndex(const EventList *index);
 
@@ -87,6 +116,10 @@ public:
    * @return :: number of entries in the MRU list. */
   size_t MRUSize() const;
 
+  void setMemoryBudget(const std::size_t memoryBudget);
+  std::size_t getMemoryBudget() const;
+  Statistics getStatistics() const;
+
 protected:
   /// The most-recently-used list of dataY histograms
   mutable std::vector<std::unique_ptr<mru_listY>> m_bufferedDataY;
@@ -97,6 +130,42 @@ protected:
   /// Mutex when adding entries in the MRU list
   mutable Poco::RWLock m_changeMruListsMutexE;
   mutable Poco::RWLock m_changeMruListsMutexY;
+  /// Number of threads known to have both a Y and an E MRU list
+  mutable std::atomic<std::size_t> m_numBuffers{0};
+
+private:
+  /// A histogram held in the shared cache
+  struct CachedHistogram {
+    const EventList *index;
+    uint64_t generation;
+    YType yData;
+    EType eData;
+    std::size_t memory;
+  };
+  /// One part of the shared cache, with its own lock and least-recently-used order
+  struct Shard {
+    std::mutex mutex;
+    std::list<CachedHistogram> entries;
+    std::unordered_map<const EventList *, std::list<CachedHistogram>::iterator> lookup;
+    std::size_t memory{0};
+  };
+  /// Number of independently locked parts of the shared cache
+  static constexpr std::size_t NUM_SHARDS{16};
+
+  Shard &shardFor(const EventList *index);
+  bool findShared(const EventList *index, const uint64_t generation, YType &yData, EType &eData);
+  void insertIntoBuffers(size_t thread_num, const YType &yData, const EType &eData, const EventList *index,
+                         const uint64_t generation);
+  static void evict(Shard &shard, const std::size_t budget);
+
+  /// The shared cache
+  mutable std::array<Shard, NUM_SHARDS> m_shards;
+  /// Memory the shared cache may use, in bytes. Zero disables it.
+  std::atomic<std::size_t> m_memoryBudget;
+  /// Number of histograms found in the cache
+  std::atomic<std::size_t> m_hits{0};
+  /// Number of histograms that were not found in the cache
+  std::atomic<std::size_t> m_misses{0};
 };
 
 } // namespace DataObjects
@@ -56,7 +56,10 @@ public:
   /*** this function tries to set file positions of the boxes to
         make data physically located close to each other to be as close as
      possible on the HDD */
-  void setBoxesFilePositions(bool setFileBacked);
+  void setBoxesFilePositions(bool setFileBacked, bool mortonOrder = false);
+  /**@return true if the events of the boxes are laid out in the Morton order of
+   * the box centres */
+  bool isMortonOrdered() const { return m_mortonOrdered; }
 
   /**Save flat box structure into a file, defined by the file name*/
   void saveBoxStructure(const std::string &fileName);
@@ -78,10 +81,14 @@ private:
   /**Load the part of the box structure, responsible for locating events only*/
   /**Save flat box structure into properly open nexus file*/
   void saveBoxStructure(::NeXus::File *hFile);
+  /**Sort the boxes in the Morton (Z) order of their centres*/
+  void sortByMortonIndex(std::vector<API::IMDNode *> &boxes) const;
   //----------------------------------------------------------------------------------------------
   int m_nDim;
   // The name of the file the class will be working with
   std::string m_FileName;
+  /// true if the boxes events are laid out in the Morton order of the boxes
+  bool m_mortonOrdered;
   /// Box type (0=None, 1=MDBox, 2=MDGridBox
   std::vector<int> m_BoxType;
   /// Recursion depth
@@ -100,6 +100,8 @@ private:
 
   void releaseEvents() const;
 
+  void readAhead() const;
+
   /// Current position in the vector of boxes
   size_t m_pos;
 
@@ -118,6 +120,9 @@ private:
   /// Pointer to the const events vector. Only initialized when needed.
   mutable const std::vector<MDE> *m_events;
 
+  /// Position after the last box asked to be read ahead from file
+  mutable size_t m_readAheadEnd;
+
   // Skipping policy, controlls recursive calls to next().
   SkippingPolicy_scptr m_skippingPolicy;
 };
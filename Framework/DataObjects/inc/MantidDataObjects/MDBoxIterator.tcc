@@ -7,6 +7,7 @@
 #include "MantidDataObjects/MDBoxBase.h"
 #include "MantidDataObjects/MDBoxIterator.h"
 #include "MantidGeometry/MDGeometry/MDImplicitFunction.h"
+#include <algorithm>
 #include <cstddef>
 
 namespace Mantid {
@@ -27,7 +28,7 @@ namespace DataObjects {
  */
 TMDE(MDBoxIterator)::MDBoxIterator(API::IMDNode *topBox, size_t maxDepth, bool leafOnly,
                                    Mantid::Geometry::MDImplicitFunction *function)
-    : m_pos(0), m_current(nullptr), m_currentMDBox(nullptr), m_events(nullptr),
+    : m_pos(0), m_current(nullptr), m_currentMDBox(nullptr), m_events(nullptr), m_readAheadEnd(0),
       m_skippingPolicy(new SkipMaskedBins(this)) {
   commonConstruct(topBox, maxDepth, leafOnly, function);
 }
@@ -48,7 +49,8 @@ TMDE(MDBoxIterator)::MDBoxIterator(API::IMDNode *topBox, size_t maxDepth, bool l
  */
 TMDE(MDBoxIterator)::MDBoxIterator(API::IMDNode *topBox, size_t maxDepth, bool leafOnly, SkippingPolicy *skippingPolicy,
                                    Mantid::Geometry::MDImplicitFunction *function)
-    : m_pos(0), m_current(nullptr), m_currentMDBox(nullptr), m_events(nullptr), m_skippingPolicy(skippingPolicy) {
+    : m_pos(0), m_current(nullptr), m_currentMDBox(nullptr), m_events(nullptr), m_readAheadEnd(0),
+      m_skippingPolicy(skippingPolicy) {
   commonConstruct(topBox, maxDepth, leafOnly, function);
 }
 
@@ -96,7 +98,7 @@ TMDE(void MDBoxIterator)::commonConstruct(API::IMDNode *topBox, size_t maxDepth,
  * @param end :: stop iterating at this point in the list
  */
 TMDE(MDBoxIterator)::MDBoxIterator(std::vector<API::IMDNode *> &boxes, size_t begin, size_t end)
-    : m_pos(0), m_current(nullptr), m_currentMDBox(nullptr), m_events(nullptr),
+    : m_pos(0), m_current(nullptr), m_currentMDBox(nullptr), m_events(nullptr), m_readAheadEnd(0),
       m_skippingPolicy(new SkipMaskedBins(this))
 
 {
@@ -146,6 +148,25 @@ TMDE(void MDBoxIterator)::jumpTo(size_t index) {
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** For a file-backed workspace, ask the IO layer to start reading the events of
+ * the boxes following the current one, so that reading overlaps the use of the
+ * current box. Called when events are first needed, as an iterator looking only
+ * at the box signals never loads events.
+ */
+TMDE(void MDBoxIterator)::readAhead() const {
+  // How many boxes ahead of the current one are read
+  constexpr size_t READ_AHEAD_BOXES = 8;
+
+  API::BoxController *bc = m_current->getBoxController();
+  if (!bc || !bc->isFileBacked())
+    return;
+  const API::IBoxControllerIO *fileIO = bc->getFileIO();
+  const size_t end = std::min(m_max, m_pos + 1 + READ_AHEAD_BOXES);
+  for (m_readAheadEnd = std::max(m_readAheadEnd, m_pos + 1); m_readAheadEnd < end; ++m_readAheadEnd)
+    fileIO->prefetch(m_boxes[m_readAheadEnd]->getISaveable());
+}
+
 //----------------------------------------------------------------------------------------------
 /// @return true if the iterator is currently valid
 TMDE(bool MDBoxIterator)::valid() const { return m_current != nullptr; }
@@ -191,6 +212,7 @@ TMDE(void MDBoxIterator)::getEvents() const {
     if (!m_currentMDBox)
       m_currentMDBox = dynamic_cast<MDBox<MDE, nd> *>(m_current);
     if (m_currentMDBox) {
+      readAhead();
       // Retrieve the event vector.
       m_events = &m_currentMDBox->getConstEvents();
     } else
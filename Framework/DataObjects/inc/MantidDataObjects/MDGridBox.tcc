@@ -130,9 +130,8 @@ void MDGridBox<MDE, nd>::fillBoxShell(const size_t tot, const coord_t ChildInver
 
   // get inital free ID for the boxes, which would be created by this command
   // Splitting an input MDBox requires creating a bunch of children
-  // But the IDs of these children MUST be sequential. Hence the critical block
-  // within claimIDRange,
-  // which would produce sequental ranges in multithreaded environment
+  // But the IDs of these children MUST be sequential. Hence claimIDRange,
+  // which atomically produces sequental ranges in multithreaded environment
   size_t ID0 = this->m_BoxController->claimIDRange(tot);
 
   for (size_t i = 0; i < tot; i++) {
@@ -0,0 +1,50 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidGeometry/MDGeometry/MDTypes.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+class MDHistoWorkspace;
+
+/** MDHistoOccupancy: records which regions of a MDHistoWorkspace hold data.
+
+  The linear index range of the workspace is cut into tiles of TILE_SIZE
+  consecutive voxels. A tile is occupied when the signal, error or number of
+  events of any of its voxels is non-zero, which lets a caller skip ranges of
+  the workspace that are known to be empty.
+
+  Building the occupancy reads every voxel once, so it only pays off when it
+  saves a more expensive per-voxel pass, such as a neighbourhood sum, and not
+  a single elementwise one. The storage of the workspace stays dense.
+
+  The occupancy is a snapshot: it is not updated when the workspace changes.
+*/
+class MANTID_DATAOBJECTS_DLL MDHistoOccupancy {
+public:
+  /// Number of voxels (consecutive linear indices) in one tile
+  static constexpr size_t TILE_SIZE = 4096;
+
+  explicit MDHistoOccupancy(const MDHistoWorkspace &ws);
+  MDHistoOccupancy(const signal_t *signals, const signal_t *errorsSquared, const signal_t *numEvents,
+                   const size_t length);
+
+  bool anyOccupiedTile(const size_t begin, const size_t end) const;
+
+private:
+  /// Number of voxels covered
+  size_t m_length;
+  /// Number of occupied tiles before each tile; one extra entry holds the total
+  std::vector<size_t> m_occupiedBefore;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -12,6 +12,7 @@
 #include "MantidDataObjects/TableWorkspace.h"
 #include "MantidKernel/DateAndTime.h"
 
+#include <functional>
 #include <set>
 
 namespace Mantid {
@@ -58,6 +59,10 @@ public:
   /// Split a list of events according to Pulse time or Pulse + TOF time
   void splitEventList(const EventList &events, std::map<int, EventList *> &partials, const bool pulseTof = false,
                       const bool tofCorrect = false, const double factor = 1.0, const double shift = 0.0) const;
+  /// Split a list of events, asking for the partial list of a destination only when events are routed to it
+  void splitEventList(const EventList &events, const std::function<EventList *(const int)> &getPartial,
+                      const bool pulseTof = false, const bool tofCorrect = false, const double factor = 1.0,
+                      const double shift = 0.0) const;
   /// Print the (destination index | DateAndTime boundary) pairs of this splitter.
   std::string debugPrint() const;
 
@@ -66,11 +71,11 @@ private:
   void clearAndReplace(const DateAndTime &start, const DateAndTime &stop, const int value);
   /// Distribute a list of events by comparing a vector of times against the splitter boundaries.
   template <typename EventType>
-  void splitEventVec(const std::vector<EventType> &events, std::map<int, EventList *> &partials, const bool pulseTof,
-                     const bool tofCorrect, const double factor, const double shift) const;
-  template <typename EventType>
-  void splitEventVec(const std::function<const DateAndTime(const EventType &)> &timeCalc,
-                     const std::vector<EventType> &events, std::map<int, EventList *> &partials) const;
+  void splitEventVec(const std::vector<EventType> &events, const std::function<EventList *(const int)> &getPartial,
+                     const bool pulseTof, const bool tofCorrect, const double factor, const double shift) const;
+  template <typename EventType, typename TimeCalc>
+  void splitEventVec(const TimeCalc &timeCalc, const std::vector<EventType> &events,
+                     const std::function<EventList *(const int)> &getPartial, const bool pulseTof) const;
 
   void resetCache();
   void resetCachedPartialTimeROIs() const;
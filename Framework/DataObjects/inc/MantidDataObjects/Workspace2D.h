@@ -93,8 +93,9 @@ protected:
   /// a vector holding workspace index of monitors in the workspace
   std::vector<specnum_t> m_monitorList;
 
-  /// A vector that holds the 1D histograms
-  std::vector<std::unique_ptr<Histogram1D>> data;
+  /// The 1D histograms, held by value rather than allocated one by one. Each
+  /// still owns separate X, Y and E arrays, there is no nspec x nbins block.
+  std::vector<Histogram1D> data;
 
 private:
   Workspace2D *doClone() const override;
@@ -13,11 +13,14 @@
 #include "MantidDataObjects/MDEvent.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/Logger.h"
 
 #include <H5Cpp.h>
 #include <Poco/File.h>
 
 #include <algorithm>
+#include <exception>
+#include <memory>
 #include <string>
 
 namespace Mantid::DataObjects {
@@ -30,12 +33,18 @@ const char *EventHeaders[] = {"signal, errorSquared, center (each dim.)",
 std::string BoxControllerNeXusIO::g_EventGroupName("event_data");
 std::string BoxControllerNeXusIO::g_DBDataName("free_space_blocks");
 
+namespace {
+/// static logger
+Kernel::Logger g_log("BoxControllerNeXusIO");
+} // namespace
+
 /**Constructor
  @param bc shared pointer to the box controller which uses this IO operations
 */
 BoxControllerNeXusIO::BoxControllerNeXusIO(API::BoxController *const bc)
     : m_File(nullptr), m_ReadOnly(true), m_dataChunk(DATA_CHUNK), m_bc(bc), m_BlockStart(2, 0), m_BlockSize(2, 0),
-      m_CoordSize(sizeof(coord_t)), m_EventType(FatEvent), m_EventsVersion("1.0"),
+      m_readAheadUsed(0), m_readAheadSize(READ_AHEAD_EVENTS), m_lastReadAheadId(0), m_readAheadHits(0),
+      m_directReads(0), m_writesBehind(0), m_CoordSize(sizeof(coord_t)), m_EventType(FatEvent), m_EventsVersion("1.0"),
       m_EventDataVersion(EventDataVersion::EDVGoniometer), m_ReadConversion(noConversion) {
   m_BlockSize[1] = 5 + m_bc->getNDims();
 
@@ -172,6 +181,8 @@ bool BoxControllerNeXusIO::openFile(const std::string &fileName, const std::stri
  * @param destFilename A filepath to copy the file to.
  */
 void BoxControllerNeXusIO::copyFileTo(const std::string &destFilename) {
+  // the blocks written behind have to be in the file before it is copied
+  m_ioQueue.wait();
   // Some OSs (observed on Windows) take an exclusive lock on the file
   // To copy the file must be closed, copied and reopened. To avoid
   // paying for this where not necessary first try without closing first
@@ -339,12 +350,39 @@ void BoxControllerNeXusIO::saveGenericBlock(const std::vector<Type> &DataBlock,
   // makes putSlab method non-constant
   auto &mData = const_cast<std::vector<Type> &>(DataBlock);
 
-  {
-    m_File->putSlab<Type>(mData, start, dims);
+  m_File->putSlab<Type>(mData, start, dims);
+}
+
+/** Queue a data block to be written by the IO thread and return.
+ * The block is copied, so the caller may reuse its vector at once. Loads of the
+ * same file region wait for the write to complete. Blocks of a file opened for
+ * reading are written immediately, so that the error is reported to the caller.
+ *@param DataBlock     -- the vector with data to write
+ *@param blockPosition -- The starting place to save data to   */
+template <typename Type>
+void BoxControllerNeXusIO::saveBlockBehind(const std::vector<Type> &DataBlock, const uint64_t blockPosition) const {
+  const auto nPoints = static_cast<uint64_t>(DataBlock.size() / this->getNDataColums());
+  Kernel::AsyncIOQueue::Ticket ticket(0);
+  if (m_ReadOnly) {
+    this->saveGenericBlock(DataBlock, blockPosition);
+  } else {
+    auto block = std::make_shared<const std::vector<Type>>(DataBlock);
+    ticket = m_ioQueue.push([this, block, blockPosition] { this->saveGenericBlock(*block, blockPosition); });
+  }
 
-    if (blockPosition + dims[0] > this->getFileLength())
-      this->setFileLength(blockPosition + dims[0]);
+  // blocks may be saved from several threads
+  std::lock_guard<std::mutex> _lock(m_bufferMutex);
+  if (!m_ReadOnly) {
+    // a block read ahead from this region is out of date now
+    dropReadAhead(blockPosition, nPoints);
+    while (!m_pendingWrites.empty() && m_ioQueue.isComplete(m_pendingWrites.front().ticket))
+      m_pendingWrites.pop_front();
+    m_pendingWrites.emplace_back(PendingWrite{blockPosition, nPoints, ticket});
+    ++m_writesBehind;
   }
+  // the file is as long as if the block had been written already
+  if (blockPosition + nPoints > this->getFileLength())
+    this->setFileLength(blockPosition + nPoints);
 }
 
 /** Save float data block on specific position within properly opened NeXus data
@@ -352,14 +390,14 @@ void BoxControllerNeXusIO::saveGenericBlock(const std::vector<Type> &DataBlock,
  *@param DataBlock     -- the vector with data to write
  *@param blockPosition -- The starting place to save data to   */
 void BoxControllerNeXusIO::saveBlock(const std::vector<float> &DataBlock, const uint64_t blockPosition) const {
-  this->saveGenericBlock(DataBlock, blockPosition);
+  this->saveBlockBehind(DataBlock, blockPosition);
 }
 /** Save double precision data block on specific position within properly opened
  *NeXus data array
  *@param DataBlock     -- the vector with data to write
  *@param blockPosition -- The starting place to save data to   */
 void BoxControllerNeXusIO::saveBlock(const std::vector<double> &DataBlock, const uint64_t blockPosition) const {
-  this->saveGenericBlock(DataBlock, blockPosition);
+  this->saveBlockBehind(DataBlock, blockPosition);
 }
 
 void BoxControllerNeXusIO::setEventDataVersion(const BoxControllerNeXusIO::EventDataVersion &version) {
@@ -529,12 +567,12 @@ template <typename FROM, typename TO> void convertFormats(const std::vector<FROM
     outData.emplace_back(static_cast<TO>(inData[i]));
   }
 }
-/** Load float  data block from the opened NeXus file.
+/** Read float  data block from the opened NeXus file.
  *@param Block         -- the storage vector to place data into
  *@param blockPosition -- The starting place to read data from
  *@param nPoints       -- number of data points (events) to read
  */
-void BoxControllerNeXusIO::loadBlock(std::vector<float> &Block, const uint64_t blockPosition,
+void BoxControllerNeXusIO::readBlock(std::vector<float> &Block, const uint64_t blockPosition,
                                      const size_t nPoints) const {
   std::vector<double> tmp;
   switch (m_ReadConversion) {
@@ -549,12 +587,12 @@ void BoxControllerNeXusIO::loadBlock(std::vector<float> &Block, const uint64_t b
     throw Kernel::Exception::FileError(" Attempt to read float data from unsupported file format", m_fileName);
   }
 }
-/** Load double  data block from the opened NeXus file.
+/** Read double  data block from the opened NeXus file.
  *@param Block         -- the storage vector to place data into
  *@param blockPosition -- The starting place to read data from
  *@param nPoints       -- number of data points (events) to read
  */
-void BoxControllerNeXusIO::loadBlock(std::vector<double> &Block, const uint64_t blockPosition,
+void BoxControllerNeXusIO::readBlock(std::vector<double> &Block, const uint64_t blockPosition,
                                      const size_t nPoints) const {
   std::vector<float> tmp;
   switch (m_ReadConversion) {
@@ -570,18 +608,198 @@ void BoxControllerNeXusIO::loadBlock(std::vector<double> &Block, const uint64_t
   }
 }
 
+/** Load float  data block, taking it from the read-ahead buffer if it has been
+ * prefetched and from the opened NeXus file otherwise.
+ *@param Block         -- the storage vector to place data into
+ *@param blockPosition -- The starting place to read data from
+ *@param nPoints       -- number of data points (events) to read
+ */
+void BoxControllerNeXusIO::loadBlock(std::vector<float> &Block, const uint64_t blockPosition,
+                                     const size_t nPoints) const {
+  this->loadBufferedBlock(Block, blockPosition, nPoints);
+}
+/** Load double  data block, taking it from the read-ahead buffer if it has been
+ * prefetched and from the opened NeXus file otherwise.
+ *@param Block         -- the storage vector to place data into
+ *@param blockPosition -- The starting place to read data from
+ *@param nPoints       -- number of data points (events) to read
+ */
+void BoxControllerNeXusIO::loadBlock(std::vector<double> &Block, const uint64_t blockPosition,
+                                     const size_t nPoints) const {
+  this->loadBufferedBlock(Block, blockPosition, nPoints);
+}
+
+template <typename Type>
+void BoxControllerNeXusIO::loadBufferedBlock(std::vector<Type> &Block, const uint64_t blockPosition,
+                                             const size_t nPoints) const {
+  if (this->takeReadAhead(Block, blockPosition, nPoints))
+    return;
+  this->waitForWrites(blockPosition, nPoints);
+  this->readBlock(Block, blockPosition, nPoints);
+  std::lock_guard<std::mutex> _lock(m_bufferMutex);
+  ++m_directReads;
+}
+
+/** Move a block from the read-ahead buffer, waiting for it if it is still being read.
+ *@return false if the block was not prefetched, or was prefetched with a different size or type
+ */
+template <typename Type>
+bool BoxControllerNeXusIO::takeReadAhead(std::vector<Type> &Block, const uint64_t blockPosition,
+                                         const size_t nPoints) const {
+  std::unique_lock<std::mutex> lock(m_bufferMutex);
+  auto it = m_readAhead.find(blockPosition);
+  if (it == m_readAhead.end())
+    return false;
+  const uint64_t id = it->second.id;
+  if (it->second.nPoints == nPoints && !it->second.loaded) {
+    const auto ticket = it->second.ticket;
+    lock.unlock();
+    if (ticket > 0)
+      m_ioQueue.waitFor(ticket);
+    else // the read is being queued right now
+      m_ioQueue.wait();
+    lock.lock();
+    it = m_readAhead.find(blockPosition);
+    if (it == m_readAhead.end() || it->second.id != id)
+      return false;
+  }
+
+  auto *data = std::get_if<std::vector<Type>>(&it->second.data);
+  const bool found = it->second.loaded && it->second.nPoints == nPoints && data;
+  if (found) {
+    Block = std::move(*data);
+    ++m_readAheadHits;
+  }
+  m_readAheadUsed -= it->second.nPoints;
+  m_readAhead.erase(it);
+  return found;
+}
+
+/** Start reading a block in the background, so that a following loadBlock with
+ * the same position and size finds it in memory. Requests which do not fit into
+ * the read-ahead buffer are ignored, after the oldest not yet used blocks have
+ * been dropped from it.
+ *@param blockPosition -- The starting place to read data from
+ *@param nPoints       -- number of data points (events) to read
+ */
+void BoxControllerNeXusIO::prefetchBlock(const uint64_t blockPosition, const size_t nPoints) const {
+  if (!m_File || nPoints == 0 || nPoints > m_readAheadSize)
+    return;
+
+  uint64_t id;
+  {
+    std::lock_guard<std::mutex> _lock(m_bufferMutex);
+    if (m_readAhead.count(blockPosition) > 0)
+      return;
+    // drop the oldest requests, which have probably been skipped by the reader
+    while (m_readAheadUsed + nPoints > m_readAheadSize) {
+      auto oldest = std::min_element(m_readAhead.begin(), m_readAhead.end(),
+                                     [](const auto &a, const auto &b) { return a.second.id < b.second.id; });
+      m_readAheadUsed -= oldest->second.nPoints;
+      m_readAhead.erase(oldest);
+    }
+    id = ++m_lastReadAheadId;
+    m_readAhead.emplace(blockPosition, ReadAheadBlock{id, nPoints, 0, false, {}});
+    m_readAheadUsed += nPoints;
+  }
+
+  const auto ticket = m_ioQueue.push([this, blockPosition, nPoints, id] {
+    decltype(ReadAheadBlock::data) data;
+    bool loaded(true);
+    try {
+      if (m_CoordSize == 4)
+        this->readBlock(data.emplace<std::vector<float>>(), blockPosition, nPoints);
+      else
+        this->readBlock(data.emplace<std::vector<double>>(), blockPosition, nPoints);
+    } catch (...) {
+      // the load which needs the block reads it again and reports the error
+      loaded = false;
+    }
+    std::lock_guard<std::mutex> _lock(m_bufferMutex);
+    auto it = m_readAhead.find(blockPosition);
+    if (it != m_readAhead.end() && it->second.id == id) {
+      it->second.data = std::move(data);
+      it->second.loaded = loaded;
+    }
+  });
+
+  std::lock_guard<std::mutex> _lock(m_bufferMutex);
+  auto it = m_readAhead.find(blockPosition);
+  if (it != m_readAhead.end() && it->second.id == id)
+    it->second.ticket = ticket;
+}
+
+/** Remove the blocks overlapping the given file region from the read-ahead
+ * buffer. The caller holds m_bufferMutex. */
+void BoxControllerNeXusIO::dropReadAhead(const uint64_t blockPosition, const uint64_t nPoints) const {
+  for (auto it = m_readAhead.begin(); it != m_readAhead.end() && it->first < blockPosition + nPoints;) {
+    if (it->first + it->second.nPoints > blockPosition) {
+      m_readAheadUsed -= it->second.nPoints;
+      it = m_readAhead.erase(it);
+    } else
+      ++it;
+  }
+}
+
+/** Wait until the queued writes overlapping the given file region are in the file */
+void BoxControllerNeXusIO::waitForWrites(const uint64_t blockPosition, const uint64_t nPoints) const {
+  Kernel::AsyncIOQueue::Ticket last(0);
+  {
+    std::lock_guard<std::mutex> _lock(m_bufferMutex);
+    while (!m_pendingWrites.empty() && m_ioQueue.isComplete(m_pendingWrites.front().ticket))
+      m_pendingWrites.pop_front();
+    for (const auto &write : m_pendingWrites) {
+      if (write.position < blockPosition + nPoints && write.position + write.nPoints > blockPosition)
+        last = write.ticket;
+    }
+  }
+  if (last > 0)
+    m_ioQueue.waitFor(last);
+}
+
+/// @return the counters of the asynchronous IO performed on this file
+BoxControllerNeXusIO::IOStatistics BoxControllerNeXusIO::getIOStatistics() const {
+  std::lock_guard<std::mutex> _lock(m_bufferMutex);
+  return IOStatistics{m_ioQueue.getStatistics(), m_readAheadHits, m_directReads, m_writesBehind};
+}
+
 //-------------------------------------------------------------------------------------------------------------------------------------
 
-/// Clear NeXus internal cache
+/// Write the queued blocks and clear NeXus internal cache
 void BoxControllerNeXusIO::flushData() const {
+  m_ioQueue.wait();
   std::lock_guard<std::mutex> _lock(m_fileMutex);
   m_File->flush();
 }
+/// Queue clearing NeXus internal cache after the blocks written behind so far
+void BoxControllerNeXusIO::flushDataBehind() const {
+  if (m_ReadOnly) {
+    this->flushData();
+    return;
+  }
+  m_ioQueue.push([this] {
+    std::lock_guard<std::mutex> _lock(m_fileMutex);
+    m_File->flush();
+  });
+}
 /** flush disk buffer data from memory and close underlying NeXus file*/
 void BoxControllerNeXusIO::closeFile() {
   if (m_File) {
     // write all file-backed data still stack in the data buffer into the file.
     this->flushCache();
+    // a failed write is reported after the file is closed, so the file is not left open
+    std::exception_ptr writeError;
+    try {
+      m_ioQueue.wait();
+    } catch (...) {
+      writeError = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> _lock(m_bufferMutex);
+      m_readAhead.clear();
+      m_readAheadUsed = 0;
+      m_pendingWrites.clear();
+    }
     // lock file
     std::lock_guard<std::mutex> _lock(m_fileMutex);
 
@@ -602,8 +820,16 @@ void BoxControllerNeXusIO::closeFile() {
     m_File->closeGroup(); // close workspace group
     m_File->close();      // close NeXus file
     m_File = nullptr;
+    if (writeError)
+      std::rethrow_exception(writeError);
   }
 }
 
-BoxControllerNeXusIO::~BoxControllerNeXusIO() { this->closeFile(); }
+BoxControllerNeXusIO::~BoxControllerNeXusIO() {
+  try {
+    this->closeFile();
+  } catch (const std::exception &ex) {
+    g_log.error() << "Error closing file " << m_fileName << ": " << ex.what() << '\n';
+  }
+}
 } // namespace Mantid::DataObjects
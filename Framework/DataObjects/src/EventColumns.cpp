@@ -0,0 +1,275 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventColumns.h"
+
+#ifdef _MSC_VER
+// qualifier applied to function type has no meaning; ignored
+#pragma warning(disable : 4180)
+#endif
+#include "tbb/parallel_sort.h"
+#ifdef _MSC_VER
+#pragma warning(default : 4180)
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace Mantid::DataObjects {
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+
+namespace {
+// minimum number of events to use tbb::parallel_sort, same as in EventList
+constexpr size_t MIN_VEC_LENGTH_PARALLEL_SORT{2000};
+
+/// Reorder a column so that column[i] becomes column[order[i].second]
+template <typename T> void permute(std::vector<T> &column, const std::vector<std::pair<double, size_t>> &order) {
+  if (column.size() != order.size())
+    return;
+  std::vector<T> sorted;
+  sorted.reserve(column.size());
+  for (const auto &entry : order)
+    sorted.emplace_back(column[entry.second]);
+  column.swap(sorted);
+}
+} // namespace
+
+/// Remove all events, keeping the allocated capacity
+void EventColumns::clear() {
+  tof.clear();
+  pulseTime.clear();
+  weight.clear();
+  errorSquared.clear();
+  pulseTable.reset();
+  pulseIndex.clear();
+}
+
+/// Release any capacity that is not used by the held events
+void EventColumns::shrinkToFit() {
+  tof.shrink_to_fit();
+  pulseTime.shrink_to_fit();
+  weight.shrink_to_fit();
+  errorSquared.shrink_to_fit();
+  pulseIndex.shrink_to_fit();
+}
+
+/** Memory used by the columns. Like EventList::getMemorySize() this reports
+ * the capacity rather than the size of the arrays. The shared pulse table is
+ * not included.
+ * @return :: the memory used, in bytes.
+ */
+size_t EventColumns::getMemorySize() const {
+  return tof.capacity() * sizeof(double) + pulseTime.capacity() * sizeof(int64_t) +
+         pulseIndex.capacity() * sizeof(uint32_t) + (weight.capacity() + errorSquared.capacity()) * sizeof(float);
+}
+
+/** Fill the tof and pulse time columns from a vector of TofEvent's
+ * @param events :: the events to copy
+ */
+void EventColumns::assign(const std::vector<TofEvent> &events) {
+  clear();
+  tof.reserve(events.size());
+  pulseTime.reserve(events.size());
+  for (const auto &event : events) {
+    tof.emplace_back(event.tof());
+    pulseTime.emplace_back(event.pulseTime().totalNanoseconds());
+  }
+}
+
+/** Fill all four columns from a vector of WeightedEvent's
+ * @param events :: the events to copy
+ */
+void EventColumns::assign(const std::vector<WeightedEvent> &events) {
+  clear();
+  tof.reserve(events.size());
+  pulseTime.reserve(events.size());
+  weight.reserve(events.size());
+  errorSquared.reserve(events.size());
+  for (const auto &event : events) {
+    tof.emplace_back(event.tof());
+    pulseTime.emplace_back(event.pulseTime().totalNanoseconds());
+    weight.emplace_back(event.m_weight);
+    errorSquared.emplace_back(event.m_errorSquared);
+  }
+}
+
+/** Fill the tof, weight and error columns from a vector of WeightedEventNoTime's
+ * @param events :: the events to copy
+ */
+void EventColumns::assign(const std::vector<WeightedEventNoTime> &events) {
+  clear();
+  tof.reserve(events.size());
+  weight.reserve(events.size());
+  errorSquared.reserve(events.size());
+  for (const auto &event : events) {
+    tof.emplace_back(event.tof());
+    weight.emplace_back(event.m_weight);
+    errorSquared.emplace_back(event.m_errorSquared);
+  }
+}
+
+/** Rebuild a vector of TofEvent's from the columns
+ * @param events :: vector to fill. Existing contents are replaced.
+ */
+void EventColumns::extract(std::vector<TofEvent> &events) const {
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(tof[i], DateAndTime(pulseTimeAt(i)));
+}
+
+/** Rebuild a vector of WeightedEvent's from the columns
+ * @param events :: vector to fill. Existing contents are replaced.
+ */
+void EventColumns::extract(std::vector<WeightedEvent> &events) const {
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(tof[i], DateAndTime(pulseTimeAt(i)), weight[i], errorSquared[i]);
+}
+
+/** Rebuild a vector of WeightedEventNoTime's from the columns
+ * @param events :: vector to fill. Existing contents are replaced.
+ */
+void EventColumns::extract(std::vector<WeightedEventNoTime> &events) const {
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(tof[i], weight[i], errorSquared[i]);
+}
+
+/** Sort all columns by time-of-flight. The keys are sorted together with
+ * their original position, and the permutation is then applied to every
+ * populated column in turn, so each column is only streamed once.
+ */
+void EventColumns::sortByTof() {
+  const size_t numEvents = size();
+  if (numEvents < 2)
+    return;
+  if (std::is_sorted(tof.cbegin(), tof.cend()))
+    return;
+
+  std::vector<std::pair<double, size_t>> order;
+  order.reserve(numEvents);
+  for (size_t i = 0; i < numEvents; ++i)
+    order.emplace_back(tof[i], i);
+
+  if (numEvents < MIN_VEC_LENGTH_PARALLEL_SORT)
+    std::sort(order.begin(), order.end());
+  else
+    tbb::parallel_sort(order.begin(), order.end());
+
+  for (size_t i = 0; i < numEvents; ++i)
+    tof[i] = order[i].first;
+  permute(pulseTime, order);
+  permute(pulseIndex, order);
+  permute(weight, order);
+  permute(errorSquared, order);
+}
+
+/// Reverse the order of the events in all columns
+void EventColumns::reverse() {
+  std::reverse(tof.begin(), tof.end());
+  std::reverse(pulseTime.begin(), pulseTime.end());
+  std::reverse(pulseIndex.begin(), pulseIndex.end());
+  std::reverse(weight.begin(), weight.end());
+  std::reverse(errorSquared.begin(), errorSquared.end());
+}
+
+/** Replace the pulse time of each event by its index into a table of pulse
+ * times. The columns are left unchanged if any pulse time is missing from the
+ * table or if no pulse times are held.
+ * @param table :: sorted unique pulse times in nanoseconds, normally shared by all the lists of a workspace
+ * @return :: true if the pulse times are now compressed
+ */
+bool EventColumns::compressPulseTimes(const std::shared_ptr<const std::vector<int64_t>> &table) {
+  if (!table || table->size() > std::numeric_limits<uint32_t>::max())
+    return false;
+  if (!hasCompressedPulseTimes() && pulseTime.size() != size())
+    return false;
+
+  std::vector<uint32_t> indices;
+  indices.reserve(size());
+  auto pulse = table->cbegin();
+  for (size_t i = 0; i < size(); ++i) {
+    const int64_t time = pulseTimeAt(i);
+    // the events of a list mostly arrive grouped by pulse, so only search when the pulse changes
+    if (pulse == table->cend() || *pulse != time) {
+      pulse = std::lower_bound(table->cbegin(), table->cend(), time);
+      if (pulse == table->cend() || *pulse != time)
+        return false;
+    }
+    indices.emplace_back(static_cast<uint32_t>(std::distance(table->cbegin(), pulse)));
+  }
+
+  pulseIndex.swap(indices);
+  std::vector<int64_t>().swap(pulseTime);
+  pulseTable = table;
+  return true;
+}
+
+/** Copy the events with a pulse time in [start, stop) into other columns,
+ * keeping their order. Compressed pulse times stay compressed, and are
+ * compared as indices without looking up each time.
+ * @param start :: start time in nanoseconds (inclusive)
+ * @param stop :: stop time in nanoseconds (exclusive)
+ * @param output :: columns to fill. Existing contents are replaced.
+ */
+void EventColumns::filterByPulseTime(const int64_t start, const int64_t stop, EventColumns &output) const {
+  output.clear();
+  output.pulseTable = pulseTable;
+  const bool weighted = !weight.empty();
+  const auto copyIf = [this, &output, weighted](const auto &keep) {
+    for (size_t i = 0; i < size(); ++i) {
+      if (!keep(i))
+        continue;
+      output.tof.emplace_back(tof[i]);
+      if (pulseTable)
+        output.pulseIndex.emplace_back(pulseIndex[i]);
+      else
+        output.pulseTime.emplace_back(pulseTime[i]);
+      if (weighted) {
+        output.weight.emplace_back(weight[i]);
+        output.errorSquared.emplace_back(errorSquared[i]);
+      }
+    }
+  };
+
+  if (pulseTable) {
+    const auto first = static_cast<uint32_t>(
+        std::distance(pulseTable->cbegin(), std::lower_bound(pulseTable->cbegin(), pulseTable->cend(), start)));
+    const auto last = static_cast<uint32_t>(
+        std::distance(pulseTable->cbegin(), std::lower_bound(pulseTable->cbegin(), pulseTable->cend(), stop)));
+    copyIf([this, first, last](const size_t i) { return pulseIndex[i] >= first && pulseIndex[i] < last; });
+  } else {
+    copyIf([this, start, stop](const size_t i) { return pulseTime[i] >= start && pulseTime[i] < stop; });
+  }
+}
+
+/** Find the earliest and latest pulse times. The times are left unchanged if
+ * no pulse times are held.
+ * @param tMin :: set to the earliest pulse time in nanoseconds
+ * @param tMax :: set to the latest pulse time in nanoseconds
+ */
+void EventColumns::getPulseTimeMinMax(int64_t &tMin, int64_t &tMax) const {
+  if (pulseTable ? pulseIndex.empty() : pulseTime.empty())
+    return;
+  if (pulseTable) {
+    // the table is sorted, so the extreme indices give the extreme times
+    const auto [minIndex, maxIndex] = std::minmax_element(pulseIndex.cbegin(), pulseIndex.cend());
+    tMin = (*pulseTable)[*minIndex];
+    tMax = (*pulseTable)[*maxIndex];
+  } else {
+    const auto [minTime, maxTime] = std::minmax_element(pulseTime.cbegin(), pulseTime.cend());
+    tMin = *minTime;
+    tMax = *maxTime;
+  }
+}
+
+} // namespace Mantid::DataObjects
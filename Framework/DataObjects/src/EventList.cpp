@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventList.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidDataObjects/EventColumns.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidKernel/DateAndTime.h"
@@ -18,16 +19,21 @@
 // qualifier applied to function type has no meaning; ignored
 #pragma warning(disable : 4180)
 #endif
+#include "tbb/parallel_for.h"
 #include "tbb/parallel_sort.h"
 #ifdef _MSC_VER
 #pragma warning(default : 4180)
 #endif
 
 #include <algorithm>
+#include <array>
 #include <cfloat>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <limits>
+#include <span>
 #include <stdexcept>
 
 using std::ostream;
@@ -48,6 +54,9 @@ constexpr double SEC_TO_NANO{1.e9};
 // this is 4x what parallel_sort uses in the indidividual blocks
 constexpr size_t MIN_VEC_LENGTH_PARALLEL_SORT{2000};
 
+// minimum event vector length to use the radix sort instead of tbb::parallel_sort
+constexpr size_t MIN_VEC_LENGTH_RADIX_SORT{100000};
+
 /**
  * Calculate the corrected full time in nanoseconds
  * @param event : The event with pulse time and time-of-flight
@@ -160,6 +169,117 @@ struct FindBin {
   }
 };
 
+namespace {
+// Number of events whose bin estimate is computed in one go by histogramByStep
+constexpr size_t HISTOGRAM_BLOCK_SIZE{512};
+
+/** Find the first index in [first, last) whose tof is >= value, assuming the
+ * tofs are sorted. The search gallops forward from first, so successive
+ * searches for increasing values cost O(log(distance)) rather than
+ * O(log(size)); this keeps fine binnings as cheap as a linear walk.
+ *
+ * @param first :: index to start searching from
+ * @param last :: one past the last index to search
+ * @param value :: tof to search for
+ * @param tofAt :: returns the tof of the event at an index
+ * @return the index of the first event with tof >= value, or last
+ */
+template <typename TofAt>
+size_t gallopLowerBound(const size_t first, const size_t last, const double value, TofAt tofAt) {
+  if (first >= last || !(tofAt(first) < value))
+    return first;
+  // gallop forward keeping tofAt(low) < value
+  size_t low = first;
+  size_t step = 1;
+  while (low + step < last && tofAt(low + step) < value) {
+    low += step;
+    step *= 2;
+  }
+  // binary search in (low, high], where high is last or tofAt(high) >= value
+  size_t high = std::min(low + step, last);
+  while (high - low > 1) {
+    const size_t mid = low + (high - low) / 2;
+    if (tofAt(mid) < value)
+      low = mid;
+    else
+      high = mid;
+  }
+  return high;
+}
+
+/** Histogram events that are sorted by tof into arbitrary bin edges. Rather
+ * than testing every event against the current bin, the bin boundaries are
+ * located in the event list and whole runs of events are added at once.
+ *
+ * @param numEvents :: the number of events
+ * @param X :: bin edges, with at least two entries
+ * @param tofAt :: returns the tof of the event at an index
+ * @param addRange :: called with (bin, first, last) for the events of each
+ * non-empty bin
+ */
+template <typename TofAt, typename AddRange>
+void histogramSorted(const size_t numEvents, const MantidVec &X, TofAt tofAt, AddRange addRange) {
+  const size_t numBins = X.size() - 1;
+  size_t lower = gallopLowerBound(0, numEvents, X[0], tofAt);
+  for (size_t bin = 0; bin < numBins && lower < numEvents; ++bin) {
+    const size_t upper = gallopLowerBound(lower, numEvents, X[bin + 1], tofAt);
+    if (upper > lower)
+      addRange(bin, lower, upper);
+    lower = upper;
+  }
+}
+
+/** Histogram events, in any order, into linear or logarithmic bins. The bin
+ * estimates for a block of events are computed in a loop without branches,
+ * that the compiler can vectorise, and then corrected against the bin edges
+ * and accumulated.
+ *
+ * @param numEvents :: the number of events
+ * @param step :: bin step size, negative for logarithmic binning
+ * @param X :: bin edges, with at least two entries
+ * @param tofAt :: returns the tof of the event at an index
+ * @param addEvent :: called with (bin, index) for every event within X
+ */
+template <typename TofAt, typename AddEvent>
+void histogramByStep(const size_t numEvents, const double step, const MantidVec &X, TofAt tofAt, AddEvent addEvent) {
+  const double xmin = X.front();
+  const double xmax = X.back();
+  const size_t lastBin = X.size() - 2;
+  const bool logBinning = step < 0;
+  const double divisor = logBinning ? 1. / std::log1p(std::abs(step)) : 1. / step;
+  const double offset = logBinning ? std::log(xmin) * divisor : xmin * divisor;
+
+  std::array<double, HISTOGRAM_BLOCK_SIZE> tofs;
+  std::array<double, HISTOGRAM_BLOCK_SIZE> estimates;
+  for (size_t start = 0; start < numEvents; start += HISTOGRAM_BLOCK_SIZE) {
+    const size_t blockSize = std::min(HISTOGRAM_BLOCK_SIZE, numEvents - start);
+    for (size_t i = 0; i < blockSize; ++i)
+      tofs[i] = tofAt(start + i);
+    if (logBinning) {
+      for (size_t i = 0; i < blockSize; ++i)
+        estimates[i] = std::log(tofs[i]) * divisor - offset;
+    } else {
+      for (size_t i = 0; i < blockSize; ++i)
+        estimates[i] = tofs[i] * divisor - offset;
+    }
+
+    for (size_t i = 0; i < blockSize; ++i) {
+      const double tof = tofs[i];
+      if (!(tof >= xmin && tof < xmax))
+        continue;
+      // the estimate is within one bin of the right one; clamp it then correct it
+      auto bin = static_cast<size_t>(std::max(estimates[i], 0.));
+      bin = std::min(bin, lastBin);
+      while (bin > 0 && tof < X[bin])
+        --bin;
+      while (bin < lastBin && tof >= X[bin + 1])
+        ++bin;
+      addEvent(bin, start + i);
+    }
+  }
+}
+} // anonymous namespace
+
 /// Constructor (empty)
 // EventWorkspace is always histogram data and so is thus EventList
 EventList::EventList(const EventType event_type)
@@ -250,6 +370,7 @@ EventList::~EventList() {
   this->events.reset();
   this->weightedEvents.reset();
   this->weightedEventsNoTime.reset();
+  this->setColumns(nullptr);
 }
 
 /// Copy data from another EventList, via ISpectrum reference.
@@ -258,6 +379,7 @@ void EventList::copyDataFrom(const ISpectrum &source) { source.copyDataInto(*thi
 /// Used by copyDataFrom for dynamic dispatch for its `source`.
 void EventList::copyDataInto(EventList &sink) const {
   sink.m_histogram = m_histogram;
+  ++sink.m_histogramGeneration;
   if (events)
     sink.events = std::make_unique<std::vector<Types::Event::TofEvent>>(events->cbegin(), events->cend());
   else if (sink.events)
@@ -273,6 +395,8 @@ void EventList::copyDataInto(EventList &sink) const {
   else if (sink.weightedEventsNoTime)
     sink.weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
 
+  sink.setColumns(m_columns ? std::make_unique<EventColumns>(*m_columns) : nullptr);
+
   sink.eventType = eventType;
   sink.order = order;
 }
@@ -373,6 +497,7 @@ void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
  * @return reference to this
  * */
 EventList &EventList::operator=(const EventList &rhs) {
+  ++m_histogramGeneration;
   // Note that we are NOT copying the MRU pointer
   // the EventWorkspace that possesses the EventList has already configured the mru
   IEventList::operator=(rhs);
@@ -387,6 +512,8 @@ EventList &EventList::operator=(const EventList &rhs) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const Types::Event::TofEvent &event) {
+  materializeRows();
+  ++m_histogramGeneration;
 
   switch (this->eventType) {
   case TOF:
@@ -415,6 +542,8 @@ EventList &EventList::operator+=(const Types::Event::TofEvent &event) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<Types::Event::TofEvent> &more_events) {
+  materializeRows();
+  ++m_histogramGeneration;
   switch (this->eventType) {
   case TOF:
     // Simply push the events
@@ -450,6 +579,8 @@ EventList &EventList::operator+=(const std::vector<Types::Event::TofEvent> &more
  * @return reference to this
  * */
 EventList &EventList::operator+=(const WeightedEvent &event) {
+  materializeRows();
+  ++m_histogramGeneration;
   this->switchTo(WEIGHTED);
   this->weightedEvents->emplace_back(event);
   this->order = UNSORTED;
@@ -465,6 +596,8 @@ EventList &EventList::operator+=(const WeightedEvent &event) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<WeightedEvent> &more_events) {
+  materializeRows();
+  ++m_histogramGeneration;
   switch (this->eventType) {
   case TOF:
     // Need to switch to weighted
@@ -498,6 +631,8 @@ EventList &EventList::operator+=(const std::vector<WeightedEvent> &more_events)
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<WeightedEventNoTime> &more_events) {
+  materializeRows();
+  ++m_histogramGeneration;
   switch (this->eventType) {
   case TOF:
   case WEIGHTED:
@@ -526,6 +661,9 @@ EventList &EventList::operator+=(const std::vector<WeightedEventNoTime> &more_ev
  * @return reference to this
  * */
 EventList &EventList::operator+=(const EventList &more_events) {
+  materializeRows();
+  ++m_histogramGeneration;
+  more_events.materializeRows();
   if (!more_events.empty()) {
     // We'll let the += operator for the given vector of event lists handle it
     switch (more_events.getEventType()) {
@@ -587,6 +725,9 @@ template <class T1, class T2> void EventList::minusHelper(std::vector<T1> &event
  * @return reference to this
  * */
 EventList &EventList::operator-=(const EventList &more_events) {
+  materializeRows();
+  ++m_histogramGeneration;
+  more_events.materializeRows();
   if (this == &more_events) {
     // Special case, ticket #3844 part 2.
     // When doing this = this - this,
@@ -660,6 +801,8 @@ bool vectorPtrEquals(const std::unique_ptr<std::vector<T>> &left, const std::uni
  * @return :: true if equal.
  */
 bool EventList::operator==(const EventList &rhs) const {
+  materializeRows();
+  rhs.materializeRows();
   if (this->getNumberEvents() != rhs.getNumberEvents())
     return false;
   if (this->eventType != rhs.eventType)
@@ -686,6 +829,8 @@ bool EventList::operator!=(const EventList &rhs) const { return (!this->operator
 
 bool EventList::equals(const EventList &rhs, const double tolTof, const double tolWeight,
                        const int64_t tolPulse) const {
+  materializeRows();
+  rhs.materializeRows();
   // generic checks
   if (this->getNumberEvents() != rhs.getNumberEvents())
     return false;
@@ -751,6 +896,9 @@ EventType EventList::getEventType() const { return eventType; }
  * WEIGHTED_NOTIME)
  */
 void EventList::switchTo(EventType newType) {
+  materializeRows();
+  // events are usually appended next with addEventQuickly()
+  ++m_histogramGeneration;
   switch (newType) {
   case TOF:
     if (eventType != TOF)
@@ -849,6 +997,7 @@ void EventList::switchToWeightedEventsNoTime() {
  * @return a WeightedEvent
  */
 WeightedEvent EventList::getEvent(size_t event_number) {
+  materializeRows();
   switch (eventType) {
   case TOF:
     return WeightedEvent(events->at(event_number));
@@ -875,6 +1024,7 @@ WeightedEvent EventList::getEvent(size_t event_number) {
  * @return a const reference to the list of non-weighted events
  * */
 const std::vector<TofEvent> &EventList::getEvents() const {
+  materializeRows();
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList that has weights. Use getWeightedEvents() "
                              "or getWeightedEventsNoTime().");
@@ -891,6 +1041,8 @@ const std::vector<TofEvent> &EventList::getEvents() const {
  * @return a reference to the list of non-weighted events
  * */
 std::vector<TofEvent> &EventList::getEvents() {
+  materializeRows();
+  ++m_histogramGeneration;
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList that has weights. Use getWeightedEvents() "
                              "or getWeightedEventsNoTime().");
@@ -908,6 +1060,8 @@ std::vector<TofEvent> &EventList::getEvents() {
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEvent> &EventList::getWeightedEvents() {
+  materializeRows();
+  ++m_histogramGeneration;
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an EventList not of type WeightedEvent. Use "
                              "getEvents() or getWeightedEventsNoTime().");
@@ -925,6 +1079,7 @@ std::vector<WeightedEvent> &EventList::getWeightedEvents() {
  * @return a const reference to the list of weighted events
  * */
 const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
+  materializeRows();
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an EventList not of type WeightedEvent. Use "
                              "getEvents() or getWeightedEventsNoTime().");
@@ -940,6 +1095,8 @@ const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
+  materializeRows();
+  ++m_histogramGeneration;
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for an EventList not of type "
                              "WeightedEventNoTime. Use getEvents() or getWeightedEvents().");
@@ -955,6 +1112,7 @@ std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
  * @return a const reference to the list of weighted events
  * */
 const std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() const {
+  materializeRows();
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for an EventList not of type "
                              "WeightedEventNoTime. Use getEvents() or getWeightedEvents().");
@@ -968,6 +1126,7 @@ const std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() con
  * associated detector ID's.
  * */
 void EventList::clear(const bool removeDetIDs) {
+  ++m_histogramGeneration;
   if (mru) {
     try {
       mru->deleteIndex(this);
@@ -977,6 +1136,7 @@ void EventList::clear(const bool removeDetIDs) {
   }
   // clear representations that aren't for the current type
   this->clearUnused();
+  this->setColumns(nullptr);
 
   // release unused memory or allocate new vector
   // rather than creating a new object, reset existing pointer
@@ -1031,6 +1191,9 @@ void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
  * @param num :: number of events that will be in this EventList
  */
 void EventList::reserve(size_t num) {
+  materializeRows();
+  // events are usually appended next with addEventQuickly()
+  ++m_histogramGeneration;
   switch (this->eventType) {
   case TOF:
     this->events->reserve(num);
@@ -1044,6 +1207,21 @@ void EventList::reserve(size_t num) {
   }
 }
 
+/// Return the number of events the list can hold without reallocating
+size_t EventList::capacity() const {
+  if (const auto lock = lockColumns())
+    return m_columns->tof.capacity();
+  switch (this->eventType) {
+  case TOF:
+    return this->events->capacity();
+  case WEIGHTED:
+    return this->weightedEvents->capacity();
+  case WEIGHTED_NOTIME:
+    return this->weightedEventsNoTime->capacity();
+  }
+  throw std::runtime_error("EventList: invalid event type value was found.");
+}
+
 // ==============================================================================================
 // --- Sorting functions -----------------------------------------------------
 // ==============================================================================================
@@ -1101,6 +1279,115 @@ template <class RandomIt, class Compare> void switchable_sort(RandomIt first, Ra
   else
     tbb::parallel_sort(first, last, comp);
 }
+
+// number of events handled by one task in each pass of the radix sort
+constexpr size_t RADIX_SORT_BLOCK_SIZE{65536};
+// the keys are sorted one byte at a time
+constexpr size_t RADIX_SORT_BUCKETS{256};
+
+/// Map a double onto an unsigned integer that sorts in the same order
+inline uint64_t radixKey(const double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  constexpr uint64_t signBit{uint64_t(1) << 63};
+  return (bits & signBit) ? ~bits : (bits | signBit);
+}
+
+/// Map a signed integer onto an unsigned integer that sorts in the same order
+inline uint64_t radixKey(const int64_t value) { return static_cast<uint64_t>(value) ^ (uint64_t(1) << 63); }
+
+/** Stable least-significant-digit radix sort on a 64 bit key.
+ * The events are split into blocks which are counted and scattered in
+ * parallel, so a single large list uses all the available threads. Bytes
+ * that are the same for every key (e.g. the high bytes of the pulse times
+ * of one run) do not need a pass and are skipped. A second vector the size
+ * of the input is needed while sorting.
+ * @param events :: the events to sort
+ * @param keyOf :: returns the unsigned sort key of an event
+ */
+template <typename T, typename KeyOf> void radixSort(std::vector<T> &events, KeyOf keyOf) {
+  const size_t numEvents = events.size();
+  const size_t numBlocks = (numEvents + RADIX_SORT_BLOCK_SIZE - 1) / RADIX_SORT_BLOCK_SIZE;
+  const auto blockEnd = [numEvents](const size_t block) {
+    return std::min(numEvents, (block + 1) * RADIX_SORT_BLOCK_SIZE);
+  };
+
+  // find which bits differ between keys
+  std::vector<uint64_t> blockOr(numBlocks, 0), blockAnd(numBlocks, ~uint64_t(0));
+  tbb::parallel_for(size_t(0), numBlocks, [&](const size_t block) {
+    for (size_t i = block * RADIX_SORT_BLOCK_SIZE; i < blockEnd(block); ++i) {
+      const uint64_t key = keyOf(events[i]);
+      blockOr[block] |= key;
+      blockAnd[block] &= key;
+    }
+  });
+  uint64_t keyOr{0}, keyAnd{~uint64_t(0)};
+  for (size_t block = 0; block < numBlocks; ++block) {
+    keyOr |= blockOr[block];
+    keyAnd &= blockAnd[block];
+  }
+  const uint64_t varyingBits = keyOr & ~keyAnd;
+  if (varyingBits == 0)
+    return;
+
+  std::vector<T> buffer(numEvents);
+  std::vector<size_t> offsets(numBlocks * RADIX_SORT_BUCKETS);
+  for (unsigned int shift = 0; shift < 64; shift += 8) {
+    if (((varyingBits >> shift) & 0xFF) == 0)
+      continue;
+    // count the digits in each block
+    std::fill(offsets.begin(), offsets.end(), 0);
+    tbb::parallel_for(size_t(0), numBlocks, [&](const size_t block) {
+      size_t *counts = offsets.data() + block * RADIX_SORT_BUCKETS;
+      for (size_t i = block * RADIX_SORT_BLOCK_SIZE; i < blockEnd(block); ++i)
+        ++counts[(keyOf(events[i]) >> shift) & 0xFF];
+    });
+    // turn the counts into output positions: by digit, then by block to keep the sort stable
+    size_t position{0};
+    for (size_t digit = 0; digit < RADIX_SORT_BUCKETS; ++digit) {
+      for (size_t block = 0; block < numBlocks; ++block) {
+        const size_t count = offsets[block * RADIX_SORT_BUCKETS + digit];
+        offsets[block * RADIX_SORT_BUCKETS + digit] = position;
+        position += count;
+      }
+    }
+    // scatter
+    tbb::parallel_for(size_t(0), numBlocks, [&](const size_t block) {
+      size_t *next = offsets.data() + block * RADIX_SORT_BUCKETS;
+      for (size_t i = block * RADIX_SORT_BLOCK_SIZE; i < blockEnd(block); ++i)
+        buffer[next[(keyOf(events[i]) >> shift) & 0xFF]++] = events[i];
+    });
+    events.swap(buffer);
+  }
+}
+
+/// Sort events by time-of-flight, with a radix sort for large lists
+template <typename T> void sortEventsByTof(std::vector<T> &events) {
+  if (events.size() < MIN_VEC_LENGTH_RADIX_SORT)
+    switchable_sort(events.begin(), events.end());
+  else
+    radixSort(events, [](const T &event) { return radixKey(event.tof()); });
+}
+
+/// Sort events by pulse time, with a radix sort for large lists
+template <typename T> void sortEventsByPulseTime(std::vector<T> &events) {
+  if (events.size() < MIN_VEC_LENGTH_RADIX_SORT)
+    switchable_sort(events.begin(), events.end(), compareEventPulseTime);
+  else
+    radixSort(events, [](const T &event) { return radixKey(event.pulseTime().totalNanoseconds()); });
+}
+
+/** Sort events by pulse time and then time-of-flight. Large lists are radix
+ * sorted by time-of-flight first, which the stable sort by pulse time keeps.
+ */
+template <typename T> void sortEventsByPulseTimeTof(std::vector<T> &events) {
+  if (events.size() < MIN_VEC_LENGTH_RADIX_SORT) {
+    switchable_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+  } else {
+    radixSort(events, [](const T &event) { return radixKey(event.tof()); });
+    radixSort(events, [](const T &event) { return radixKey(event.pulseTime().totalNanoseconds()); });
+  }
+}
 } // anonymous namespace
 
 // --------------------------------------------------------------------------
@@ -1116,15 +1403,21 @@ void EventList::sortTof() const {
   if (this->order == TOF_SORT) // cppcheck-suppress identicalConditionAfterEarlyExit
     return;
 
+  if (m_columns) {
+    m_columns->sortByTof();
+    this->order = TOF_SORT;
+    return;
+  }
+
   switch (eventType) {
   case TOF:
-    switchable_sort(events->begin(), events->end());
+    sortEventsByTof(*events);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents->begin(), weightedEvents->end());
+    sortEventsByTof(*weightedEvents);
     break;
   case WEIGHTED_NOTIME:
-    switchable_sort(weightedEventsNoTime->begin(), weightedEventsNoTime->end());
+    sortEventsByTof(*weightedEventsNoTime);
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1141,6 +1434,7 @@ void EventList::sortTof() const {
  * resort using forceResort = true. False by default.
  */
 void EventList::sortTimeAtSample(const double &tofFactor, const double &tofShift, bool forceResort) const {
+  materializeRows();
   // Check pre-cached sort flag.
   if (this->order == TIMEATSAMPLE_SORT && !forceResort)
     return;
@@ -1173,6 +1467,7 @@ void EventList::sortTimeAtSample(const double &tofFactor, const double &tofShift
 // --------------------------------------------------------------------------
 /** Sort events by Frame */
 void EventList::sortPulseTime() const {
+  materializeRows();
   if (this->order == PULSETIME_SORT || this->order == PULSETIMETOF_SORT)
     return; // nothing to do
 
@@ -1185,10 +1480,10 @@ void EventList::sortPulseTime() const {
   // Perform sort.
   switch (eventType) {
   case TOF:
-    switchable_sort(events->begin(), events->end(), compareEventPulseTime);
+    sortEventsByPulseTime(*events);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents->begin(), weightedEvents->end(), compareEventPulseTime);
+    sortEventsByPulseTime(*weightedEvents);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1203,6 +1498,7 @@ void EventList::sortPulseTime() const {
  * (the absolute time)
  */
 void EventList::sortPulseTimeTOF() const {
+  materializeRows();
   if (this->order == PULSETIMETOF_SORT)
     return; // already ordered
 
@@ -1214,10 +1510,10 @@ void EventList::sortPulseTimeTOF() const {
 
   switch (eventType) {
   case TOF:
-    switchable_sort(events->begin(), events->end(), compareEventPulseTimeTOF);
+    sortEventsByPulseTimeTof(*events);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents->begin(), weightedEvents->end(), compareEventPulseTimeTOF);
+    sortEventsByPulseTimeTof(*weightedEvents);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1236,6 +1532,7 @@ void EventList::sortPulseTimeTOF() const {
  * @param seconds The tolerance of pulse time in seconds.
  */
 void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start, const double seconds) const {
+  materializeRows();
   // Avoid sorting from multiple threads
   std::lock_guard<std::mutex> _lock(m_sortMutex);
 
@@ -1260,6 +1557,156 @@ void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start, con
 /** Return true if the event list is sorted by TOF */
 bool EventList::isSortedByTof() const { return (this->order == TOF_SORT); }
 
+// ==============================================================================================
+// --- Columnar storage -----------------------------------------------------
+// ==============================================================================================
+
+namespace {
+/// Move the events of one vector into the columns, releasing the vector memory
+template <class T> void moveEventsToColumns(std::unique_ptr<std::vector<T>> &events, EventColumns &columns) {
+  if (!events) {
+    events = std::make_unique<std::vector<T>>();
+    return;
+  }
+  columns.assign(*events);
+  std::vector<T>().swap(*events); // STL Trick to release memory
+}
+
+/// Rebuild one vector of events from the columns
+template <class T> void moveColumnsToEvents(EventColumns &columns, std::unique_ptr<std::vector<T>> &events) {
+  if (!events)
+    events = std::make_unique<std::vector<T>>();
+  columns.extract(*events);
+}
+} // anonymous namespace
+
+// --------------------------------------------------------------------------
+/** Switch the storage of the events between the usual vector of event
+ * structures and a structure-of-arrays (EventColumns) layout.
+ *
+ * In columnar storage, generateHistogram(), sortTof(), integrate(),
+ * convertTof(), getTofs() and the TOF min/max read only the arrays they need.
+ * Any other operation converts the list back to the usual storage first, so
+ * columnar storage is a performance hint and never changes results. The one
+ * exception is addEventQuickly(), which does not check: call reserve() or
+ * switchTo() before appending events to a columnar list.
+ *
+ * @param columnar :: true to store the events as columns
+ */
+void EventList::setColumnarStorage(const bool columnar) {
+  if (columnar == this->hasColumnarStorage())
+    return;
+  if (!columnar) {
+    this->materializeRows();
+    return;
+  }
+
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  auto columns = std::make_unique<EventColumns>();
+  switch (eventType) {
+  case TOF:
+    moveEventsToColumns(this->events, *columns);
+    break;
+  case WEIGHTED:
+    moveEventsToColumns(this->weightedEvents, *columns);
+    break;
+  case WEIGHTED_NOTIME:
+    moveEventsToColumns(this->weightedEventsNoTime, *columns);
+    break;
+  }
+  setColumns(std::move(columns));
+}
+
+/// Return true if the events are currently held in columnar storage
+bool EventList::hasColumnarStorage() const { return m_isColumnar.load(std::memory_order_acquire); }
+
+// --------------------------------------------------------------------------
+/** Store the pulse time of each event as an index into a table of pulse
+ * times, which is normally shared by all of the lists of a workspace, rather
+ * than as a DateAndTime. The list is switched to columnar storage first, and
+ * switched back if the pulse times cannot be compressed.
+ *
+ * filterByPulseTime(), generateHistogramPulseTime(), getPulseTimes() and the
+ * pulse time min/max work on the indices directly. As for columnar storage,
+ * any other operation restores the usual events first.
+ *
+ * @param pulseTable :: sorted unique pulse times in nanoseconds
+ * @return true if the pulse times are compressed. This is false for events
+ * without pulse times or if a pulse time is missing from the table.
+ */
+bool EventList::compressPulseTimes(const std::shared_ptr<const std::vector<int64_t>> &pulseTable) {
+  if (eventType == WEIGHTED_NOTIME)
+    return false;
+  const bool wasColumnar = this->hasColumnarStorage();
+  this->setColumnarStorage(true);
+  bool compressed;
+  {
+    std::lock_guard<std::mutex> _lock(m_sortMutex);
+    compressed = m_columns->compressPulseTimes(pulseTable);
+  }
+  // leave the storage as it was if nothing changed
+  if (!compressed && !wasColumnar)
+    this->setColumnarStorage(false);
+  return compressed;
+}
+
+/// Return true if the pulse times are held as indices into a shared table
+bool EventList::hasCompressedPulseTimes() const {
+  const auto lock = lockColumns();
+  return lock && m_columns->hasCompressedPulseTimes();
+}
+
+/** Replace the columnar storage and update the flag read by const methods.
+ * Must be called with m_sortMutex held if other threads may read the list.
+ * @param columns :: the new columns, or nullptr for row storage
+ */
+void EventList::setColumns(std::unique_ptr<EventColumns> columns) const {
+  m_columns = std::move(columns);
+  m_isColumnar.store(static_cast<bool>(m_columns), std::memory_order_release);
+}
+
+/** Lock the columnar storage for reading, so that no other thread converts
+ * the list back to rows while the columns are used.
+ * @return a lock on m_sortMutex that is held only if the list is columnar
+ */
+std::unique_lock<std::mutex> EventList::lockColumns() const {
+  if (!m_isColumnar.load(std::memory_order_acquire))
+    return {};
+  std::unique_lock<std::mutex> lock(m_sortMutex);
+  // Another thread may have converted the list while waiting for the lock
+  if (!m_columns)
+    lock.unlock();
+  return lock;
+}
+
+// --------------------------------------------------------------------------
+/** Convert the events back from columnar storage to the vector of events
+ * matching the current event type. Does nothing if the list is not columnar.
+ * Must not be called while m_sortMutex is held.
+ */
+void EventList::materializeRows() const {
+  if (!m_isColumnar.load(std::memory_order_acquire))
+    return;
+
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  // Another thread may have converted the list while waiting for the lock
+  if (!m_columns) // cppcheck-suppress identicalConditionAfterEarlyExit
+    return;
+
+  switch (eventType) {
+  case TOF:
+    moveColumnsToEvents(*m_columns, this->events);
+    break;
+  case WEIGHTED:
+    moveColumnsToEvents(*m_columns, this->weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    moveColumnsToEvents(*m_columns, this->weightedEventsNoTime);
+    break;
+  }
+  setColumns(nullptr);
+}
+
 // --------------------------------------------------------------------------
 /** Return the type of sorting used in this event list */
 EventSortType EventList::getSortType() const { return this->order; }
@@ -1276,7 +1723,9 @@ void EventList::reverse() {
   std::reverse(x.begin(), x.end());
 
   // flip the events if they are tof sorted
-  if (this->isSortedByTof()) {
+  if (this->isSortedByTof() && m_columns) {
+    m_columns->reverse();
+  } else if (this->isSortedByTof()) {
     switch (eventType) {
     case TOF:
       std::reverse(this->events->begin(), this->events->end());
@@ -1302,6 +1751,8 @@ void EventList::reverse() {
  * @return the number of events in the list.
  *  */
 size_t EventList::getNumberEvents() const {
+  if (const auto lock = lockColumns())
+    return m_columns->size();
   switch (eventType) {
   case TOF:
     return (this->events) ? this->events->size() : 0;
@@ -1317,6 +1768,8 @@ size_t EventList::getNumberEvents() const {
  * Much like stl containers, returns true if there is nothing in the event list.
  */
 bool EventList::empty() const {
+  if (const auto lock = lockColumns())
+    return m_columns->empty();
   switch (eventType) {
   case TOF:
     if (this->events)
@@ -1345,6 +1798,8 @@ bool EventList::empty() const {
  * @return :: the memory used by the EventList, in bytes.
  * */
 size_t EventList::getMemorySize() const {
+  if (const auto lock = lockColumns())
+    return m_columns->getMemorySize() + sizeof(EventList);
   switch (eventType) {
   case TOF:
     return this->events->capacity() * sizeof(TofEvent) + sizeof(EventList);
@@ -1378,16 +1833,14 @@ size_t EventList::histogram_size() const {
  */
 void EventList::setX(const Kernel::cow_ptr<HistogramData::HistogramX> &X) {
   m_histogram.setX(X);
-  if (mru)
-    mru->deleteIndex(this);
+  ++m_histogramGeneration;
 }
 
 /** Deprecated, use mutableX() instead. Returns a reference to the x data.
  *  @return a reference to the X (bin) vector.
  */
 MantidVec &EventList::dataX() {
-  if (mru)
-    mru->deleteIndex(this);
+  ++m_histogramGeneration;
   return m_histogram.dataX();
 }
 
@@ -1478,14 +1931,14 @@ const HistogramData::HistogramE &EventList::e() const {
 }
 Kernel::cow_ptr<HistogramData::HistogramY> EventList::sharedY() const {
   // This is the thread number from which this function was called.
-  const int thread = PARALLEL_THREAD_NUMBER;
+  const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
 
   Kernel::cow_ptr<HistogramData::HistogramY> yData(nullptr);
 
   // Is the data in the mrulist?
   if (mru) {
-    mru->ensureEnoughBuffersY(static_cast<size_t>(thread));
-    yData = mru->findY(static_cast<size_t>(thread), this);
+    mru->ensureEnoughBuffers(thread);
+    yData = mru->findY(thread, this, m_histogramGeneration);
   }
 
   if (!yData) {
@@ -1496,13 +1949,10 @@ Kernel::cow_ptr<HistogramData::HistogramY> EventList::sharedY() const {
     // Create the MRU object
     yData = Kernel::make_cow<HistogramData::HistogramY>(std::move(Y));
 
-    // Lets save it in the MRU
-    if (mru) {
-      mru->insertY(thread, yData, this);
-      auto eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
-      mru->ensureEnoughBuffersE(thread);
-      mru->insertE(thread, eData, this);
-    }
+    // Lets save it in the MRU, along with E which was generated at the same time
+    if (mru)
+      mru->insert(thread, yData, Kernel::make_cow<HistogramData::HistogramE>(std::move(E)), this,
+                  m_histogramGeneration);
   }
   return yData;
 }
@@ -1514,20 +1964,20 @@ Kernel::cow_ptr<HistogramData::HistogramE> EventList::sharedE() const {
 
   // Is the data in the mrulist?
   if (mru) {
-    mru->ensureEnoughBuffersE(thread);
-    eData = mru->findE(thread, this);
+    mru->ensureEnoughBuffers(thread);
+    eData = mru->findE(thread, this, m_histogramGeneration);
   }
 
   if (!eData) {
-    // Now use that to get E -- Y values are generated from another function
-    MantidVec Y_ignored;
+    MantidVec Y;
     MantidVec E;
-    this->generateHistogram(readX(), Y_ignored, E);
+    this->generateHistogram(readX(), Y, E);
     eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
 
-    // Lets save it in the MRU
+    // Lets save it in the MRU, along with Y which was generated at the same time
     if (mru)
-      mru->insertE(thread, eData, this);
+      mru->insert(thread, Kernel::make_cow<HistogramData::HistogramY>(std::move(Y)), eData, this,
+                  m_histogramGeneration);
   }
   return eData;
 }
@@ -1831,6 +2281,9 @@ inline void EventList::compressFatEventsHelper(const std::vector<T> &events, std
  *be == this.
  */
 void EventList::compressEvents(double tolerance, EventList *destination) {
+  materializeRows();
+  destination->materializeRows();
+  ++destination->m_histogramGeneration;
   if (this->empty()) {
     // allocate memory in correct vector
     if (eventType != WEIGHTED_NOTIME)
@@ -1928,6 +2381,9 @@ inline void EventList::processWeightedEvents(const std::vector<T> &events, std::
 
 void EventList::compressEvents(double tolerance, EventList *destination,
                                const std::shared_ptr<std::vector<double>> histogram_bin_edges) {
+  materializeRows();
+  destination->materializeRows();
+  ++destination->m_histogramGeneration;
   if (this->empty()) {
     // allocate memory in correct vector
     if (eventType != WEIGHTED_NOTIME)
@@ -1990,6 +2446,9 @@ void EventList::compressEvents(double tolerance, EventList *destination,
 
 void EventList::compressFatEvents(const double tolerance, const Mantid::Types::Core::DateAndTime &timeStart,
                                   const double seconds, EventList *destination) {
+  materializeRows();
+  destination->materializeRows();
+  ++destination->m_histogramGeneration;
   if (this->empty()) {
     // allocate memory in correct vector
     if (eventType != WEIGHTED)
@@ -2144,57 +2603,22 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events, const Ma
     std::fill(E.begin(), E.end(), 0.0);
   }
 
-  //---------------------- Histogram without weights
-  //---------------------------------
-
-  // Do we even have any events to do?
+  // Add up the weights of each run of events (sorted by tof) falling in a bin. Convert to double before adding, to
+  // preserve precision
   if (!events.empty()) {
-    // Iterate through all events (sorted by tof)
-    auto itev = findFirstEvent(events, T(X[0]));
-    auto itev_end = events.cend();
-    // The above can still take you to end() if no events above X[0], so check
-    // again.
-    if (itev == itev_end)
-      return;
-
-    // Find the first bin
-    size_t bin = 0;
-    // The tof is greater the first bin boundary, so we need to find the first
-    // bin
-    double tof = itev->tof();
-    while (bin < x_size - 1) {
-      // Within range?
-      if ((tof >= X[bin]) && (tof < X[bin + 1])) {
-        // Add up the weight (convert to double before adding, to preserve
-        // precision)
-        Y[bin] += double(itev->m_weight);
-        E[bin] += double(itev->m_errorSquared); // square of error
-        break;
-      }
-      ++bin;
-    }
-    // Go to the next event, we've already binned this first one.
-    ++itev;
-
-    // Keep going through all the events
-    while ((itev != itev_end) && (bin < x_size - 1)) {
-      tof = itev->tof();
-      while (bin < x_size - 1) {
-        // Within range? Since both events and X are sorted, they are going to
-        // have
-        // tof >= X[bin] because the previous event was.
-        if (tof < X[bin + 1]) {
-          // Add up the weight (convert to double before adding, to preserve
-          // precision)
-          Y[bin] += double(itev->m_weight);
-          E[bin] += double(itev->m_errorSquared); // square of error
-          break;
-        }
-        ++bin;
-      }
-      ++itev;
-    }
-  } // end if (there are any events to histogram)
+    histogramSorted(
+        events.size(), X, [&events](const size_t i) { return events[i].tof(); },
+        [&events, &Y, &E](const size_t bin, const size_t first, const size_t last) {
+          double weight = 0.;
+          double errorSquared = 0.;
+          for (size_t i = first; i < last; ++i) {
+            weight += double(events[i].m_weight);
+            errorSquared += double(events[i].m_errorSquared); // square of error
+          }
+          Y[bin] += weight;
+          E[bin] += errorSquared;
+        });
+  }
 
   // Now do the sqrt of all errors
   std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
@@ -2238,26 +2662,129 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events, const do
   if (events.empty())
     return;
 
-  const auto xmin = X.front();
-  const auto xmax = X.back();
+  histogramByStep(
+      events.size(), step, X, [&events](const size_t i) { return events[i].tof(); },
+      [&events, &Y, &E](const size_t bin, const size_t i) {
+        Y[bin] += events[i].weight();
+        E[bin] += events[i].errorSquared();
+      });
 
-  auto findBin = FindBin(step, xmin);
+  // Now do the sqrt of all errors
+  std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+}
 
-  for (const T &ev : events) {
-    const double tof = ev.tof();
-    if (tof < xmin || tof >= xmax)
-      continue;
+namespace {
+/** Histogram events held in columns. When step is not set the events must be
+ * sorted by TOF, otherwise the bin is computed from the linear or logarithmic
+ * step. Only the tof column, plus the weight columns for weighted events, is
+ * read.
+ *
+ * @param columns :: the events
+ * @param X :: x-bins supplied
+ * @param Y :: counts (or summed weights) returned
+ * @param E :: summed squared errors returned, if weighted
+ * @param step :: bin step size, for unsorted histogramming
+ */
+template <bool Weighted>
+void histogramColumnsHelper(const EventColumns &columns, const MantidVec &X, MantidVec &Y, MantidVec &E,
+                            const std::optional<double> step) {
+  const auto &tofs = columns.tof;
+  const auto tofAt = [&tofs](const size_t i) { return tofs[i]; };
+
+  if (step) {
+    histogramByStep(tofs.size(), step.value(), X, tofAt, [&columns, &Y, &E](const size_t bin, const size_t i) {
+      if constexpr (Weighted) {
+        Y[bin] += columns.weight[i];
+        E[bin] += columns.errorSquared[i];
+      } else {
+        ++Y[bin];
+      }
+    });
+    return;
+  }
 
-    std::optional<size_t> n_bin = findBin(X, tof, true);
+  histogramSorted(tofs.size(), X, tofAt, [&columns, &Y, &E](const size_t bin, const size_t first, const size_t last) {
+    if constexpr (Weighted) {
+      double weight = 0.;
+      double errorSquared = 0.;
+      for (size_t i = first; i < last; ++i) {
+        weight += columns.weight[i];
+        errorSquared += columns.errorSquared[i];
+      }
+      Y[bin] += weight;
+      E[bin] += errorSquared;
+    } else {
+      Y[bin] += static_cast<double>(last - first);
+    }
+  });
+}
 
-    if (n_bin) {
-      Y[n_bin.value()] += ev.weight();
-      E[n_bin.value()] += ev.errorSquared();
+/** Sum the weights of events held in columns that are sorted by TOF.
+ *
+ * @param columns :: the events
+ * @param weighted :: true if the weight columns are populated
+ * @param minX :: minimum X bin to use in integrating.
+ * @param maxX :: maximum X bin to use in integrating.
+ * @param entireRange :: set to true to use the entire range.
+ * @param sum :: reference to a double to put the sum in.
+ * @param error :: reference to a double to put the error in.
+ */
+void integrateColumnsHelper(const EventColumns &columns, const bool weighted, const double minX, const double maxX,
+                            const bool entireRange, double &sum, double &error) {
+  sum = 0;
+  error = 0;
+  const auto &tofs = columns.tof;
+  auto low = tofs.cbegin();
+  auto high = tofs.cend();
+  if (!entireRange) {
+    if (maxX < minX)
+      return;
+    low = std::lower_bound(tofs.cbegin(), tofs.cend(), minX);
+    high = std::upper_bound(low, tofs.cend(), maxX);
+  }
+  const auto first = static_cast<size_t>(std::distance(tofs.cbegin(), low));
+  const auto last = static_cast<size_t>(std::distance(tofs.cbegin(), high));
+
+  if (weighted) {
+    for (size_t i = first; i < last; ++i) {
+      sum += columns.weight[i];
+      error += columns.errorSquared[i];
     }
+  } else {
+    sum = static_cast<double>(last - first);
+    error = sum;
   }
+  error = std::sqrt(error);
+}
+} // anonymous namespace
 
-  // Now do the sqrt of all errors
-  std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+// --------------------------------------------------------------------------
+/** Generates the Y and E histograms from the columnar storage of the events.
+ *
+ * @param X: x-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error for unweighted events
+ * @param step: bin step size if histogramming unsorted events
+ */
+void EventList::generateHistogramFromColumns(const MantidVec &X, MantidVec &Y, MantidVec &E, const bool skipError,
+                                             const std::optional<double> step) const {
+  if (X.size() <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  Y.assign(X.size() - 1, 0.0);
+
+  if (eventType == TOF) {
+    histogramColumnsHelper<false>(*m_columns, X, Y, E, step);
+    if (!skipError)
+      this->generateErrorsHistogram(Y, E);
+  } else {
+    E.assign(X.size() - 1, 0.0);
+    histogramColumnsHelper<true>(*m_columns, X, Y, E, step);
+    std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+  }
 }
 
 // --------------------------------------------------------------------------
@@ -2271,6 +2798,25 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events, const do
  *        events; you can just ignore the returned E vector.
  */
 void EventList::generateHistogramPulseTime(const MantidVec &X, MantidVec &Y, MantidVec &E, bool skipError) const {
+  if (const auto lock = lockColumns(); lock && eventType == TOF) {
+    if (X.size() <= 1) {
+      // X was not set. Return an empty array.
+      Y.resize(0, 0);
+      return;
+    }
+    Y.assign(X.size() - 1, 0.0);
+    // search for the bin of each event rather than sorting the columns by pulse time
+    for (size_t i = 0; i < m_columns->size(); ++i) {
+      const auto upper = std::upper_bound(X.cbegin(), X.cend(), static_cast<double>(m_columns->pulseTimeAt(i)));
+      if (upper != X.cbegin() && upper != X.cend())
+        ++Y[std::distance(X.cbegin(), upper) - 1];
+    }
+    if (!skipError)
+      this->generateErrorsHistogram(Y, E);
+    return;
+  }
+
+  materializeRows();
   // All types of weights need to be sorted by Pulse Time
   this->sortPulseTime();
 
@@ -2304,6 +2850,7 @@ void EventList::generateHistogramPulseTime(const MantidVec &X, MantidVec &Y, Man
  */
 void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y, MantidVec &E, const double &tofFactor,
                                               const double &tofOffset, bool skipError) const {
+  materializeRows();
   // All types of weights need to be sorted by time at sample
   this->sortTimeAtSample(tofFactor, tofOffset);
 
@@ -2339,6 +2886,9 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E
 
   this->sortTof();
 
+  if (const auto lock = lockColumns())
+    return generateHistogramFromColumns(X, Y, E, skipError, std::nullopt);
+
   switch (eventType) {
   case TOF:
     // Make the single ones
@@ -2378,6 +2928,9 @@ void EventList::generateHistogram(const double step, const MantidVec &X, MantidV
   if (isSortedByTof() || empty())
     return generateHistogram(X, Y, E, skipError);
 
+  if (const auto lock = lockColumns())
+    return generateHistogramFromColumns(X, Y, E, skipError, step);
+
   switch (eventType) {
   case TOF:
     this->generateCountsHistogram(step, X, Y);
@@ -2403,6 +2956,7 @@ void EventList::generateHistogram(const double step, const MantidVec &X, MantidV
  * @param Y :: The generated counts histogram
  */
 void EventList::generateCountsHistogramPulseTime(const MantidVec &X, MantidVec &Y) const {
+  materializeRows();
   // For slight speed=up.
   size_t x_size = X.size();
 
@@ -2478,6 +3032,7 @@ void EventList::generateCountsHistogramPulseTime(const MantidVec &X, MantidVec &
  */
 void EventList::generateCountsHistogramPulseTime(const double &xMin, const double &xMax, MantidVec &Y,
                                                  const double TOF_min, const double TOF_max) const {
+  materializeRows();
 
   if (this->events->empty())
     return;
@@ -2593,23 +3148,11 @@ void EventList::generateCountsHistogram(const MantidVec &X, MantidVec &Y) const
   //---------------------- Histogram without weights
   //---------------------------------
 
-  // Do we even have any events to do?
-  if (!this->events->empty()) {
-    // Iterate through all events (sorted by tof) placing them in the correct
-    // bin.
-    auto itev = findFirstEvent(*this->events, TofEvent(X[0]));
-    const auto itend = this->events->end();
-    // Go through all the events,
-    for (auto itx = X.cbegin(); itev != itend; ++itev) {
-      const double tof = itev->tof();
-      itx = std::find_if(itx, X.cend(), [tof](const double x) { return tof < x; });
-      if (itx == X.cend()) {
-        break;
-      }
-      const auto bin = static_cast<size_t>(std::max(std::distance(X.cbegin(), itx) - 1, std::ptrdiff_t{0}));
-      ++Y[bin];
-    }
-  } // end if (there are any events to histogram)
+  // Count the runs of events (sorted by tof) falling in each bin
+  const auto &tofEvents = *this->events;
+  histogramSorted(
+      tofEvents.size(), X, [&tofEvents](const size_t i) { return tofEvents[i].tof(); },
+      [&Y](const size_t bin, const size_t first, const size_t last) { Y[bin] += static_cast<double>(last - first); });
 }
 
 /** Find the bin which this TOF value falls in with linear binning, assumes TOF is in range of X
@@ -2710,21 +3253,10 @@ void EventList::generateCountsHistogram(const double step, const MantidVec &X, M
   if (this->events->empty())
     return;
 
-  const auto xmin = X.front();
-  const auto xmax = X.back();
-
-  auto findBin = FindBin(step, xmin);
-
-  for (const TofEvent &ev : *this->events) {
-    const double tof = ev.tof();
-    if (tof < xmin || tof >= xmax)
-      continue;
-
-    const std::optional<size_t> n_bin = findBin(X, tof, true);
-
-    if (n_bin)
-      Y[n_bin.value()]++;
-  }
+  const auto &tofEvents = *this->events;
+  histogramByStep(
+      tofEvents.size(), step, X, [&tofEvents](const size_t i) { return tofEvents[i].tof(); },
+      [&Y](const size_t bin, const size_t) { ++Y[bin]; });
 }
 
 // --------------------------------------------------------------------------
@@ -2823,6 +3355,11 @@ void EventList::integrate(const double minX, const double maxX, const bool entir
     this->sortTof();
   }
 
+  if (const auto lock = lockColumns()) {
+    integrateColumnsHelper(*m_columns, eventType != TOF, minX, maxX, entireRange, sum, error);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2865,6 +3402,11 @@ void EventList::convertTof(std::function<double(double)> func, const int sorting
   if (this->getNumberEvents() == 0)
     return;
 
+  if (m_columns) {
+    std::transform(m_columns->tof.cbegin(), m_columns->tof.cend(), m_columns->tof.begin(), func);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2907,6 +3449,13 @@ void EventList::convertTof(const double factor, const double offset) {
   if (this->getNumberEvents() == 0)
     return;
 
+  if (m_columns) {
+    // contiguous doubles, so this loop is auto-vectorised
+    for (auto &tof : m_columns->tof)
+      tof = tof * factor + offset;
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2986,6 +3535,7 @@ template <class T> void EventList::addPulsetimesHelper(std::vector<T> &events, c
  * @param seconds :: The value to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetime(const double seconds) {
+  materializeRows();
   if (this->getNumberEvents() == 0)
     return;
 
@@ -3011,6 +3561,7 @@ void EventList::addPulsetime(const double seconds) {
  * @param seconds :: A set of values to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetimes(const std::vector<double> &seconds) {
+  materializeRows();
   if (this->getNumberEvents() == 0)
     return;
   if (this->getNumberEvents() != seconds.size()) {
@@ -3079,6 +3630,8 @@ std::size_t EventList::maskTofHelper(std::vector<T> &events, const double tofMin
  * @param tofMax :: upper bound of TOF to filter out
  */
 void EventList::maskTof(const double tofMin, const double tofMax) {
+  materializeRows();
+  ++m_histogramGeneration;
   if (tofMax <= tofMin)
     throw std::runtime_error("EventList::maskTof: tofMax must be > tofMin");
 
@@ -3147,6 +3700,8 @@ template <class T> std::size_t EventList::maskConditionHelper(std::vector<T> &ev
  * @param mask :: condition vector
  */
 void EventList::maskCondition(const std::vector<bool> &mask) {
+  materializeRows();
+  ++m_histogramGeneration;
 
   // mask size must match the number of events
   if (this->getNumberEvents() != mask.size())
@@ -3194,6 +3749,11 @@ template <class T> void EventList::getTofsHelper(const std::vector<T> &events, s
  *  @param tofs :: A reference to the vector to be filled
  */
 void EventList::getTofs(std::vector<double> &tofs) const {
+  if (const auto lock = lockColumns()) {
+    tofs.assign(m_columns->tof.cbegin(), m_columns->tof.cend());
+    return;
+  }
+
   // Set the capacity of the vector to avoid multiple resizes
   tofs.reserve(this->getNumberEvents());
 
@@ -3238,6 +3798,7 @@ template <class T> void EventList::getWeightsHelper(const std::vector<T> &events
  *  @param weights :: A reference to the vector to be filled
  */
 void EventList::getWeights(std::vector<double> &weights) const {
+  materializeRows();
   // Set the capacity of the vector to avoid multiple resizes
   weights.reserve(this->getNumberEvents());
 
@@ -3261,6 +3822,7 @@ void EventList::getWeights(std::vector<double> &weights) const {
  * @return by copy a vector of doubles of the weight() value
  */
 std::vector<double> EventList::getWeights() const {
+  materializeRows();
   std::vector<double> weights;
   this->getWeights(weights);
   return weights;
@@ -3284,6 +3846,7 @@ void EventList::getWeightErrorsHelper(const std::vector<T> &events, std::vector<
  *  @param weightErrors :: A reference to the vector to be filled
  */
 void EventList::getWeightErrors(std::vector<double> &weightErrors) const {
+  materializeRows();
   // Set the capacity of the vector to avoid multiple resizes
   weightErrors.reserve(this->getNumberEvents());
 
@@ -3307,6 +3870,7 @@ void EventList::getWeightErrors(std::vector<double> &weightErrors) const {
  * @return by copy a vector of doubles of the weight() value
  */
 std::vector<double> EventList::getWeightErrors() const {
+  materializeRows();
   std::vector<double> weightErrors;
   this->getWeightErrors(weightErrors);
   return weightErrors;
@@ -3319,6 +3883,7 @@ std::vector<double> EventList::getWeightErrors() const {
  */
 template <typename UnaryOperation>
 std::vector<DateAndTime> EventList::eventTimesCalculator(const UnaryOperation &timesCalc) const {
+  materializeRows();
   std::vector<DateAndTime> times;
   switch (eventType) {
   case TOF:
@@ -3342,6 +3907,13 @@ std::vector<DateAndTime> EventList::eventTimesCalculator(const UnaryOperation &t
  * @return by copy a vector of DateAndTime times
  */
 std::vector<Mantid::Types::Core::DateAndTime> EventList::getPulseTimes() const {
+  if (const auto lock = lockColumns(); lock && eventType != WEIGHTED_NOTIME) {
+    std::vector<DateAndTime> times;
+    times.reserve(m_columns->size());
+    for (size_t i = 0; i < m_columns->size(); ++i)
+      times.emplace_back(m_columns->pulseTimeAt(i));
+    return times;
+  }
   auto timeCalc = [](const auto &event) { return event.pulseTime(); };
   return eventTimesCalculator(timeCalc);
 }
@@ -3388,6 +3960,10 @@ double EventList::getTofMin() const {
   if (this->empty())
     return tMin;
 
+  if (const auto lock = lockColumns())
+    return (this->order == TOF_SORT) ? m_columns->tof.front()
+                                     : *std::min_element(m_columns->tof.cbegin(), m_columns->tof.cend());
+
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
@@ -3430,6 +4006,10 @@ double EventList::getTofMax() const {
   if (this->empty())
     return tMax;
 
+  if (const auto lock = lockColumns())
+    return (this->order == TOF_SORT) ? m_columns->tof.back()
+                                     : *std::max_element(m_columns->tof.cbegin(), m_columns->tof.cend());
+
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
@@ -3482,6 +4062,12 @@ template <class T> DateAndTime getPulseMaximumHelper(const std::vector<T> &event
  * @return The minimum tof value for the list of the events.
  */
 DateAndTime EventList::getPulseTimeMin() const {
+  if (hasColumnarStorage() && eventType != WEIGHTED_NOTIME) {
+    DateAndTime tMin, tMax;
+    this->getPulseTimeMinMax(tMin, tMax);
+    return tMin;
+  }
+  materializeRows();
   // no events is a soft error
   if (this->empty())
     return DateAndTime::maximum();
@@ -3515,6 +4101,12 @@ DateAndTime EventList::getPulseTimeMin() const {
  * @return The maximum tof value for the list of events.
  */
 DateAndTime EventList::getPulseTimeMax() const {
+  if (hasColumnarStorage() && eventType != WEIGHTED_NOTIME) {
+    DateAndTime tMin, tMax;
+    this->getPulseTimeMinMax(tMin, tMax);
+    return tMax;
+  }
+  materializeRows();
   // no events is a soft error
   if (this->empty())
     return DateAndTime::minimum();
@@ -3546,6 +4138,15 @@ DateAndTime EventList::getPulseTimeMax() const {
 
 void EventList::getPulseTimeMinMax(Mantid::Types::Core::DateAndTime &tMin,
                                    Mantid::Types::Core::DateAndTime &tMax) const {
+  if (const auto lock = lockColumns(); lock && eventType != WEIGHTED_NOTIME) {
+    int64_t first = DateAndTime::maximum().totalNanoseconds();
+    int64_t last = DateAndTime::minimum().totalNanoseconds();
+    m_columns->getPulseTimeMinMax(first, last);
+    tMin = DateAndTime(first);
+    tMax = DateAndTime(last);
+    return;
+  }
+  materializeRows();
   // set up as the minimum available date time.
   tMax = DateAndTime::minimum();
   tMin = DateAndTime::maximum();
@@ -3596,6 +4197,7 @@ void EventList::getPulseTimeMinMax(Mantid::Types::Core::DateAndTime &tMin,
 }
 
 DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor, const double &tofOffset) const {
+  materializeRows();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3637,6 +4239,7 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor, const double
 }
 
 DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor, const double &tofOffset) const {
+  materializeRows();
   // set up as the minimum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3702,6 +4305,8 @@ template <class T> void EventList::setTofsHelper(std::vector<T> &events, const s
  * @param tofs :: The vector of doubles to set the tofs to.
  */
 void EventList::setTofs(const MantidVec &tofs) {
+  materializeRows();
+  ++m_histogramGeneration;
   this->order = UNSORTED;
 
   // Convert the list
@@ -3766,6 +4371,7 @@ template <class T> void EventList::multiplyHelper(std::vector<T> &events, const
  * @return reference to this
  */
 EventList &EventList::operator*=(const double value) {
+  materializeRows();
   this->multiply(value);
   return *this;
 }
@@ -3800,6 +4406,8 @@ EventList &EventList::operator*=(const double value) {
  * @param error: error on 'value'. Can be 0.
  */
 void EventList::multiply(const double value, const double error) {
+  materializeRows();
+  ++m_histogramGeneration;
   // Do nothing if multiplying by exactly one and there is no error
   if ((value == 1.0) && (error == 0.0))
     return;
@@ -3925,6 +4533,8 @@ void EventList::multiplyHistogramHelper(std::vector<T> &events, const MantidVec
  * @throw invalid_argument if the sizes of X, Y, E are not consistent.
  */
 void EventList::multiply(const MantidVec &X, const MantidVec &Y, const MantidVec &E) {
+  materializeRows();
+  ++m_histogramGeneration;
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -4062,6 +4672,8 @@ void EventList::divideHistogramHelper(std::vector<T> &events, const MantidVec &X
  * @throw invalid_argument if the sizes of X, Y, E are not consistent.
  */
 void EventList::divide(const MantidVec &X, const MantidVec &Y, const MantidVec &E) {
+  materializeRows();
+  ++m_histogramGeneration;
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -4092,6 +4704,8 @@ void EventList::divide(const MantidVec &X, const MantidVec &Y, const MantidVec &
  * @throw std::invalid_argument if value == 0; cannot divide by zero.
  */
 EventList &EventList::operator/=(const double value) {
+  materializeRows();
+  ++m_histogramGeneration;
   if (value == 0.0)
     throw std::invalid_argument("EventList::divide() called with value of 0.0. Cannot divide by zero.");
   this->multiply(1.0 / value, 0.0);
@@ -4109,6 +4723,8 @@ EventList &EventList::operator/=(const double value) {
  * @throw std::invalid_argument if value == 0; cannot divide by zero.
  */
 void EventList::divide(const double value, const double error) {
+  materializeRows();
+  ++m_histogramGeneration;
   if (value == 0.0)
     throw std::invalid_argument("EventList::divide() called with value of 0.0. Cannot divide by zero.");
   // Do nothing if dividing by exactly 1.0, no error
@@ -4142,6 +4758,21 @@ void EventList::filterByPulseTime(Types::Core::DateAndTime start, Types::Core::D
     throw std::invalid_argument("In-place filtering is not allowed");
   }
 
+  if (auto lock = lockColumns(); lock && eventType != WEIGHTED_NOTIME) {
+    // filter the columns as they are, which keeps the order and any compression of the pulse times
+    auto columns = std::make_unique<EventColumns>();
+    m_columns->filterByPulseTime(start.totalNanoseconds(), stop.totalNanoseconds(), *columns);
+    output.clear();
+    output.switchTo(eventType);
+    output.setDetectorIDs(this->getDetectorIDs());
+    output.setHistogram(m_histogram);
+    output.setColumns(std::move(columns));
+    output.setSortOrder(this->order);
+    return;
+  }
+
+  materializeRows();
+
   // Start by sorting the event list by pulse time.
   this->sortPulseTime();
   // Clear the output
@@ -4180,6 +4811,7 @@ void EventList::filterByPulseTime(Types::Core::DateAndTime start, Types::Core::D
  * @throws std::invalid_argument If output is a reference to this EventList
  */
 void EventList::filterByPulseTime(Kernel::TimeROI const *timeRoi, EventList *output) const {
+  materializeRows();
 
   this->sortPulseTime();
   // Clear the output
@@ -4276,6 +4908,8 @@ void EventList::filterByTimeROIHelper(std::vector<T> &events, const std::vector<
  * @param timeRoi :: a TimeROI that will be used to filter events
  */
 void EventList::filterInPlace(Kernel::TimeROI const *timeRoi) {
+  materializeRows();
+  ++m_histogramGeneration;
   if (timeRoi == nullptr) {
     throw std::runtime_error("TimeROI can not be a nullptr\n");
   }
@@ -4389,6 +5023,7 @@ void EventList::filterInPlaceHelper(Kernel::TimeROI const *timeRoi, typename std
  * @param partials : resulting partial lists of events after splitting's done
  */
 void EventList::initializePartials(std::map<int, EventList *> partials) const {
+  materializeRows();
 
   // collect the state from events which is to be transferred to the partials
   bool removeDetIDs{true};
@@ -4456,11 +5091,20 @@ void getEventsFrom(const EventList &el, std::vector<WeightedEventNoTime> const *
 template <class T>
 void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events, Mantid::Kernel::Unit const *fromUnit,
                                          Mantid::Kernel::Unit const *toUnit) {
-  for (auto &itev : events) {
-    // Conver to TOF
-    const double tof = fromUnit->singleToTOF(itev.m_tof);
-    // And back from TOF to whatever
-    itev.m_tof = toUnit->singleFromTOF(tof);
+  // The events are not contiguous doubles, so convert them a block at a time
+  // through a buffer to make one virtual call per block rather than per event
+  constexpr size_t blockSize = 1024;
+  std::array<double, blockSize> buffer;
+  for (size_t start = 0; start < events.size(); start += blockSize) {
+    const size_t count = std::min(blockSize, events.size() - start);
+    const auto block = std::span<double>(buffer.data(), count);
+    for (size_t i = 0; i < count; ++i)
+      block[i] = events[start + i].m_tof;
+    // Convert to TOF and back from TOF to whatever
+    fromUnit->batchToTOF(block);
+    toUnit->batchFromTOF(block);
+    for (size_t i = 0; i < count; ++i)
+      events[start + i].m_tof = block[i];
   }
 }
 
@@ -4473,6 +5117,7 @@ void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events, Mantid
  * @param toUnit :: the Unit describing the output unit. Must be initialized.
  */
 void EventList::convertUnitsViaTof(Mantid::Kernel::Unit const *fromUnit, Mantid::Kernel::Unit const *toUnit) {
+  ++m_histogramGeneration;
   // Check for initialized
   if (!fromUnit || !toUnit)
     throw std::runtime_error("EventList::convertUnitsViaTof(): one of the units is NULL!");
@@ -4481,6 +5126,12 @@ void EventList::convertUnitsViaTof(Mantid::Kernel::Unit const *fromUnit, Mantid:
   if (!toUnit->isInitialized())
     throw std::runtime_error("EventList::convertUnitsViaTof(): toUnit is not initialized!");
 
+  if (m_columns) {
+    fromUnit->batchToTOF(m_columns->tof);
+    toUnit->batchFromTOF(m_columns->tof);
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     convertUnitsViaTofHelper(*this->events, fromUnit, toUnit);
@@ -4494,6 +5145,48 @@ void EventList::convertUnitsViaTof(Mantid::Kernel::Unit const *fromUnit, Mantid:
   }
 }
 
+/** Helper function for the closed-form conversion. This handles the different
+ *  event types.
+ *
+ * @param events the list of events
+ * @param conversion the conversion to apply to each event
+ */
+template <class T>
+void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events,
+                                         const Mantid::Kernel::ClosedFormConversion &conversion) {
+  for (auto &event : events)
+    event.m_tof = conversion(event.m_tof);
+}
+
+//--------------------------------------------------------------------------
+/** Converts the X units in each event with a conversion that has been reduced
+ * to a closed form, e.g. by composing Unit::closedFormToTOF() and
+ * Unit::closedFormFromTOF(). As for the overload taking the units, the X
+ * values and the order of the events are left alone.
+ *
+ * @param conversion :: the conversion to apply to each event
+ */
+void EventList::convertUnitsViaTof(const Mantid::Kernel::ClosedFormConversion &conversion) {
+  ++m_histogramGeneration;
+  if (m_columns) {
+    // contiguous doubles, so there is no need to go back to the event structures
+    conversion.apply(m_columns->tof.data(), m_columns->tof.data() + m_columns->tof.size());
+    return;
+  }
+
+  switch (eventType) {
+  case TOF:
+    convertUnitsViaTofHelper(*this->events, conversion);
+    break;
+  case WEIGHTED:
+    convertUnitsViaTofHelper(*this->weightedEvents, conversion);
+    break;
+  case WEIGHTED_NOTIME:
+    convertUnitsViaTofHelper(*this->weightedEventsNoTime, conversion);
+    break;
+  }
+}
+
 //--------------------------------------------------------------------------
 /** Convert the event's TOF (x) value according to a simple output = a *
  * (input^b) relationship
@@ -4516,6 +5209,8 @@ void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events, const
  *  @param power :: the Power b to apply to the conversion
  */
 void EventList::convertUnitsQuickly(const double &factor, const double &power) {
+  materializeRows();
+  ++m_histogramGeneration;
   switch (eventType) {
   case TOF:
     convertUnitsQuicklyHelper(*this->events, factor, power);
@@ -4530,8 +5225,7 @@ void EventList::convertUnitsQuickly(const double &factor, const double &power) {
 }
 
 HistogramData::Histogram &EventList::mutableHistogramRef() {
-  if (mru)
-    mru->deleteIndex(this);
+  ++m_histogramGeneration;
   return m_histogram;
 }
 
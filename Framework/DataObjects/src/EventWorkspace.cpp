@@ -36,6 +36,14 @@ namespace Mantid::DataObjects {
 namespace {
 // static logger
 Kernel::Logger g_log("EventWorkspace");
+/// Number of spectra whose pulse times are gathered together by one thread
+constexpr int64_t SPECTRA_PER_PULSE_BLOCK{1024};
+
+/// Sort the times and remove the duplicates
+void sortUnique(std::vector<int64_t> &times) {
+  std::sort(times.begin(), times.end());
+  times.erase(std::unique(times.begin(), times.end()), times.end());
+}
 } // namespace
 
 DECLARE_WORKSPACE(EventWorkspace)
@@ -47,7 +55,7 @@ using namespace Mantid::Kernel;
 EventWorkspace::EventWorkspace() : IEventWorkspace(), mru(std::make_unique<EventWorkspaceMRU>()) {}
 
 EventWorkspace::EventWorkspace(const EventWorkspace &other)
-    : IEventWorkspace(other), mru(std::make_unique<EventWorkspaceMRU>()) {
+    : IEventWorkspace(other), mru(std::make_unique<EventWorkspaceMRU>(other.mru->getMemoryBudget())) {
   for (const auto &el : other.data) {
     // Create a new event list, copying over the events
     auto newel = std::make_unique<EventList>(*el);
@@ -466,6 +474,70 @@ void EventWorkspace::switchEventType(const Mantid::API::EventType type) {
     eventList->switchTo(type);
 }
 
+/** Store the events of all event lists in columnar (structure-of-arrays) form,
+ * or switch them back to the usual vector of events.
+ * See EventList::setColumnarStorage()
+ *
+ * @param columnar :: true to use columnar storage
+ */
+void EventWorkspace::setColumnarEventStorage(const bool columnar) {
+  const auto numberOfSpectra = static_cast<int64_t>(this->data.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfSpectra; ++i)
+    this->data[i]->setColumnarStorage(columnar);
+}
+
+/// Returns true if every event list in the workspace uses columnar storage
+bool EventWorkspace::hasColumnarEventStorage() const {
+  return !this->data.empty() &&
+         std::all_of(this->data.cbegin(), this->data.cend(), [](const auto &list) { return list->hasColumnarStorage(); });
+}
+
+/** Store the pulse time of each event as an index into one table of the unique
+ * pulse times of the workspace, which is shared by all of the event lists.
+ * Lists of events without pulse times are left alone.
+ * See EventList::compressPulseTimes()
+ */
+void EventWorkspace::compressPulseTimes() {
+  const auto numberOfSpectra = static_cast<int64_t>(this->data.size());
+  const int64_t numberOfBlocks = (numberOfSpectra + SPECTRA_PER_PULSE_BLOCK - 1) / SPECTRA_PER_PULSE_BLOCK;
+
+  // gather the unique pulse times of each block of spectra
+  std::vector<std::vector<int64_t>> blockTimes(numberOfBlocks);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t block = 0; block < numberOfBlocks; ++block) {
+    auto &times = blockTimes[block];
+    size_t numberOfUnique = 0;
+    const int64_t end = std::min(numberOfSpectra, (block + 1) * SPECTRA_PER_PULSE_BLOCK);
+    for (int64_t i = block * SPECTRA_PER_PULSE_BLOCK; i < end; ++i) {
+      const auto &eventList = *this->data[i];
+      if (eventList.getEventType() == Mantid::API::WEIGHTED_NOTIME)
+        continue;
+      for (const auto &time : eventList.getPulseTimes())
+        times.emplace_back(time.totalNanoseconds());
+      // many lists share the same pulses, so drop the duplicates whenever the vector has doubled
+      if (times.size() > 2 * numberOfUnique + SPECTRA_PER_PULSE_BLOCK) {
+        sortUnique(times);
+        numberOfUnique = times.size();
+      }
+    }
+    sortUnique(times);
+  }
+
+  auto pulseTable = std::make_shared<std::vector<int64_t>>();
+  for (auto &times : blockTimes) {
+    pulseTable->insert(pulseTable->end(), times.cbegin(), times.cend());
+    std::vector<int64_t>().swap(times);
+    sortUnique(*pulseTable);
+  }
+  pulseTable->shrink_to_fit();
+  const std::shared_ptr<const std::vector<int64_t>> sharedTable = std::move(pulseTable);
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfSpectra; ++i)
+    this->data[i]->compressPulseTimes(sharedTable);
+}
+
 /// Returns true always - an EventWorkspace always represents histogramm-able
 /// data
 /// @returns If the data is a histogram - always true for an eventWorkspace
@@ -480,10 +552,21 @@ size_t EventWorkspace::MRUSize() const { return mru->MRUSize(); }
 /** Clears the MRU lists */
 void EventWorkspace::clearMRU() const { mru->clear(); }
 
+/** Set the memory that histograms cached for use by any thread may take up.
+ * The default is set by the eventworkspace.histogramcache.size configuration
+ * property, in MB. The few histograms most recently used by each thread are
+ * kept regardless.
+ * @param memoryBudget :: memory in bytes. Zero disables the shared cache.
+ */
+void EventWorkspace::setHistogramCacheSize(const std::size_t memoryBudget) const {
+  mru->setMemoryBudget(memoryBudget);
+}
+
+/// @return the hit rate and size of the cache of generated histograms
+EventWorkspaceMRU::Statistics EventWorkspace::getHistogramCacheStatistics() const { return mru->getStatistics(); }
+
 /// Returns the amount of memory used in bytes
 size_t EventWorkspace::getMemorySize() const {
-  // TODO: Add the MRU buffer
-
   // Add the memory from all the event lists
   size_t total = std::accumulate(data.begin(), data.end(), size_t{0},
                                  [](size_t total, auto &list) { return total + list->getMemorySize(); });
@@ -492,6 +575,9 @@ size_t EventWorkspace::getMemorySize() const {
 
   total += this->getMemorySizeForXAxes();
 
+  // Histograms held by the shared cache. The per-thread MRU lists mostly point to the same data.
+  total += mru->getStatistics().memory;
+
   // Return in bytes
   return total;
 }
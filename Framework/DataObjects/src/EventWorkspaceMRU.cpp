@@ -5,11 +5,35 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidKernel/ConfigService.h"
 
 #include <algorithm>
 
 namespace Mantid::DataObjects {
 
+namespace {
+/// Size of the shared histogram cache of each workspace in MB, unless set by eventworkspace.histogramcache.size.
+/// Every event workspace has its own cache, so this is kept small.
+constexpr std::size_t DEFAULT_CACHE_SIZE_MB{16};
+
+/// The memory budget of the shared histogram cache from the configuration, in bytes
+std::size_t configuredMemoryBudget() {
+  const auto sizeMB = Kernel::ConfigService::Instance().getValue<int>("eventworkspace.histogramcache.size");
+  if (!sizeMB.has_value())
+    return DEFAULT_CACHE_SIZE_MB * 1024 * 1024;
+  return static_cast<std::size_t>(std::max(sizeMB.value(), 0)) * 1024 * 1024;
+}
+} // namespace
+
+/// Constructor. The memory budget of the shared cache is read from the
+/// eventworkspace.histogramcache.size configuration property, in MB.
+EventWorkspaceMRU::EventWorkspaceMRU() : m_memoryBudget(configuredMemoryBudget()) {}
+
+/** Constructor
+ * @param memoryBudget :: memory the shared cache may use, in bytes. Zero disables it.
+ */
+EventWorkspaceMRU::EventWorkspaceMRU(const std::size_t memoryBudget) : m_memoryBudget(memoryBudget) {}
+
 EventWorkspaceMRU::~EventWorkspaceMRU() {
   // Make sure you free up the memory in the MRUs
   {
@@ -57,6 +81,21 @@ void EventWorkspaceMRU::ensureEnoughBuffersY(size_t thread_num) const {
   }
 }
 
+//---------------------------------------------------------------------------
+/** Make sure that there are both Y and E buffers for the thread. Once they
+ * exist this does not take any lock.
+ * @param thread_num :: thread number that wants the MRU buffers
+ */
+void EventWorkspaceMRU::ensureEnoughBuffers(size_t thread_num) const {
+  if (thread_num < m_numBuffers.load(std::memory_order_acquire))
+    return;
+  ensureEnoughBuffersY(thread_num);
+  ensureEnoughBuffersE(thread_num);
+  std::size_t numBuffers = m_numBuffers.load(std::memory_order_acquire);
+  while (numBuffers <= thread_num && !m_numBuffers.compare_exchange_weak(numBuffers, thread_num + 1)) {
+  }
+}
+
 //---------------------------------------------------------------------------
 /// Clear all the data in the MRU buffers
 void EventWorkspaceMRU::clear() {
@@ -70,69 +109,194 @@ void EventWorkspaceMRU::clear() {
     }
   }
 
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexE);
-  for (auto &data : m_bufferedDataE) {
-    if (data) {
-      data->clear();
+  {
+    Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexE);
+    for (auto &data : m_bufferedDataE) {
+      if (data) {
+        data->clear();
+      }
     }
   }
+
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> _lock(shard.mutex);
+    shard.entries.clear();
+    shard.lookup.clear();
+    shard.memory = 0;
+  }
 }
 
 //---------------------------------------------------------------------------
-/** Find a Y histogram in the MRU
+/** Find a Y histogram in the MRU of the thread, or else in the shared cache
  *
  * @param thread_num :: number of the thread in which this is run
  * @param index :: index of the data to return
- * @return pointer to the TypeWithMarker that has the data; NULL if not found.
+ * @param generation :: current histogram generation of the EventList
+ * @return the histogram; NULL if not found or out of date.
  */
-Kernel::cow_ptr<HistogramData::HistogramY> EventWorkspaceMRU::findY(size_t thread_num, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
-  auto result = m_bufferedDataY[thread_num]->find(reinterpret_cast<std::uintptr_t>(index));
-  if (result)
-    return result->m_data;
+Kernel::cow_ptr<HistogramData::HistogramY> EventWorkspaceMRU::findY(size_t thread_num, const EventList *index,
+                                                                    const uint64_t generation) {
+  {
+    Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
+    auto &buffer = *m_bufferedDataY[thread_num];
+    const auto key = reinterpret_cast<std::uintptr_t>(index);
+    auto result = buffer.find(key);
+    if (result && result->m_generation == generation) {
+      ++m_hits;
+      return result->m_data;
+    }
+  }
+
+  YType yData(nullptr);
+  EType eData(nullptr);
+  if (findShared(index, generation, yData, eData)) {
+    ++m_hits;
+    insertIntoBuffers(thread_num, yData, eData, index, generation);
+    return yData;
+  }
+  ++m_misses;
   return YType(nullptr);
 }
 
-/** Find a Y histogram in the MRU
+/** Find an E histogram in the MRU of the thread, or else in the shared cache
  *
  * @param thread_num :: number of the thread in which this is run
  * @param index :: index of the data to return
- * @return pointer to the TypeWithMarker that has the data; NULL if not found.
+ * @param generation :: current histogram generation of the EventList
+ * @return the histogram; NULL if not found or out of date.
  */
-Kernel::cow_ptr<HistogramData::HistogramE> EventWorkspaceMRU::findE(size_t thread_num, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
-  auto result = m_bufferedDataE[thread_num]->find(reinterpret_cast<std::uintptr_t>(index));
-  if (result)
-    return result->m_data;
+Kernel::cow_ptr<HistogramData::HistogramE> EventWorkspaceMRU::findE(size_t thread_num, const EventList *index,
+                                                                    const uint64_t generation) {
+  {
+    Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
+    auto &buffer = *m_bufferedDataE[thread_num];
+    const auto key = reinterpret_cast<std::uintptr_t>(index);
+    auto result = buffer.find(key);
+    if (result && result->m_generation == generation) {
+      ++m_hits;
+      return result->m_data;
+    }
+  }
+
+  YType yData(nullptr);
+  EType eData(nullptr);
+  if (findShared(index, generation, yData, eData)) {
+    ++m_hits;
+    insertIntoBuffers(thread_num, yData, eData, index, generation);
+    return eData;
+  }
+  ++m_misses;
   return EType(nullptr);
 }
 
-/** Insert a new histogram into the MRU
+/** Insert a newly generated histogram into the MRU of the thread and the shared cache.
+ * Both MRU buffers of the thread must exist.
  *
  * @param thread_num :: thread being accessed
- * @param data :: the new data
+ * @param yData :: the new Y data
+ * @param eData :: the new E data
  * @param index :: index of the data to insert
+ * @param generation :: histogram generation of the EventList the data was made from
  */
-void EventWorkspaceMRU::insertY(size_t thread_num, YType data, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
-  auto yWithMarker = std::make_shared<TypeWithMarker<YType>>(reinterpret_cast<std::uintptr_t>(index));
-  yWithMarker->m_data = std::move(data);
-  m_bufferedDataY[thread_num]->insert(yWithMarker);
-  // the memory is cleared automatically due to being a smart_ptr
+void EventWorkspaceMRU::insert(size_t thread_num, YType yData, EType eData, const EventList *index,
+                               const uint64_t generation) {
+  insertIntoBuffers(thread_num, yData, eData, index, generation);
+
+  const std::size_t budget = m_memoryBudget;
+  if (budget == 0)
+    return;
+  const std::size_t memory = (yData->size() + eData->size()) * sizeof(double) + sizeof(CachedHistogram);
+  auto &shard = shardFor(index);
+  std::lock_guard<std::mutex> _lock(shard.mutex);
+  const auto existing = shard.lookup.find(index);
+  if (existing != shard.lookup.end()) {
+    shard.memory -= existing->second->memory;
+    shard.entries.erase(existing->second);
+    shard.lookup.erase(existing);
+  }
+  shard.entries.push_front({index, generation, std::move(yData), std::move(eData), memory});
+  shard.lookup.emplace(index, shard.entries.begin());
+  shard.memory += memory;
+  evict(shard, budget / NUM_SHARDS);
 }
 
-/** Insert a new histogram into the MRU
+/** Put a histogram at the top of both MRU lists of a thread, replacing any out of date entry
  *
  * @param thread_num :: thread being accessed
- * @param data :: the new data
+ * @param yData :: the Y data
+ * @param eData :: the E data
  * @param index :: index of the data to insert
+ * @param generation :: histogram generation of the EventList the data was made from
  */
-void EventWorkspaceMRU::insertE(size_t thread_num, EType data, const EventList *index) {
+void EventWorkspaceMRU::insertIntoBuffers(size_t thread_num, const YType &yData, const EType &eData,
+                                          const EventList *index, const uint64_t generation) {
+  const auto key = reinterpret_cast<std::uintptr_t>(index);
+  {
+    Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
+    auto yWithMarker = std::make_shared<TypeWithMarker<YType>>(key);
+    yWithMarker->m_data = yData;
+    yWithMarker->m_generation = generation;
+    // an entry that is already there would be kept by insert()
+    m_bufferedDataY[thread_num]->deleteIndex(key);
+    m_bufferedDataY[thread_num]->insert(yWithMarker);
+  }
   Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
-  auto eWithMarker = std::make_shared<TypeWithMarker<EType>>(reinterpret_cast<std::uintptr_t>(index));
-  eWithMarker->m_data = std::move(data);
+  auto eWithMarker = std::make_shared<TypeWithMarker<EType>>(key);
+  eWithMarker->m_data = eData;
+  eWithMarker->m_generation = generation;
+  m_bufferedDataE[thread_num]->deleteIndex(key);
   m_bufferedDataE[thread_num]->insert(eWithMarker);
-  // And clear up the memory of the old one, if it is dropping out.
+}
+
+/** Look for a histogram in the shared cache. An out of date entry is removed.
+ *
+ * @param index :: index of the data to return
+ * @param generation :: current histogram generation of the EventList
+ * @param yData :: set to the Y data if found
+ * @param eData :: set to the E data if found
+ * @return true if the histogram was found
+ */
+bool EventWorkspaceMRU::findShared(const EventList *index, const uint64_t generation, YType &yData, EType &eData) {
+  if (m_memoryBudget == 0)
+    return false;
+  auto &shard = shardFor(index);
+  std::lock_guard<std::mutex> _lock(shard.mutex);
+  const auto found = shard.lookup.find(index);
+  if (found == shard.lookup.end())
+    return false;
+  const auto entry = found->second;
+  if (entry->generation != generation) {
+    shard.memory -= entry->memory;
+    shard.entries.erase(entry);
+    shard.lookup.erase(found);
+    return false;
+  }
+  // move to the front as the most recently used
+  shard.entries.splice(shard.entries.begin(), shard.entries, entry);
+  yData = entry->yData;
+  eData = entry->eData;
+  return true;
+}
+
+/// The part of the shared cache that holds the histogram of an EventList
+EventWorkspaceMRU::Shard &EventWorkspaceMRU::shardFor(const EventList *index) {
+  // EventLists are at least 16 bytes apart, so the low bits of the address carry no information
+  return m_shards[(reinterpret_cast<std::uintptr_t>(index) >> 4) % NUM_SHARDS];
+}
+
+/** Drop the least recently used histograms of a part of the shared cache
+ * until it fits in its budget
+ *
+ * @param shard :: the part of the cache, which must be locked
+ * @param budget :: memory the part may use, in bytes
+ */
+void EventWorkspaceMRU::evict(Shard &shard, const std::size_t budget) {
+  while (shard.memory > budget && !shard.entries.empty()) {
+    const auto &oldest = shard.entries.back();
+    shard.memory -= oldest.memory;
+    shard.lookup.erase(oldest.index);
+    shard.entries.pop_back();
+  }
 }
 
 /** Delete any entries in the MRU at the given index
@@ -158,6 +322,14 @@ void EventWorkspaceMRU::deleteIndex(const EventList *index) {
       }
     }
   }
+  auto &shard = shardFor(index);
+  std::lock_guard<std::mutex> _lock3(shard.mutex);
+  const auto found = shard.lookup.find(index);
+  if (found != shard.lookup.end()) {
+    shard.memory -= found->second->memory;
+    shard.entries.erase(found->second);
+    shard.lookup.erase(found);
+  }
 }
 
 size_t EventWorkspaceMRU::MRUSize() const {
@@ -168,4 +340,38 @@ size_t EventWorkspaceMRU::MRUSize() const {
   }
 }
 
+/** Set the memory the shared cache may use. Histograms are dropped straight
+ * away if the cache no longer fits.
+ * @param memoryBudget :: the budget in bytes. Zero disables the shared cache.
+ */
+void EventWorkspaceMRU::setMemoryBudget(const std::size_t memoryBudget) {
+  m_memoryBudget = memoryBudget;
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> _lock(shard.mutex);
+    if (memoryBudget == 0) {
+      shard.entries.clear();
+      shard.lookup.clear();
+      shard.memory = 0;
+    } else {
+      evict(shard, memoryBudget / NUM_SHARDS);
+    }
+  }
+}
+
+/// @return the memory the shared cache may use, in bytes
+std::size_t EventWorkspaceMRU::getMemoryBudget() const { return m_memoryBudget; }
+
+/// @return the number of cache hits and misses so far, and the current size of the shared cache
+EventWorkspaceMRU::Statistics EventWorkspaceMRU::getStatistics() const {
+  Statistics statistics;
+  statistics.hits = m_hits;
+  statistics.misses = m_misses;
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> _lock(shard.mutex);
+    statistics.entries += shard.entries.size();
+    statistics.memory += shard.memory;
+  }
+  return statistics;
+}
+
 } // namespace Mantid::DataObjects
@@ -9,12 +9,15 @@
 #include "MantidAPI/FileBackedExperimentInfo.h"
 #include "MantidAPI/WorkspaceHistory.h"
 #include "MantidDataObjects/MDEventFactory.h"
+#include "MantidDataObjects/MortonIndex/BitInterleaving.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/Strings.h"
 #include <Poco/File.h>
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
 #include <utility>
 
 using file_holder_type = std::unique_ptr<::NeXus::File>;
@@ -55,9 +58,39 @@ void CheckExperimentBlockNum(const std::list<uint16_t> &experimentBlockNum) {
   }
 }
 
+/// Scale a coordinate within [0, 1] to the full range of a 16-bit integer
+uint16_t toMortonCoordinate(const double unitCoord) {
+  return static_cast<uint16_t>(std::clamp(unitCoord, 0., 1.) * std::numeric_limits<uint16_t>::max());
+}
+
+template <size_t ND> uint64_t mortonKey(const std::vector<double> &unitCoords) {
+  morton_index::IntArray<ND, uint16_t> intCoords;
+  for (size_t d = 0; d < ND; d++)
+    intCoords[d] = toMortonCoordinate(unitCoords[d]);
+  return morton_index::Interleaver<ND, uint16_t, uint64_t>::interleave(intCoords);
+}
+
+/** The Morton (Z-order) key of a point in the unit cube. Points close to each
+ * other mostly have close keys. Only the first four dimensions contribute to the
+ * key of a point with more dimensions, as a 64-bit key holds 4 x 16 bits.
+ * @param unitCoords :: the coordinates of the point, each within [0, 1]
+ */
+uint64_t mortonKey(const std::vector<double> &unitCoords) {
+  switch (unitCoords.size()) {
+  case 1:
+    return toMortonCoordinate(unitCoords[0]);
+  case 2:
+    return mortonKey<2>(unitCoords);
+  case 3:
+    return mortonKey<3>(unitCoords);
+  default:
+    return mortonKey<4>(unitCoords);
+  }
+}
+
 } // namespace
 
-MDBoxFlatTree::MDBoxFlatTree() : m_nDim(-1) {}
+MDBoxFlatTree::MDBoxFlatTree() : m_nDim(-1), m_mortonOrdered(false) {}
 
 /**The method initiates the MDBoxFlatTree class internal structure in the form
  *ready for saving this structure to HDD
@@ -171,22 +204,33 @@ void MDBoxFlatTree::initFlatStructure(const API::IMDEventWorkspace_sptr &pws, co
      @param setFileBacked  -- initiate the boxes to be fileBacked. The boxes
    assumed not to be saved before.
 */
-void MDBoxFlatTree::setBoxesFilePositions(bool setFileBacked) {
+/** Calculate the positions of the events of the boxes in the file
+ * @param setFileBacked :: make the boxes file backed at these positions, as not yet saved
+ * @param mortonOrder :: lay the events out in the Morton order of the box centres
+ *  rather than in the order of the box IDs. The boxes of a region of the workspace
+ *  are then close to each other in the file and can be read with a few large reads.
+ */
+void MDBoxFlatTree::setBoxesFilePositions(bool setFileBacked, bool mortonOrder) {
   // this will preserve file-backed workspace and information in it as we are
   // not loading old box data and not?
   // this would be right for binary access but questionable for Nexus --TODO:
   // needs testing
   // Done in INIT--> need check if ID and index in the tree are always the same.
   // Kernel::ISaveable::sortObjByFilePos(m_Boxes);
+  // avoid grid boxes;
+  std::vector<API::IMDNode *> boxes;
+  boxes.reserve(m_Boxes.size());
+  std::copy_if(m_Boxes.cbegin(), m_Boxes.cend(), std::back_inserter(boxes),
+               [this](const API::IMDNode *mdBox) { return m_BoxType[mdBox->getID()] != 2; });
+  if (mortonOrder)
+    this->sortByMortonIndex(boxes);
+  m_mortonOrdered = mortonOrder;
+
   // calculate the box positions in the resulting file and save it on place
   uint64_t eventsStart = 0;
-  for (auto mdBox : m_Boxes) {
+  for (auto mdBox : boxes) {
     size_t ID = mdBox->getID();
 
-    // avoid grid boxes;
-    if (m_BoxType[ID] == 2)
-      continue;
-
     size_t nEvents = mdBox->getTotalDataSize();
     m_BoxEventIndex[ID * 2] = eventsStart;
     m_BoxEventIndex[ID * 2 + 1] = nEvents;
@@ -197,6 +241,31 @@ void MDBoxFlatTree::setBoxesFilePositions(bool setFileBacked) {
   }
 }
 
+/** Sort the boxes in the Morton order of their centres, scaled to the extents of
+ * the head box (ID 0).
+ * @param boxes :: the boxes to sort, all described by this flat structure
+ */
+void MDBoxFlatTree::sortByMortonIndex(std::vector<API::IMDNode *> &boxes) const {
+  const auto nDims = static_cast<size_t>(m_nDim);
+  std::vector<double> centre(nDims);
+  std::vector<std::pair<uint64_t, API::IMDNode *>> keyedBoxes;
+  keyedBoxes.reserve(boxes.size());
+  for (auto mdBox : boxes) {
+    const size_t offset = mdBox->getID() * nDims * 2;
+    for (size_t d = 0; d < nDims; d++) {
+      const double min = m_Extents[d * 2];
+      const double width = m_Extents[d * 2 + 1] - min;
+      const double boxCentre = 0.5 * (m_Extents[offset + d * 2] + m_Extents[offset + d * 2 + 1]);
+      centre[d] = width > 0 ? (boxCentre - min) / width : 0.;
+    }
+    keyedBoxes.emplace_back(mortonKey(centre), mdBox);
+  }
+  std::stable_sort(keyedBoxes.begin(), keyedBoxes.end(),
+                   [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+  std::transform(keyedBoxes.cbegin(), keyedBoxes.cend(), boxes.begin(),
+                 [](const auto &keyedBox) { return keyedBox.second; });
+}
+
 void MDBoxFlatTree::saveBoxStructure(const std::string &fileName) {
   m_FileName = fileName;
   bool old_group;
@@ -234,6 +303,8 @@ void MDBoxFlatTree::saveBoxStructure(::NeXus::File *hFile) {
     // update box controller information
     hFile->putAttr("box_controller_xml", m_bcXMLDescr);
   }
+  // the order of the events in the file
+  hFile->putAttr("event_order", std::string(m_mortonOrdered ? "morton" : "box"));
 
   std::vector<int64_t> exents_dims(2, 0);
   exents_dims[0] = (int64_t(maxBoxes));
@@ -321,6 +392,14 @@ void MDBoxFlatTree::loadBoxStructure(::NeXus::File *hFile, bool onlyEventInfo) {
   // ------------------------------
   hFile->openGroup("box_structure", "NXdata");
 
+  // files written before the Morton layout was available have the box order
+  m_mortonOrdered = false;
+  if (hFile->hasAttr("event_order")) {
+    std::string eventOrder;
+    hFile->getAttr("event_order", eventOrder);
+    m_mortonOrdered = eventOrder == "morton";
+  }
+
   if (onlyEventInfo) {
     // Load the box controller description
     hFile->getAttr("box_controller_xml", m_bcXMLDescr);
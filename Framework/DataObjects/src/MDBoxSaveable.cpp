@@ -11,8 +11,8 @@ namespace Mantid::DataObjects {
 
 MDBoxSaveable::MDBoxSaveable(API::IMDNode *const Host) : m_MDNode(Host) {}
 
-/** flush data out of the file buffer to the HDD */
-void MDBoxSaveable::flushData() const { m_MDNode->getBoxController()->getFileIO()->flushData(); }
+/** flush data out of the file buffer to the HDD, behind the writes still in progress */
+void MDBoxSaveable::flushData() const { m_MDNode->getBoxController()->getFileIO()->flushDataBehind(); }
 
 //-----------------------------------------------------------------------------------------------
 /** Physically save the box data. Tries to load any previous data from HDD
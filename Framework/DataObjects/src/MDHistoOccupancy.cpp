@@ -0,0 +1,65 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/MDHistoOccupancy.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+
+namespace Mantid::DataObjects {
+
+/** Constructor
+ * @param ws :: the workspace whose occupied voxels are recorded
+ */
+MDHistoOccupancy::MDHistoOccupancy(const MDHistoWorkspace &ws)
+    : MDHistoOccupancy(ws.getSignalArray(), ws.getErrorSquaredArray(), ws.getNumEventsArray(),
+                       static_cast<size_t>(ws.getNPoints())) {}
+
+/** Constructor
+ * @param signals :: the signal array
+ * @param errorsSquared :: the squared error array
+ * @param numEvents :: the number of events array
+ * @param length :: the number of voxels in each of the arrays
+ */
+MDHistoOccupancy::MDHistoOccupancy(const signal_t *signals, const signal_t *errorsSquared, const signal_t *numEvents,
+                                   const size_t length)
+    : m_length(length), m_occupiedBefore() {
+  const size_t numTiles = (length + TILE_SIZE - 1) / TILE_SIZE;
+  std::vector<char> occupied(numTiles, 0);
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t tile = 0; tile < static_cast<int64_t>(numTiles); ++tile) {
+    const size_t begin = static_cast<size_t>(tile) * TILE_SIZE;
+    const size_t end = std::min(begin + TILE_SIZE, length);
+    for (size_t i = begin; i < end; ++i) {
+      if (signals[i] != 0 || errorsSquared[i] != 0 || numEvents[i] != 0) {
+        occupied[tile] = 1;
+        break;
+      }
+    }
+  }
+
+  m_occupiedBefore.resize(numTiles + 1, 0);
+  for (size_t tile = 0; tile < numTiles; ++tile)
+    m_occupiedBefore[tile + 1] = m_occupiedBefore[tile] + static_cast<size_t>(occupied[tile]);
+}
+
+/** Check, at tile granularity, whether a range of voxels may hold data.
+ * The answer is exact for empty ranges: false means every voxel in the range is empty,
+ * true means some tile overlapping the range holds an occupied voxel.
+ * @param begin :: first linear index of the range
+ * @param end :: one past the last linear index of the range; clipped to the workspace
+ * @return true if any tile overlapping [begin, end) is occupied
+ */
+bool MDHistoOccupancy::anyOccupiedTile(const size_t begin, const size_t end) const {
+  const size_t last = std::min(end, m_length);
+  if (begin >= last)
+    return false;
+  return m_occupiedBefore[(last - 1) / TILE_SIZE + 1] != m_occupiedBefore[begin / TILE_SIZE];
+}
+
+} // namespace Mantid::DataObjects
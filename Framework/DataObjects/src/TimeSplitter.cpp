@@ -11,6 +11,8 @@
 #include "MantidKernel/SplittingInterval.h"
 #include "MantidKernel/TimeROI.h"
 
+#include <algorithm>
+
 namespace Mantid {
 using API::EventType;
 using Kernel::SplittingInterval;
@@ -521,6 +523,33 @@ const std::map<int, std::string> &TimeSplitter::getTargetNameMap() const { retur
  */
 void TimeSplitter::splitEventList(const EventList &events, std::map<int, EventList *> &partials, const bool pulseTof,
                                   const bool tofCorrect, const double factor, const double shift) const {
+  const auto getPartial = [&partials](const int destination) -> EventList * {
+    const auto partial = partials.find(destination);
+    return partial == partials.end() ? nullptr : partial->second;
+  };
+  this->splitEventList(events, getPartial, pulseTof, tofCorrect, factor, shift);
+}
+
+/**
+ * Split a list of events according to Pulse time or Pulse + TOF time.
+ * This does not clear out the partial EventLists.
+ *
+ * The partial list of a destination is only requested if events are routed to it, so a caller with many destinations
+ * does not have to gather all of their lists for every input list. The partial lists must hold the same type of
+ * events as the input list.
+ *
+ * Events with masked times are allocated to destination index -1.
+ * @param events : list of input events
+ * @param getPartial : returns the partial list of events of a destination index, or nullptr to drop its events
+ * @param pulseTof : if True, split according to Pulse + TOF time, otherwise split by Pulse time
+ * @param tofCorrect : rescale and shift the TOF values (factor*TOF + shift)
+ * @param factor : rescale the TOF values by a dimensionless factor.
+ * @param shift : shift the TOF values after rescaling, in units of microseconds.
+ * @throws invalid_argument : the event list is of type Mantid::API::EventType::WEIGHTED_NOTIME
+ */
+void TimeSplitter::splitEventList(const EventList &events, const std::function<EventList *(const int)> &getPartial,
+                                  const bool pulseTof, const bool tofCorrect, const double factor,
+                                  const double shift) const {
 
   if (events.getEventType() == EventType::WEIGHTED_NOTIME)
     throw std::invalid_argument("EventList::splitEventList() called on an EventList "
@@ -530,8 +559,6 @@ void TimeSplitter::splitEventList(const EventList &events, std::map<int, EventLi
     return;
 
   // sort the input EventList in-place
-  const EventSortType sortOrder = pulseTof ? EventSortType::PULSETIMETOF_SORT
-                                           : EventSortType::PULSETIME_SORT; // this will be used to set order on outputs
   if (pulseTof) {
     // this sorting is preserved under linear transformation tof --> factor*tof+shift with factor>0
     events.sortPulseTimeTOF();
@@ -542,20 +569,14 @@ void TimeSplitter::splitEventList(const EventList &events, std::map<int, EventLi
   // split the events
   switch (events.getEventType()) {
   case EventType::TOF:
-    this->splitEventVec(events.getEvents(), partials, pulseTof, tofCorrect, factor, shift);
+    this->splitEventVec(events.getEvents(), getPartial, pulseTof, tofCorrect, factor, shift);
     break;
   case EventType::WEIGHTED:
-    this->splitEventVec(events.getWeightedEvents(), partials, pulseTof, tofCorrect, factor, shift);
+    this->splitEventVec(events.getWeightedEvents(), getPartial, pulseTof, tofCorrect, factor, shift);
     break;
   default:
     throw std::runtime_error("Unhandled event type");
   }
-
-  // set the sort order on the EventLists since we know the sorting already
-  for (auto &partial : partials) {
-    if (!partial.second->empty())
-      partial.second->setSortOrder(sortOrder);
-  }
 }
 
 /**
@@ -564,69 +585,98 @@ void TimeSplitter::splitEventList(const EventList &events, std::map<int, EventLi
  * For each event in `events` we calculate the event time using a timeCalc function. The function definition
  * depends on the input flags (pulseTof, tofCorrect) and input parameters (factor, shift).
  * The calculated time is then used to find a destination index for the event in the TimeSplitter object.
- * The destination index, in turn, is the key to find the target event list in the partials map.
+ * The destination index, in turn, is used to find the target event list.
  *
  * @tparam EventType : one of EventType::TOF or EventType::WEIGHTED
  * @param events : list of input events
- * @param partials : target list of partial event lists associated with different destination indexes
+ * @param getPartial : returns the target event list of a destination index, or nullptr
  * @param pulseTof : if true, split according to Pulse + TOF time, otherwise split by Pulse time
  * @param tofCorrect : rescale and shift the TOF values (factor*TOF + shift)
  * @param factor : rescale the TOF values by a dimensionless factor.
  * @param shift : shift the TOF values after rescaling, in units of microseconds.
  */
 template <typename EventType>
-
-void TimeSplitter::splitEventVec(const std::vector<EventType> &events, std::map<int, EventList *> &partials,
-                                 const bool pulseTof, const bool tofCorrect, const double factor,
-                                 const double shift) const {
-  // determine the right function for getting the "pulse time" for the event
-  std::function<const DateAndTime(const EventType &)> timeCalc;
+void TimeSplitter::splitEventVec(const std::vector<EventType> &events,
+                                 const std::function<EventList *(const int)> &getPartial, const bool pulseTof,
+                                 const bool tofCorrect, const double factor, const double shift) const {
+  // determine the right function for getting the "pulse time" for the event. Each is a separate
+  // instantiation, so that the time calculation can be inlined into the routing loop.
   if (pulseTof) {
     if (tofCorrect) {
-      timeCalc = [factor, shift](const EventType &event) { return event.pulseTOFTimeAtSample(factor, shift); };
+      this->splitEventVec(
+          [factor, shift](const EventType &event) { return event.pulseTOFTimeAtSample(factor, shift); }, events,
+          getPartial, pulseTof);
     } else {
-      timeCalc = [](const EventType &event) { return event.pulseTOFTime(); };
+      this->splitEventVec([](const EventType &event) { return event.pulseTOFTime(); }, events, getPartial, pulseTof);
     }
   } else {
-    timeCalc = [](const EventType &event) { return event.pulseTime(); };
+    this->splitEventVec([](const EventType &event) { return event.pulseTime(); }, events, getPartial, pulseTof);
   }
-
-  // do the actual event splitting
-  this->splitEventVec(timeCalc, events, partials);
 }
 
-template <typename EventType>
-void TimeSplitter::splitEventVec(const std::function<const DateAndTime(const EventType &)> &timeCalc,
-                                 const std::vector<EventType> &events, std::map<int, EventList *> &partials) const {
+namespace {
+/// A run of consecutive events that go to the same destination
+struct EventRange {
+  int destination;
+  std::size_t first;
+  std::size_t last;
+};
+
+/// The vector of a partial event list that events of type T are appended to
+template <typename T> std::vector<T> &partialEvents(EventList &partial);
+template <> std::vector<Types::Event::TofEvent> &partialEvents(EventList &partial) { return partial.getEvents(); }
+template <> std::vector<WeightedEvent> &partialEvents(EventList &partial) { return partial.getWeightedEvents(); }
+} // namespace
+
+/**
+ * Route the events to their destinations in two passes. The first sweeps the sorted events and the splitter
+ * intervals together and records the range of events that goes to each interval. The second appends each
+ * destination's ranges to its event list, which is looked up and reserved once, in blocks.
+ *
+ * @param timeCalc : calculates the time of an event that is compared against the splitter boundaries
+ * @param events : list of input events, sorted by pulse time or by pulse time and TOF
+ * @param getPartial : returns the target event list of a destination index, or nullptr
+ * @param pulseTof : true if the events are sorted by pulse time and TOF, otherwise by pulse time
+ */
+template <typename EventType, typename TimeCalc>
+void TimeSplitter::splitEventVec(const TimeCalc &timeCalc, const std::vector<EventType> &events,
+                                 const std::function<EventList *(const int)> &getPartial, const bool pulseTof) const {
+  // this will be used to set order on outputs
+  const EventSortType sortOrder = pulseTof ? EventSortType::PULSETIMETOF_SORT : EventSortType::PULSETIME_SORT;
   // get a reference of the splitters as a vector
   const auto &splittersVec = getSplittingIntervals(true);
 
+  std::vector<EventRange> ranges;
+  const auto addRange = [&ranges](const int destination, const std::size_t first, const std::size_t last) {
+    if (first == last)
+      return;
+    if (!ranges.empty() && ranges.back().destination == destination && ranges.back().last == first)
+      ranges.back().last = last;
+    else
+      ranges.push_back({destination, first, last});
+  };
+
   // initialize the iterator over the splitter
   auto itSplitter = splittersVec.cbegin();
   const auto itSplitterEnd = splittersVec.cend();
 
-  // initialize iterator over the events
-  auto itEvent = events.cbegin();
-  const auto itEventEnd = events.cend();
+  // initialize the position in the events
+  std::size_t iEvent = 0;
+  const std::size_t numEvents = events.size();
 
-  // copy all events before first splitter to NO_TARGET
-  auto partial = partials.find(TimeSplitter::NO_TARGET);
+  // all events before first splitter go to NO_TARGET
   {
     const auto stop = itSplitter->start();
-    const bool shouldAppend = (partial != partials.end());
-    while (itEvent != itEventEnd && timeCalc(*itEvent) < stop) {
-      if (shouldAppend)
-        partial->second->addEventQuickly(*itEvent); // emplaces a copy of *itEvent in partial
-      // advance event iterator
-      itEvent++;
-    }
+    while (iEvent < numEvents && timeCalc(events[iEvent]) < stop)
+      iEvent++;
+    addRange(TimeSplitter::NO_TARGET, 0, iEvent);
   }
 
-  // iterate over all events. For each event try finding its destination event list, a.k.a. partial.
-  // If the partial is found, append the event to it. It is assumed events are sorted by (possibly corrected) time
-  while (itEvent != itEventEnd && itSplitter != itSplitterEnd) {
-    // Check if we need to advance the splitter and therefore select a different partial event list
-    const auto eventTime = timeCalc(*itEvent);
+  // iterate over all events. For each event find the splitter it belongs to. It is assumed events are sorted by
+  // (possibly corrected) time
+  while (iEvent < numEvents && itSplitter != itSplitterEnd) {
+    // Check if we need to advance the splitter and therefore select a different destination
+    const auto eventTime = timeCalc(events[iEvent]);
     // advance to the new stopping boundary, and update the destination index as we go
     if (eventTime > itSplitter->stop()) {
       // first try next splitter
@@ -647,34 +697,43 @@ void TimeSplitter::splitEventVec(const std::function<const DateAndTime(const Eve
     if (itSplitter == itSplitterEnd)
       break;
 
-    // determine the new stop time and destination
-    const int destination = itSplitter->index();
+    // find the events up to the end of the roi
     const auto stop = itSplitter->stop();
-
-    // find the new partial to add to
-    partial = partials.find(destination);
-
-    // loop over events up to the end of the roi
-    const bool shouldAppend = (partial != partials.end());
-    while (itEvent != itEventEnd && timeCalc(*itEvent) < stop) {
-      if (shouldAppend)
-        partial->second->addEventQuickly(*itEvent); // emplaces a copy of *itEvent in partial
-      // advance event iterator
-      itEvent++;
-    }
+    const std::size_t first = iEvent;
+    while (iEvent < numEvents && timeCalc(events[iEvent]) < stop)
+      iEvent++;
+    addRange(itSplitter->index(), first, iEvent);
 
     // increment to the next interval
     itSplitter++;
   }
 
-  // copy all events after last splitter to NO_TARGET
-  if (itEvent != itEventEnd) {
-    partial = partials.find(TimeSplitter::NO_TARGET);
-    if (partial != partials.end()) {
-      for (; itEvent != itEventEnd; ++itEvent) {
-        partial->second->addEventQuickly(*itEvent); // emplaces a copy of *itEvent in partial
-      }
+  // all events after last splitter go to NO_TARGET
+  addRange(TimeSplitter::NO_TARGET, iEvent, numEvents);
+
+  // group the ranges by destination, keeping them in time order, then copy each group in one go
+  std::stable_sort(ranges.begin(), ranges.end(),
+                   [](const auto &left, const auto &right) { return left.destination < right.destination; });
+  for (auto group = ranges.cbegin(); group != ranges.cend();) {
+    const auto groupEnd = std::find_if(group, ranges.cend(), [destination = group->destination](const auto &range) {
+      return range.destination != destination;
+    });
+    EventList *partial = getPartial(group->destination);
+    if (partial) {
+      auto &output = partialEvents<EventType>(*partial);
+      std::size_t numRouted = 0;
+      for (auto range = group; range != groupEnd; ++range)
+        numRouted += range->last - range->first;
+      // grow geometrically, in case the same partial lists are split into many times
+      const std::size_t numNeeded = output.size() + numRouted;
+      if (output.capacity() < numNeeded)
+        output.reserve(std::max(numNeeded, 2 * output.capacity()));
+      for (auto range = group; range != groupEnd; ++range)
+        output.insert(output.end(), events.cbegin() + range->first, events.cbegin() + range->last);
+      // set the sort order on the EventList since we know the sorting already
+      partial->setSortOrder(sortOrder);
     }
+    group = groupEnd;
   }
 }
 
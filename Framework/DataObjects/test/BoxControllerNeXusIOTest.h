@@ -254,6 +254,49 @@ public:
 
   void test_WriteFloatReadDouble() { this->WriteReadRead<float, double>(); }
 
+  void test_loads_see_blocks_written_behind_and_read_ahead() {
+    auto pSaver = createTestBoxController();
+    pSaver->setDataType(sizeof(float), "MDEvent");
+    TS_ASSERT_THROWS_NOTHING(pSaver->openFile(this->xxfFileName, "w"));
+    std::string FullPathFile = pSaver->getFileName();
+
+    const size_t nEvents = 20;
+    const size_t nColumns = pSaver->getNDataColums();
+    std::vector<float> first(nColumns * nEvents);
+    std::vector<float> second(nColumns * nEvents);
+    for (size_t i = 0; i < first.size(); i++) {
+      first[i] = static_cast<float>(i);
+      second[i] = static_cast<float>(i + 1000);
+    }
+    pSaver->saveBlock(first, 0);
+    pSaver->saveBlock(second, nEvents);
+
+    // the writes may still be queued, but the loads have to find their data
+    std::vector<float> toRead;
+    TS_ASSERT_THROWS_NOTHING(pSaver->loadBlock(toRead, 0, nEvents));
+    TS_ASSERT_EQUALS(toRead, first);
+    pSaver->prefetchBlock(nEvents, nEvents);
+    TS_ASSERT_THROWS_NOTHING(pSaver->loadBlock(toRead, nEvents, nEvents));
+    TS_ASSERT_EQUALS(toRead, second);
+
+    // a block read ahead is dropped when its place in the file is overwritten
+    pSaver->prefetchBlock(0, nEvents);
+    pSaver->saveBlock(second, 0);
+    TS_ASSERT_THROWS_NOTHING(pSaver->loadBlock(toRead, 0, nEvents));
+    TS_ASSERT_EQUALS(toRead, second);
+
+    TS_ASSERT_THROWS_NOTHING(pSaver->flushData());
+    const auto stats = pSaver->getIOStatistics();
+    TS_ASSERT_EQUALS(stats.writesBehind, 3);
+    TS_ASSERT_EQUALS(stats.readAheadHits, 1);
+    TS_ASSERT_EQUALS(stats.directReads, 2);
+    TS_ASSERT_EQUALS(stats.queue.queueDepth, 0);
+
+    pSaver->closeFile();
+    if (Poco::File(FullPathFile).exists())
+      Poco::File(FullPathFile).remove();
+  }
+
   void test_dataEventCount() {
     using Mantid::DataObjects::BoxControllerNeXusIO;
     using EDV = BoxControllerNeXusIO::EventDataVersion;
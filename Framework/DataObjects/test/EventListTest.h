@@ -976,6 +976,190 @@ public:
     }
   }
 
+  void test_columnar_storage_histogram_matches_all_types() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_uniform_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      if (el.getEventType() != TOF)
+        el.multiply(1.5, 0.5);
+      this->test_setX();
+
+      EventList columnar(el);
+      columnar.setColumnarStorage(true);
+      TS_ASSERT(columnar.hasColumnarStorage());
+      TS_ASSERT_EQUALS(columnar.getNumberEvents(), el.getNumberEvents());
+
+      MantidVec Y, E, Ycol, Ecol;
+      el.generateHistogram(el.readX(), Y, E);
+      columnar.generateHistogram(columnar.readX(), Ycol, Ecol);
+      TS_ASSERT(columnar.hasColumnarStorage());
+      TS_ASSERT_EQUALS(Y, Ycol);
+      TS_ASSERT_EQUALS(E, Ecol);
+    }
+  }
+
+  void test_columnar_storage_histogram_by_step() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_uniform_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      this->test_setX();
+
+      EventList columnar(el);
+      columnar.setColumnarStorage(true);
+
+      MantidVec Y, E, Ycol, Ecol;
+      el.generateHistogram(BIN_DELTA, el.readX(), Y, E);
+      columnar.generateHistogram(BIN_DELTA, columnar.readX(), Ycol, Ecol);
+      TS_ASSERT(!columnar.isSortedByTof());
+      TS_ASSERT_EQUALS(Y, Ycol);
+      TS_ASSERT_EQUALS(E, Ecol);
+    }
+  }
+
+  void test_columnar_storage_sort_integrate_and_convertTof() {
+    el = EventList();
+    el += TofEvent(300., 3);
+    el += TofEvent(100., 1);
+    el += TofEvent(200., 2);
+    el.switchTo(WEIGHTED);
+    el.setColumnarStorage(true);
+
+    el.sortTof();
+    TS_ASSERT(el.hasColumnarStorage());
+    TS_ASSERT_EQUALS(el.getTofs(), std::vector<double>({100., 200., 300.}));
+    TS_ASSERT_DELTA(el.integrate(150., 400., false), 2.0, 1e-10);
+    TS_ASSERT_DELTA(el.integrate(0., 0., true), 3.0, 1e-10);
+
+    el.convertTof(2., 1.);
+    TS_ASSERT(el.hasColumnarStorage());
+    TS_ASSERT_DELTA(el.getTofMin(), 201., 1e-10);
+    TS_ASSERT_DELTA(el.getTofMax(), 601., 1e-10);
+
+    // the pulse times travelled with the tofs through the sort
+    el.setColumnarStorage(false);
+    TS_ASSERT(!el.hasColumnarStorage());
+    const auto &events = el.getWeightedEvents();
+    TS_ASSERT_EQUALS(events[0].pulseTime(), DateAndTime(1));
+    TS_ASSERT_EQUALS(events[1].pulseTime(), DateAndTime(2));
+    TS_ASSERT_EQUALS(events[2].pulseTime(), DateAndTime(3));
+  }
+
+  void test_columnar_storage_converts_back_for_other_operations() {
+    this->fake_uniform_data();
+    const EventList original(el);
+    el.setColumnarStorage(true);
+    TS_ASSERT_EQUALS(el.getEvents().size(), original.getNumberEvents());
+    TS_ASSERT(!el.hasColumnarStorage());
+    TS_ASSERT(el == original);
+
+    el.setColumnarStorage(true);
+    el.reserve(original.getNumberEvents() + 1);
+    TS_ASSERT(!el.hasColumnarStorage());
+    el.addEventQuickly(TofEvent(5., 6));
+    TS_ASSERT_EQUALS(el.getNumberEvents(), original.getNumberEvents() + 1);
+  }
+
+  void test_columnar_storage_sorts_large_lists() {
+    el = EventList();
+    const size_t numEvents = 200000;
+    for (size_t i = 0; i < numEvents; ++i) {
+      const auto tof = static_cast<double>((i * 7919) % numEvents);
+      el += TofEvent(tof, static_cast<int64_t>(tof) * 3);
+    }
+    el.setColumnarStorage(true);
+    el.sortTof();
+    TS_ASSERT(el.hasColumnarStorage());
+    const auto tofs = el.getTofs();
+    TS_ASSERT(std::is_sorted(tofs.cbegin(), tofs.cend()));
+
+    el.setColumnarStorage(false);
+    const auto &events = el.getEvents();
+    TS_ASSERT_EQUALS(events.size(), numEvents);
+    for (size_t i = 0; i < numEvents; i += 997)
+      TS_ASSERT_EQUALS(events[i].pulseTime(), DateAndTime(static_cast<int64_t>(events[i].tof()) * 3));
+  }
+
+  void test_columnar_storage_concurrent_const_access() {
+    this->fake_uniform_data();
+    const size_t numEvents = el.getNumberEvents();
+    el.setColumnarStorage(true);
+    const EventList &constList = el;
+
+    std::vector<size_t> counts(16, 0);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 16; ++i) {
+      // odd iterations convert the list back to rows while the others read it
+      if (i % 2)
+        constList.sortTimeAtSample(1.0, 0.0);
+      counts[i] = constList.getNumberEvents();
+    }
+    TS_ASSERT(!el.hasColumnarStorage());
+    for (const auto count : counts)
+      TS_ASSERT_EQUALS(count, numEvents);
+  }
+
+  void test_compressed_pulse_times() {
+    el = EventList();
+    el += TofEvent(300., 30);
+    el += TofEvent(100., 10);
+    el += TofEvent(200., 20);
+    el += TofEvent(400., 10);
+    const EventList original(el);
+    const auto pulseTable = std::make_shared<const std::vector<int64_t>>(std::vector<int64_t>{10, 20, 30});
+
+    TS_ASSERT(el.compressPulseTimes(pulseTable));
+    TS_ASSERT(el.hasCompressedPulseTimes());
+    TS_ASSERT_EQUALS(el.getPulseTimes(), original.getPulseTimes());
+    TS_ASSERT_EQUALS(el.getPulseTimeMin(), DateAndTime(10));
+    TS_ASSERT_EQUALS(el.getPulseTimeMax(), DateAndTime(30));
+    TS_ASSERT_LESS_THAN(el.getMemorySize(), original.getMemorySize());
+
+    // filtering keeps the order and the compression
+    EventList filtered;
+    el.filterByPulseTime(DateAndTime(10), DateAndTime(30), filtered);
+    TS_ASSERT(filtered.hasCompressedPulseTimes());
+    TS_ASSERT_EQUALS(filtered.getTofs(), std::vector<double>({100., 200., 400.}));
+    const std::vector<DateAndTime> filteredPulseTimes{DateAndTime(10), DateAndTime(20), DateAndTime(10)};
+    TS_ASSERT_EQUALS(filtered.getPulseTimes(), filteredPulseTimes);
+
+    const MantidVec X{0., 15., 25., 35.};
+    MantidVec Y, E;
+    el.generateHistogramPulseTime(X, Y, E);
+    TS_ASSERT(el.hasCompressedPulseTimes());
+    TS_ASSERT_EQUALS(Y, MantidVec({2., 1., 1.}));
+    TS_ASSERT_DELTA(E[0], M_SQRT2, 1e-10);
+
+    // the pulse times follow the tofs through the sort and back to the events
+    el.sortTof();
+    TS_ASSERT(el.hasCompressedPulseTimes());
+    el.setColumnarStorage(false);
+    TS_ASSERT(!el.hasCompressedPulseTimes());
+    const auto &events = el.getEvents();
+    TS_ASSERT_EQUALS(events[0], TofEvent(100., 10));
+    TS_ASSERT_EQUALS(events[1], TofEvent(200., 20));
+    TS_ASSERT_EQUALS(events[2], TofEvent(300., 30));
+    TS_ASSERT_EQUALS(events[3], TofEvent(400., 10));
+  }
+
+  void test_compressed_pulse_times_needs_every_pulse() {
+    el = EventList();
+    el += TofEvent(100., 10);
+    el += TofEvent(200., 20);
+    const auto pulseTable = std::make_shared<const std::vector<int64_t>>(std::vector<int64_t>{10});
+    TS_ASSERT(!el.compressPulseTimes(pulseTable));
+    TS_ASSERT(!el.hasCompressedPulseTimes());
+    // the storage is left as it was
+    TS_ASSERT(!el.hasColumnarStorage());
+    TS_ASSERT_EQUALS(el.getPulseTimes(), std::vector<DateAndTime>({DateAndTime(10), DateAndTime(20)}));
+
+    el.setColumnarStorage(true);
+    TS_ASSERT(!el.compressPulseTimes(pulseTable));
+    TS_ASSERT(el.hasColumnarStorage());
+
+    el.switchTo(WEIGHTED_NOTIME);
+    TS_ASSERT(!el.compressPulseTimes(pulseTable));
+  }
+
   void test_histogram_tof_event_by_pulse_time() {
     // Generate TOF events with Pulse times uniformly distributed.
     EventList eList = this->fake_uniform_pulse_data();
@@ -1562,6 +1746,28 @@ public:
     }
   }
 
+  //-----------------------------------------------------------------------------------------------
+  void test_convertUnitsViaTof_closedForm_allTypes() {
+    const Mantid::Kernel::ClosedFormConversion linear{200., 1., false};
+    const Mantid::Kernel::ClosedFormConversion reciprocal{1e6, 0., true};
+    // Go through each possible EventType as the input, in both layouts
+    for (const bool columnar : {false, true}) {
+      for (int this_type = 0; this_type < 3; this_type++) {
+        this->fake_uniform_data();
+        el.switchTo(static_cast<EventType>(this_type));
+        el.setColumnarStorage(columnar);
+        size_t old_num = this->el.getNumberEvents();
+        this->el.convertUnitsViaTof(linear);
+        TS_ASSERT_EQUALS(old_num, this->el.getNumberEvents());
+        // Original tofs were 100, 5100, 10100, etc.
+        TSM_ASSERT_EQUALS(this_type, this->el.getEvent(0).tof(), 100 * 200. + 1.);
+        TSM_ASSERT_EQUALS(this_type, this->el.getEvent(1).tof(), 5100 * 200. + 1.);
+        this->el.convertUnitsViaTof(reciprocal);
+        TSM_ASSERT_EQUALS(this_type, this->el.getEvent(0).tof(), 1e6 / 20001.);
+      }
+    }
+  }
+
   void test_addPulseTime_allTypes() {
     // Go through each possible EventType as the input
     for (int this_type = 0; this_type < 3; this_type++) {
@@ -1940,6 +2146,41 @@ public:
     }
   }
 
+  void test_radix_sort_of_large_lists() {
+    // Large enough to use the radix sort; includes negative and repeated values
+    EventList source;
+    for (size_t i = 0; i < 250000; ++i)
+      source += TofEvent(static_cast<double>((i * 7919) % 20000) * 0.25 - 1000.0,
+                         DateAndTime(int64_t(1000000000000000000) + int64_t((i * 104729) % 3000) * 16666667));
+    std::vector<double> expectedTofs = source.getTofs();
+    std::sort(expectedTofs.begin(), expectedTofs.end());
+
+    for (const auto type : {TOF, WEIGHTED, WEIGHTED_NOTIME}) {
+      EventList e(source);
+      e.switchTo(type);
+      e.sortTof();
+      TS_ASSERT_EQUALS(e.getTofs(), expectedTofs);
+      if (type == WEIGHTED_NOTIME)
+        continue;
+
+      e.sortPulseTime();
+      const auto pulseTimes = e.getPulseTimes();
+      TS_ASSERT(std::is_sorted(pulseTimes.cbegin(), pulseTimes.cend()));
+
+      e.sortPulseTimeTOF();
+      bool sorted = true;
+      for (size_t i = 1; i < e.getNumberEvents(); ++i) {
+        const auto &previous = e.getEvent(i - 1);
+        const auto &current = e.getEvent(i);
+        if (current.pulseTime() < previous.pulseTime() ||
+            (current.pulseTime() == previous.pulseTime() && current.tof() < previous.tof()))
+          sorted = false;
+      }
+      TS_ASSERT(sorted);
+      TS_ASSERT_EQUALS(e.getNumberEvents(), source.getNumberEvents());
+    }
+  }
+
   //----------------------------------------------------------------------------------------------
   void test_compressEvents_InPlace_or_Not() {
     for (int this_type = 0; this_type < 3; this_type++) {
@@ -2872,6 +3113,68 @@ public:
     run_generateHistogramUnsortedTest(e, {1.05, -0.002, 1.1}, 45.);
   }
 
+  void test_generateHistogram_events_on_and_outside_bin_edges() {
+    // Events exactly on an edge belong to the bin starting at that edge, the last edge is exclusive
+    for (const auto type : {TOF, WEIGHTED, WEIGHTED_NOTIME}) {
+      EventList e;
+      for (const double tof : {-1.0, 0.0, 0.5, 1.0, 1.0, 2.5, 3.0, 3.5, 4.0, 7.0})
+        e += TofEvent(tof, 0);
+      e.switchTo(type);
+      e.sortTof();
+
+      MantidVec Y, E;
+      e.generateHistogram({0.0, 1.0, 2.0, 3.0, 4.0}, Y, E);
+      TS_ASSERT_EQUALS(Y, MantidVec({2.0, 2.0, 1.0, 2.0}));
+      TS_ASSERT_DELTA(E[0], std::sqrt(2.0), 1e-10);
+
+      // the same through the step path, which does not need sorted events
+      e.reverse();
+      e.generateHistogram(1.0, {0.0, 1.0, 2.0, 3.0, 4.0}, Y, E);
+      TS_ASSERT_EQUALS(Y, MantidVec({2.0, 2.0, 1.0, 2.0}));
+    }
+  }
+
+  void test_generateHistogram_sorted_many_events_per_bin() {
+    // Long runs of events inside a bin and empty bins in between exercise the galloping search
+    EventList e;
+    for (size_t i = 0; i < 5000; ++i)
+      e += WeightedEvent(static_cast<double>(i % 50) * 2.0, 0, 0.5, 0.25);
+    e.sortTof();
+
+    const MantidVec X{0.0, 10.0, 11.0, 12.0, 50.0, 150.0};
+    MantidVec Y, E;
+    e.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(Y, MantidVec({250.0, 50.0, 0.0, 950.0, 1250.0}));
+    TS_ASSERT_DELTA(E[3], std::sqrt(1900.0 * 0.25), 1e-10);
+  }
+
+  void test_generateHistogram_by_step_matches_sorted() {
+    // Compare the block-computed bin estimates of the step path against the bisection path
+    for (const auto type : {TOF, WEIGHTED, WEIGHTED_NOTIME}) {
+      for (const std::vector<double> &params : {std::vector<double>{1., 0.37, 1000.},
+                                                 std::vector<double>{1., -0.0013, 1000.}}) {
+        // unsorted events spread over and beyond the binning range
+        EventList e;
+        for (size_t i = 0; i < 20000; ++i)
+          e += TofEvent(std::fmod(static_cast<double>(i) * 7.31, 1100.0), 0);
+        e.switchTo(type);
+        MantidVec X;
+        VectorHelper::createAxisFromRebinParams(params, X, true);
+
+        EventList sorted(e);
+        sorted.sortTof();
+        MantidVec expectedY, expectedE, Y, E;
+        sorted.generateHistogram(X, expectedY, expectedE);
+        e.generateHistogram(params[1], X, Y, E);
+        TS_ASSERT_EQUALS(Y.size(), expectedY.size());
+        for (size_t i = 0; i < Y.size(); ++i) {
+          TS_ASSERT_DELTA(Y[i], expectedY[i], 1e-6);
+          TS_ASSERT_DELTA(E[i], expectedE[i], 1e-6);
+        }
+      }
+    }
+  }
+
   void test_generateHistogramUnsortedLinear_TOF_bad_params() {
     // putting incorrect parameters in generateHistogram should not cause segfault
     const auto e = createLinearTestData();
@@ -3066,6 +3369,10 @@ public:
 
   void test_sort_tof() { el_random.sortTof(); }
 
+  void test_sort_pulsetime() { el_random.sortPulseTime(); }
+
+  void test_sort_pulsetimetof() { el_random.sortPulseTimeTOF(); }
+
   void test_compressEvents() {
     EventList out_el;
     el_sorted.compressEvents(10.0, &out_el);
@@ -3099,6 +3406,51 @@ public:
     el_sorted_weighted.generateHistogram(coarseX, Y, E);
   }
 
+  void test_histogram_by_step_linear() {
+    MantidVec Y, E;
+    el_random.generateHistogram(1.0, fineX, Y, E);
+  }
+
+  void test_histogram_by_step_log() {
+    MantidVec X, Y, E;
+    VectorHelper::createAxisFromRebinParams({1.0, -0.0001, 10000.0}, X, true);
+    el_random.generateHistogram(-0.0001, X, Y, E);
+  }
+
+  void test_histogram_scaling_against_per_event_loops() {
+    // times the histogram kernels against the per-event loops they replaced, for growing numbers of events
+    for (const size_t numEvents : {size_t(1000000), size_t(10000000), size_t(100000000)}) {
+      EventList el;
+      auto &events = el.getEvents();
+      events.reserve(numEvents);
+      for (size_t i = 0; i < numEvents; i++)
+        events.emplace_back((rand() % 1000000) * 0.1, 0);
+      const std::string label = " for " + std::to_string(numEvents) + " events: ";
+
+      MantidVec Y, E;
+      Kernel::Timer timer;
+      el.generateHistogram(1.0, fineX, Y, E);
+      const double stepTime = timer.elapsed();
+      const auto stepReference = countsByStepPerEvent(events, 1.0, fineX);
+      const double stepReferenceTime = timer.elapsed();
+      TS_ASSERT_EQUALS(Y, stepReference);
+      TS_WARN("Histogram by step" + label + std::to_string(stepTime) + " s, per event " +
+              std::to_string(stepReferenceTime) + " s");
+
+      el.sortTof();
+      for (const MantidVec *X : {&fineX, &coarseX}) {
+        timer.reset();
+        el.generateHistogram(*X, Y, E);
+        const double sortedTime = timer.elapsed();
+        const auto sortedReference = countsSortedPerEvent(el.getEvents(), *X);
+        const double sortedReferenceTime = timer.elapsed();
+        TS_ASSERT_EQUALS(Y, sortedReference);
+        TS_WARN("Histogram of sorted events in " + std::to_string(X->size() - 1) + " bins" + label +
+                std::to_string(sortedTime) + " s, per event " + std::to_string(sortedReferenceTime) + " s");
+      }
+    }
+  }
+
   void test_maskTof() {
     TS_ASSERT_EQUALS(el_sorted.getNumberEvents(), 10000000);
     el_sorted.maskTof(25e3, 75e3);
@@ -3110,4 +3462,62 @@ public:
     double integ = el_sorted.integrate(25e3, 75e3, false);
     TS_ASSERT_DELTA(integ, 5e6, 1);
   }
+
+  void test_sort_tof_columnar() {
+    EventList columnar(el_random);
+    columnar.setColumnarStorage(true);
+    columnar.sortTof();
+  }
+
+  void test_convertTof_columnar() {
+    EventList columnar(el_random);
+    columnar.setColumnarStorage(true);
+    columnar.convertTof(2.5, 6.78);
+  }
+
+  void test_histogram_fine_columnar() {
+    EventList columnar(el_sorted), columnarWeighted(el_sorted_weighted);
+    columnar.setColumnarStorage(true);
+    columnarWeighted.setColumnarStorage(true);
+    MantidVec Y, E;
+    columnar.generateHistogram(fineX, Y, E);
+    columnarWeighted.generateHistogram(fineX, Y, E);
+  }
+
+  void test_integrate_columnar() {
+    EventList columnar(el_sorted);
+    columnar.setColumnarStorage(true);
+    double integ = columnar.integrate(25e3, 75e3, false);
+    TS_ASSERT_DELTA(integ, 5e6, 1);
+  }
+private:
+  /// Histogram sorted events by walking the bin edges one event at a time
+  static MantidVec countsSortedPerEvent(const std::vector<TofEvent> &events, const MantidVec &X) {
+    MantidVec Y(X.size() - 1, 0.);
+    auto itx = X.cbegin();
+    for (auto itev = std::lower_bound(events.cbegin(), events.cend(), TofEvent(X.front())); itev != events.cend();
+         ++itev) {
+      const double tof = itev->tof();
+      itx = std::find_if(itx, X.cend(), [tof](const double x) { return tof < x; });
+      if (itx == X.cend())
+        break;
+      ++Y[static_cast<size_t>(std::max(std::distance(X.cbegin(), itx) - 1, std::ptrdiff_t{0}))];
+    }
+    return Y;
+  }
+
+  /// Histogram events by estimating the bin of each event from the linear step
+  static MantidVec countsByStepPerEvent(const std::vector<TofEvent> &events, const double step, const MantidVec &X) {
+    MantidVec Y(X.size() - 1, 0.);
+    const double divisor = 1. / step;
+    const double offset = X.front() * divisor;
+    for (const auto &event : events) {
+      const double tof = event.tof();
+      if (tof < X.front() || tof >= X.back())
+        continue;
+      if (const auto bin = EventList::findLinearBin(X, tof, divisor, offset))
+        ++Y[bin.value()];
+    }
+    return Y;
+  }
 };
@@ -9,6 +9,7 @@
 #include "MantidKernel/Timer.h"
 #include <cxxtest/TestSuite.h>
 
+#include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 
 using namespace Mantid::DataObjects;
@@ -20,4 +21,70 @@ public:
     TS_ASSERT_THROWS_NOTHING(mru.MRUSize());
     TS_ASSERT_EQUALS(mru.MRUSize(), 0);
   }
+
+  void test_out_of_date_generation_is_not_found() {
+    EventWorkspaceMRU mru(1024 * 1024);
+    mru.ensureEnoughBuffersY(0);
+    mru.ensureEnoughBuffersE(0);
+    EventList list;
+    mru.insert(0, makeY(10), makeE(10), &list, 1);
+    TS_ASSERT(mru.findY(0, &list, 1));
+    TS_ASSERT(mru.findE(0, &list, 1));
+    TS_ASSERT(!mru.findY(0, &list, 2));
+    TS_ASSERT(!mru.findE(0, &list, 2));
+
+    const auto statistics = mru.getStatistics();
+    TS_ASSERT_EQUALS(statistics.hits, 2);
+    TS_ASSERT_EQUALS(statistics.misses, 2);
+    // the out of date histogram was dropped from the shared cache
+    TS_ASSERT_EQUALS(statistics.entries, 0);
+  }
+
+  void test_shared_cache_serves_other_threads() {
+    EventWorkspaceMRU mru(1024 * 1024);
+    mru.ensureEnoughBuffersY(1);
+    mru.ensureEnoughBuffersE(1);
+    EventList list;
+    const auto yData = makeY(10);
+    mru.insert(0, yData, makeE(10), &list, 3);
+    TS_ASSERT_EQUALS(mru.findY(1, &list, 3), yData);
+    TS_ASSERT_EQUALS(mru.getStatistics().entries, 1);
+
+    mru.deleteIndex(&list);
+    TS_ASSERT(!mru.findY(1, &list, 3));
+    TS_ASSERT_EQUALS(mru.getStatistics().entries, 0);
+  }
+
+  void test_memory_budget() {
+    EventWorkspaceMRU mru(0);
+    mru.ensureEnoughBuffersY(0);
+    mru.ensureEnoughBuffersE(0);
+    std::vector<EventList> lists(100);
+    for (auto &list : lists)
+      mru.insert(0, makeY(1000), makeE(1000), &list, 0);
+    // disabled
+    TS_ASSERT_EQUALS(mru.getStatistics().entries, 0);
+
+    const std::size_t budget = 16 * 64 * 1024;
+    mru.setMemoryBudget(budget);
+    TS_ASSERT_EQUALS(mru.getMemoryBudget(), budget);
+    for (auto &list : lists)
+      mru.insert(0, makeY(1000), makeE(1000), &list, 0);
+    const auto statistics = mru.getStatistics();
+    TS_ASSERT_LESS_THAN(0, statistics.entries);
+    TS_ASSERT_LESS_THAN(statistics.entries, lists.size());
+    TS_ASSERT_LESS_THAN_EQUALS(statistics.memory, budget);
+
+    mru.setMemoryBudget(0);
+    TS_ASSERT_EQUALS(mru.getStatistics().entries, 0);
+    TS_ASSERT_EQUALS(mru.getStatistics().memory, 0);
+  }
+
+private:
+  static EventWorkspaceMRU::YType makeY(const std::size_t size) {
+    return Mantid::Kernel::make_cow<Mantid::HistogramData::HistogramY>(size, 1.0);
+  }
+  static EventWorkspaceMRU::EType makeE(const std::size_t size) {
+    return Mantid::Kernel::make_cow<Mantid::HistogramData::HistogramE>(size, 1.0);
+  }
 };
@@ -489,6 +489,24 @@ public:
     do_test_binning(ws, axis3, expected_occupancy);
   }
 
+  void test_histogram_pulse_time_with_compressed_pulse_times() {
+    EventWorkspace_sptr ws = createEventWorkspace(true, false);
+    const size_t uncompressedSize = ws->getSpectrum(0).getMemorySize();
+    const auto pulseTimeMin = ws->getPulseTimeMin();
+    const auto pulseTimeMax = ws->getPulseTimeMax();
+
+    ws->compressPulseTimes();
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i)
+      TS_ASSERT(ws->getSpectrum(i).hasCompressedPulseTimes());
+    TS_ASSERT_LESS_THAN(ws->getSpectrum(0).getMemorySize(), uncompressedSize);
+    TS_ASSERT_EQUALS(ws->getPulseTimeMin(), pulseTimeMin);
+    TS_ASSERT_EQUALS(ws->getPulseTimeMax(), pulseTimeMax);
+
+    BinEdges axis(NUMBINS / 2, LinearGenerator(0.0, 2.0 * BIN_DELTA));
+    do_test_binning(ws, axis, 4);
+    TS_ASSERT(ws->getSpectrum(0).hasCompressedPulseTimes());
+  }
+
   void test_get_pulse_time_max() {
     DateAndTime min = DateAndTime(0);
     DateAndTime max = DateAndTime(1);
@@ -556,7 +574,8 @@ public:
   }
 
   void test_droppingOffMRU() {
-    // Try caching and most-recently-used MRU list.
+    // Try caching and most-recently-used MRU list, without the shared cache behind it.
+    ew->setHistogramCacheSize(0);
     EventWorkspace_const_sptr ew2 = std::dynamic_pointer_cast<const EventWorkspace>(ew);
 
     // OK, we grab data0 from the MRU.
@@ -579,6 +598,69 @@ public:
     TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
   }
 
+  void test_shared_histogram_cache_keeps_histograms_dropped_from_MRU() {
+    ew->setHistogramCacheSize(64 * 1024 * 1024);
+    const MantidVec &data0 = ew->readY(0);
+    const MantidVec &e300 = ew->readE(300);
+
+    // Fill up the MRU to make data0 and e300 drop off it
+    for (size_t i = 0; i < 200; i++)
+      MantidVec otherData = ew->readY(i);
+    TS_ASSERT_EQUALS(ew->MRUSize(), 50);
+
+    // the histograms are still held by the shared cache, so were not generated again
+    TS_ASSERT_EQUALS(&data0, &ew->readY(0));
+    TS_ASSERT_EQUALS(&e300, &ew->readE(300));
+
+    const auto statistics = ew->getHistogramCacheStatistics();
+    TS_ASSERT_EQUALS(statistics.misses, 201);
+    TS_ASSERT_EQUALS(statistics.hits, 3);
+    TS_ASSERT_EQUALS(statistics.entries, 201);
+    TS_ASSERT_LESS_THAN(201 * 2 * data0.size() * sizeof(double), statistics.memory);
+
+    // the cached histograms count towards the memory of the workspace
+    const size_t memoryWithCache = ew->getMemorySize();
+    ew->clearMRU();
+    TS_ASSERT_EQUALS(memoryWithCache - ew->getMemorySize(), statistics.memory);
+    TS_ASSERT_EQUALS(ew->getHistogramCacheStatistics().entries, 0);
+    TS_ASSERT_EQUALS(ew->getHistogramCacheStatistics().memory, 0);
+  }
+
+  void test_shared_histogram_cache_stays_within_budget() {
+    const size_t budget = 1024 * 1024;
+    ew->setHistogramCacheSize(budget);
+    for (size_t i = 0; i < ew->getNumberHistograms(); i++)
+      ew->readY(i);
+    const auto statistics = ew->getHistogramCacheStatistics();
+    TS_ASSERT_LESS_THAN_EQUALS(statistics.memory, budget);
+    TS_ASSERT_LESS_THAN(0, statistics.entries);
+    TS_ASSERT_LESS_THAN(statistics.entries, ew->getNumberHistograms());
+
+    // shrinking the budget drops histograms straight away
+    ew->setHistogramCacheSize(budget / 4);
+    TS_ASSERT_LESS_THAN_EQUALS(ew->getHistogramCacheStatistics().memory, budget / 4);
+  }
+
+  void test_changing_events_invalidates_cached_histogram() {
+    EventWorkspace_sptr ws = createFlatEventWorkspace();
+    TS_ASSERT_DELTA(ws->readY(0)[1], 2.0, 1e-6);
+    TS_ASSERT_DELTA(ws->readE(0)[1], std::sqrt(2.0), 1e-6);
+
+    // no clearMRU(): the new generation of the event list is enough
+    ws->getSpectrum(0) += TofEvent(1.5 * BIN_DELTA);
+    TS_ASSERT_DELTA(ws->readY(0)[1], 3.0, 1e-6);
+    TS_ASSERT_DELTA(ws->readE(0)[1], std::sqrt(3.0), 1e-6);
+
+    ws->getSpectrum(0) *= 3.0;
+    TS_ASSERT_DELTA(ws->readY(0)[1], 9.0, 1e-6);
+
+    // the other spectrum is still cached
+    ws->readY(1);
+    const auto hits = ws->getHistogramCacheStatistics().hits;
+    ws->readY(1);
+    TS_ASSERT_EQUALS(ws->getHistogramCacheStatistics().hits, hits + 1);
+  }
+
   void test_sortAll_TOF() {
     EventWorkspace_sptr test_in = WorkspaceCreationHelper::createRandomEventWorkspace(NUMBINS, NUMPIXELS);
 
@@ -812,7 +894,8 @@ public:
   void test_clearing_EventList_clears_MRU() {
     auto ws = WorkspaceCreationHelper::createRandomEventWorkspace(2, 1);
     auto y = ws->sharedY(0);
-    TS_ASSERT_EQUALS(y.use_count(), 2);
+    // held by the MRU of the thread and the shared cache
+    TS_ASSERT_EQUALS(y.use_count(), 3);
     ws->getSpectrum(0).clear();
     TS_ASSERT_EQUALS(y.use_count(), 1);
   }
@@ -839,7 +922,7 @@ public:
   void test_deleting_spectra_removes_them_from_MRU() {
     auto ws = WorkspaceCreationHelper::createRandomEventWorkspace(2, 1);
     auto y = ws->sharedY(0);
-    TS_ASSERT_EQUALS(y.use_count(), 2);
+    TS_ASSERT_EQUALS(y.use_count(), 3);
 
     auto &eventList = ws->getSpectrum(0);
     auto *memory = &eventList;
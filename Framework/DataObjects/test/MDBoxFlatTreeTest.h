@@ -11,6 +11,7 @@
 #include "MantidFrameworkTestHelpers/MDEventsTestHelper.h"
 
 #include <Poco/File.h>
+#include <algorithm>
 #include <cxxtest/TestSuite.h>
 #include <memory>
 
@@ -98,6 +99,42 @@ public:
       testFile.remove();
   }
 
+  void test_Morton_order_places_neighbouring_boxes_together_on_file() {
+    MDBoxFlatTree BoxTree;
+    BoxTree.initFlatStructure(spEw3, "aFile");
+    TS_ASSERT(!BoxTree.isMortonOrdered());
+    TS_ASSERT_THROWS_NOTHING(BoxTree.setBoxesFilePositions(false, true));
+    TS_ASSERT(BoxTree.isMortonOrdered());
+
+    const std::vector<uint64_t> &eventIndex = BoxTree.getEventIndex();
+    std::vector<Mantid::API::IMDNode *> leaves;
+    for (auto box : BoxTree.getBoxes()) {
+      if (box->isBox())
+        leaves.emplace_back(box);
+    }
+    std::sort(leaves.begin(), leaves.end(), [&eventIndex](const auto lhs, const auto rhs) {
+      return eventIndex[2 * lhs->getID()] < eventIndex[2 * rhs->getID()];
+    });
+
+    // the events of the boxes follow each other without gaps
+    uint64_t filePosition(0);
+    for (auto leaf : leaves) {
+      TS_ASSERT_EQUALS(filePosition, eventIndex[2 * leaf->getID()]);
+      filePosition += eventIndex[2 * leaf->getID() + 1];
+    }
+    TS_ASSERT_EQUALS(10000, filePosition);
+
+    // the boxes of the 10x10x10 grid start at one corner and end at the opposite one, and
+    // the first 27 boxes on file form the 3x3x3 block at the corner (top 2 bits of the key are 0)
+    TS_ASSERT_EQUALS(1000, leaves.size());
+    for (size_t d = 0; d < 3; d++) {
+      TS_ASSERT_DELTA(leaves.front()->getExtents(d).getMin(), 0.0, 1e-5);
+      TS_ASSERT_DELTA(leaves.back()->getExtents(d).getMax(), 10.0, 1e-5);
+      for (size_t i = 0; i < 27; i++)
+        TS_ASSERT_LESS_THAN_EQUALS(leaves[i]->getExtents(d).getMax(), 3.0 + 1e-5);
+    }
+  }
+
 private:
   Mantid::API::IMDEventWorkspace_sptr spEw3;
 };
@@ -0,0 +1,74 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/MDHistoOccupancy.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidFrameworkTestHelpers/MDEventsTestHelper.h"
+
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid;
+using namespace Mantid::DataObjects;
+
+class MDHistoOccupancyTest : public CxxTest::TestSuite {
+public:
+  static MDHistoOccupancyTest *createSuite() { return new MDHistoOccupancyTest(); }
+  static void destroySuite(MDHistoOccupancyTest *suite) { delete suite; }
+
+  void test_empty_arrays_have_no_occupied_tiles() {
+    const size_t length = 3 * MDHistoOccupancy::TILE_SIZE + 5;
+    std::vector<signal_t> zeros(length, 0);
+    MDHistoOccupancy occupancy(zeros.data(), zeros.data(), zeros.data(), length);
+
+    TS_ASSERT(!occupancy.anyOccupiedTile(0, length));
+  }
+
+  void test_any_of_signal_error_or_events_marks_a_tile_occupied() {
+    const size_t tile = MDHistoOccupancy::TILE_SIZE;
+    const size_t length = 4 * tile;
+    std::vector<signal_t> signals(length, 0), errorsSquared(length, 0), numEvents(length, 0);
+    signals[1] = -2.;
+    errorsSquared[2 * tile + 4] = 1.;
+    numEvents[3 * tile + 7] = 3.;
+    MDHistoOccupancy occupancy(signals.data(), errorsSquared.data(), numEvents.data(), length);
+
+    TS_ASSERT(occupancy.anyOccupiedTile(0, tile));
+    TS_ASSERT(!occupancy.anyOccupiedTile(tile, 2 * tile));
+    TS_ASSERT(occupancy.anyOccupiedTile(2 * tile, 3 * tile));
+    TS_ASSERT(occupancy.anyOccupiedTile(3 * tile, length));
+  }
+
+  void test_anyOccupiedTile() {
+    const size_t tile = MDHistoOccupancy::TILE_SIZE;
+    const size_t length = 5 * tile;
+    std::vector<signal_t> signals(length, 0), zeros(length, 0);
+    signals[2 * tile + 7] = 1.;
+    MDHistoOccupancy occupancy(signals.data(), zeros.data(), zeros.data(), length);
+
+    TS_ASSERT(!occupancy.anyOccupiedTile(0, 2 * tile));
+    TS_ASSERT(occupancy.anyOccupiedTile(0, 2 * tile + 1));
+    // Tile granularity: an empty voxel of an occupied tile counts
+    TS_ASSERT(occupancy.anyOccupiedTile(2 * tile, 2 * tile + 1));
+    TS_ASSERT(!occupancy.anyOccupiedTile(3 * tile, 10 * tile));
+    TS_ASSERT(!occupancy.anyOccupiedTile(7, 7));
+  }
+
+  void test_workspace_constructor() {
+    const size_t tile = MDHistoOccupancy::TILE_SIZE;
+    auto ws = MDEventsTestHelper::makeFakeMDHistoWorkspace(0.0, 4, 10, 10.0, 0.0, "", 0.0);
+    ws->setSignalAt(123, 2.0);
+    ws->setErrorSquaredAt(9876, 1.0);
+    MDHistoOccupancy occupancy(*ws);
+
+    TS_ASSERT(occupancy.anyOccupiedTile(0, tile));
+    TS_ASSERT(!occupancy.anyOccupiedTile(tile, 2 * tile));
+    TS_ASSERT(occupancy.anyOccupiedTile(2 * tile, 10000));
+  }
+};
@@ -865,6 +865,40 @@ public:
     TS_ASSERT(timesToStr(partials[TimeSplitter::NO_TARGET], EventSortType::PULSETIMETOF_SORT) == expected);
   }
 
+  void test_splitEventList_many_intervals_only_visits_destinations_with_events() {
+    const DateAndTime startTime{TWO};
+    // 100 pulses, 0.37 seconds apart, with 10 events each
+    EventList events = this->generateEvents(startTime, 0.37, 100, 10, EventType::WEIGHTED);
+    // 1000 intervals of 0.1 seconds. The events are over before destination 9 starts
+    std::vector<double> intervals(1000, 0.1);
+    std::vector<int> destinations;
+    for (int i = 0; i < 1000; ++i)
+      destinations.emplace_back(i < 500 ? i % 5 - 1 : 9);
+    TimeSplitter splitter = this->generateSplitter(startTime, intervals, destinations);
+
+    std::map<int, size_t> expected;
+    for (const auto &event : events.getWeightedEvents())
+      ++expected[splitter.valueAtTime(event.pulseTime())];
+
+    std::map<int, EventList> partials;
+    std::set<int> requested;
+    const auto getPartial = [&partials, &requested](const int destination) {
+      requested.insert(destination);
+      auto &partial = partials[destination];
+      partial.switchTo(EventType::WEIGHTED);
+      return &partial;
+    };
+    splitter.splitEventList(events, getPartial);
+
+    TS_ASSERT_EQUALS(requested, std::set<int>({TimeSplitter::NO_TARGET, 0, 1, 2, 3}));
+    for (const auto &[destination, partial] : partials) {
+      TS_ASSERT_EQUALS(partial.getNumberEvents(), expected[destination]);
+      TS_ASSERT_EQUALS(partial.getSortType(), EventSortType::PULSETIME_SORT);
+      const auto pulseTimes = partial.getPulseTimes();
+      TS_ASSERT(std::is_sorted(pulseTimes.cbegin(), pulseTimes.cend()));
+    }
+  }
+
   void test_copyAndAssignment() {
     // Create a small table workspace with some targets
     // By design, for a table workspace all times must be in seconds
@@ -351,4 +351,16 @@ public:
     std::cout << tim << " to set all detector IDs for " << nhist
               << " spectra, using the ISpectrum method (in parallel).\n";
   }
+
+  void test_create_clone_and_delete() {
+    CPUTimer tim;
+    auto workspace = std::make_unique<Workspace2D>();
+    workspace->initialize(nhist, 6, 5);
+    std::cout << tim << " to create a workspace with " << nhist << " spectra.\n";
+    auto cloned = workspace->clone();
+    std::cout << tim << " to clone a workspace with " << nhist << " spectra.\n";
+    workspace.reset();
+    cloned.reset();
+    std::cout << tim << " to delete two workspaces with " << nhist << " spectra.\n";
+  }
 };
@@ -140,6 +140,8 @@ public:
   double &back() { return m_data.back(); }
   const double &front() const { return m_data.front(); }
   const double &back() const { return m_data.back(); }
+  double *data() { return m_data.data(); }
+  const double *data() const { return m_data.data(); }
 
   // expose typedefs for the iterator types in the underlying container
   using iterator = std::vector<double>::iterator;
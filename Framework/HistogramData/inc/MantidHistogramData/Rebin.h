@@ -6,12 +6,49 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidHistogramData/BinEdges.h"
 #include "MantidHistogramData/DllConfig.h"
+#include "MantidHistogramData/HistogramX.h"
+#include "MantidKernel/cow_ptr.h"
+
+#include <vector>
+
 namespace Mantid {
 namespace HistogramData {
 class Histogram;
-class BinEdges;
+
+/** RebinOverlap : The overlaps between the bins of a histogram and a new set
+  of bin edges. Computing the overlaps is the expensive part of rebinning, so
+  when many histograms share the same X, as is common in a workspace, the
+  overlaps can be computed once and applied to each histogram in turn.
+*/
+class MANTID_HISTOGRAMDATA_DLL RebinOverlap {
+public:
+  RebinOverlap(const Histogram &input, const BinEdges &binEdges);
+
+  bool appliesTo(const Histogram &input, const BinEdges &binEdges) const;
+  Histogram rebin(const Histogram &input) const;
+
+private:
+  /// The overlap of an input bin with an output bin
+  struct Overlap {
+    size_t oldBin;
+    size_t newBin;
+    /// The width of the overlap on the x axis
+    double delta;
+    /// The width of the input bin
+    double oldWidth;
+  };
+
+  Histogram rebinCounts(const Histogram &input) const;
+  Histogram rebinFrequencies(const Histogram &input) const;
+
+  Kernel::cow_ptr<HistogramX> m_oldX;
+  BinEdges m_binEdges;
+  std::vector<Overlap> m_overlaps;
+};
 
 MANTID_HISTOGRAMDATA_DLL Histogram rebin(const Histogram &input, const BinEdges &binEdges);
+MANTID_HISTOGRAMDATA_DLL std::vector<Histogram> rebin(const std::vector<Histogram> &inputs, const BinEdges &binEdges);
 } // namespace HistogramData
 } // namespace Mantid
@@ -10,17 +10,15 @@
 #include "MantidHistogramData/Histogram.h"
 #include <algorithm>
 #include <numeric>
+#include <optional>
+#include <stdexcept>
 
-using Mantid::HistogramData::BinEdges;
-using Mantid::HistogramData::Counts;
-using Mantid::HistogramData::CountStandardDeviations;
-using Mantid::HistogramData::CountVariances;
-using Mantid::HistogramData::Frequencies;
-using Mantid::HistogramData::FrequencyStandardDeviations;
-using Mantid::HistogramData::Histogram;
 using Mantid::HistogramData::Exception::InvalidBinEdgesError;
 
+namespace Mantid::HistogramData {
+
 namespace {
+// Single pass rebinning, used when the overlaps would not be reused
 Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
   const auto &xold = input.x();
   const auto &yold = input.y();
@@ -138,7 +136,144 @@ Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
 }
 } // anonymous namespace
 
-namespace Mantid::HistogramData {
+/** Compute the overlaps between the bins of a histogram and a new set of bin
+ * edges.
+ * @param input :: a histogram with the X that will be rebinned.
+ * @param binEdges :: the new bin edges.
+ * @throws std::runtime_error if the input histogram xMode is not BinEdges
+ * @throws InvalidBinEdgesError for non-positive input/output bin widths
+ */
+RebinOverlap::RebinOverlap(const Histogram &input, const BinEdges &binEdges)
+    : m_oldX(input.sharedX()), m_binEdges(binEdges) {
+  if (input.xMode() != Histogram::XMode::BinEdges)
+    throw std::runtime_error("XMode must be Histogram::XMode::BinEdges for input histogram");
+
+  const auto &xold = *m_oldX;
+  const auto &xnew = m_binEdges.rawData();
+  const auto size_yold = xold.empty() ? 0 : xold.size() - 1;
+  const auto size_ynew = xnew.empty() ? 0 : xnew.size() - 1;
+  // every step of the walk below moves to the next input or output bin
+  m_overlaps.reserve(size_yold + size_ynew);
+  size_t iold = 0;
+  size_t inew = 0;
+
+  while ((inew < size_ynew) && (iold < size_yold)) {
+    const auto xo_low = xold[iold];
+    const auto xo_high = xold[iold + 1];
+    const auto xn_low = xnew[inew];
+    const auto xn_high = xnew[inew + 1];
+    const auto owidth = xo_high - xo_low;
+    const auto nwidth = xn_high - xn_low;
+
+    if (owidth <= 0.0 || nwidth <= 0.0) {
+      if (xo_high == -DBL_MAX && xo_low == -DBL_MAX) {
+        throw InvalidBinEdgesError("One or more x-values was unusually low "
+                                   "(below -1e100). This usually occurs when a "
+                                   "monitor spectrum has not been masked after "
+                                   "ConvertUnits has been run on the workspace");
+      } else {
+        throw InvalidBinEdgesError("Negative or zero bin widths not allowed.");
+      }
+    }
+
+    if (xn_high <= xo_low)
+      inew++; /* old and new bins do not overlap */
+    else if (xo_high <= xn_low)
+      iold++; /* old and new bins do not overlap */
+    else {
+      // delta is the overlap of the bins on the x axis
+      auto delta = xo_high < xn_high ? xo_high : xn_high;
+      delta -= xo_low > xn_low ? xo_low : xn_low;
+      m_overlaps.push_back({iold, inew, delta, owidth});
+
+      if (xn_high > xo_high) {
+        iold++;
+      } else {
+        inew++;
+      }
+    }
+  }
+}
+
+/** Check whether the overlaps can be used to rebin a histogram to a set of
+ * bin edges, i.e. whether both are the same as those the overlaps were
+ * computed from. X that is shared is recognised without comparing the values.
+ * @param input :: the histogram to check.
+ * @param binEdges :: the new bin edges to check.
+ * @returns True if the overlaps apply.
+ */
+bool RebinOverlap::appliesTo(const Histogram &input, const BinEdges &binEdges) const {
+  if (input.xMode() != Histogram::XMode::BinEdges)
+    return false;
+  const auto x = input.sharedX();
+  const auto edges = binEdges.cowData();
+  const auto ownEdges = m_binEdges.cowData();
+  return (x == m_oldX || *x == *m_oldX) && (edges == ownEdges || *edges == *ownEdges);
+}
+
+/** Rebins a histogram using the precomputed overlaps.
+ * @param input :: input histogram data to be rebinned. It must have the same
+ * X as the histogram the overlaps were computed from.
+ * @returns The rebinned histogram.
+ * @throws std::runtime_error if the input yMode is undefined
+ * @throws std::invalid_argument if the input has different X
+ */
+Histogram RebinOverlap::rebin(const Histogram &input) const {
+  if (!appliesTo(input, m_binEdges))
+    throw std::invalid_argument("The X of the input histogram does not match the X the rebin overlaps are for.");
+  if (input.yMode() == Histogram::YMode::Counts)
+    return rebinCounts(input);
+  else if (input.yMode() == Histogram::YMode::Frequencies)
+    return rebinFrequencies(input);
+  else
+    throw std::runtime_error("YMode must be defined for input histogram.");
+}
+
+Histogram RebinOverlap::rebinCounts(const Histogram &input) const {
+  const auto &yold = input.y();
+  const auto &eold = input.e();
+
+  const auto size_ynew = m_binEdges.size() - 1;
+  Counts newCounts(size_ynew);
+  CountVariances newCountVariances(size_ynew);
+  auto &ynew = newCounts.mutableData();
+  auto &enew = newCountVariances.mutableData();
+
+  for (const auto &overlap : m_overlaps) {
+    const auto iold = overlap.oldBin;
+    ynew[overlap.newBin] += yold[iold] * overlap.delta / overlap.oldWidth;
+    enew[overlap.newBin] += eold[iold] * eold[iold] * overlap.delta / overlap.oldWidth;
+  }
+
+  return Histogram(m_binEdges, newCounts, CountStandardDeviations(std::move(newCountVariances)));
+}
+
+Histogram RebinOverlap::rebinFrequencies(const Histogram &input) const {
+  const auto &yold = input.y();
+  const auto &eold = input.e();
+
+  const auto &xnew = m_binEdges.rawData();
+  const auto size_ynew = xnew.size() - 1;
+  Frequencies newFrequencies(size_ynew);
+  FrequencyStandardDeviations newFrequencyStdDev(size_ynew);
+  auto &ynew = newFrequencies.mutableData();
+  auto &enew = newFrequencyStdDev.mutableData();
+
+  for (const auto &overlap : m_overlaps) {
+    const auto iold = overlap.oldBin;
+    ynew[overlap.newBin] += yold[iold] * overlap.delta;
+    enew[overlap.newBin] += eold[iold] * eold[iold] * overlap.delta * overlap.oldWidth;
+  }
+
+  for (size_t i = 0; i < size_ynew; ++i) {
+    const auto width = xnew[i + 1] - xnew[i];
+    const auto factor = 1 / width;
+    ynew[i] *= factor;
+    enew[i] = sqrt(enew[i]) * factor;
+  }
+
+  return Histogram(m_binEdges, newFrequencies, newFrequencyStdDev);
+}
 
 /** Rebins data according to a new set of bin edges.
  * @param input :: input histogram data to be rebinned.
@@ -158,4 +293,34 @@ Histogram rebin(const Histogram &input, const BinEdges &binEdges) {
     throw std::runtime_error("YMode must be defined for input histogram.");
 }
 
+/** Rebins several histograms according to the same new set of bin edges. The
+ * bin overlaps are computed once for each run of histograms with the same X,
+ * so this is much faster than rebinning the histograms one at a time when
+ * they share their X. A histogram whose X differs from those of its
+ * neighbours is rebinned in a single pass.
+ * @param inputs :: input histograms to be rebinned.
+ * @param binEdges :: inputs will be rebinned according to this set of bin edges.
+ * @returns The rebinned histograms, in the order of the inputs.
+ * @throws std::runtime_error if an input histogram xmode is not BinEdges, an
+ * input yMode is undefined, or for non-positive input/output bin widths
+ */
+std::vector<Histogram> rebin(const std::vector<Histogram> &inputs, const BinEdges &binEdges) {
+  std::vector<Histogram> outputs;
+  outputs.reserve(inputs.size());
+  std::optional<RebinOverlap> overlap;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    const auto &input = inputs[i];
+    if (overlap && overlap->appliesTo(input, binEdges)) {
+      outputs.emplace_back(overlap->rebin(input));
+    } else if (i + 1 < inputs.size() &&
+               (inputs[i + 1].sharedX() == input.sharedX() || inputs[i + 1].x() == input.x())) {
+      overlap.emplace(input, binEdges);
+      outputs.emplace_back(overlap->rebin(input));
+    } else {
+      outputs.emplace_back(rebin(input, binEdges));
+    }
+  }
+  return outputs;
+}
+
 } // namespace Mantid::HistogramData
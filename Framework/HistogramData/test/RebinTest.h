@@ -353,6 +353,56 @@ public:
     TS_ASSERT_EQUALS(outFreq.e()[2], 0);
   }
 
+  void testRebinOverlapAppliesToSharedAndEqualX() {
+    const auto hist = getCountsHistogram();
+    const BinEdges edges{0.5, 2.5, 3, 7.25};
+    RebinOverlap overlap(hist, edges);
+
+    Histogram shared(hist);
+    shared.mutableY() *= 2.;
+    TS_ASSERT(overlap.appliesTo(shared, edges));
+    TS_ASSERT(overlap.appliesTo(getFrequencyHistogram(), BinEdges{0.5, 2.5, 3, 7.25}));
+    TS_ASSERT(!overlap.appliesTo(Histogram(BinEdges(10, LinearGenerator(0, 0.5)), Counts(9, 1.)), edges));
+    TS_ASSERT(!overlap.appliesTo(hist, BinEdges{0.5, 2.5, 3, 7.5}));
+    TS_ASSERT_THROWS(overlap.rebin(Histogram(BinEdges(10, LinearGenerator(0, 0.5)), Counts(9, 1.))),
+                     const std::invalid_argument &);
+  }
+
+  void testRebinOverlapMatchesRebin() {
+    const BinEdges edges{0.5, 2.5, 3, 7.25};
+    for (const auto &hist : {getCountsHistogram(), getFrequencyHistogram()}) {
+      const auto expected = rebin(hist, edges);
+      const auto out = RebinOverlap(hist, edges).rebin(hist);
+      TS_ASSERT_EQUALS(out.x(), expected.x());
+      TS_ASSERT_EQUALS(out.y(), expected.y());
+      TS_ASSERT_EQUALS(out.e(), expected.e());
+    }
+  }
+
+  void testRebinOverlapInvalidBinEdges() {
+    TS_ASSERT_THROWS(RebinOverlap(getCountsHistogram(), BinEdges{1, 2, 3, 3, 5, 7}), const InvalidBinEdgesError &);
+    TS_ASSERT_THROWS(RebinOverlap(Histogram(Points(5, LinearGenerator(0, 1)), Counts(5, 1.)), BinEdges{1, 2}),
+                     const std::runtime_error &);
+  }
+
+  void testRebinMultipleHistograms() {
+    const auto hist = getCountsHistogram();
+    Histogram scaled(hist);
+    scaled.mutableY() *= 3.;
+    const Histogram otherX(BinEdges(10, LinearGenerator(0.25, 0.9)), Counts(9, 2.));
+    const std::vector<Histogram> inputs{hist, scaled, otherX, hist, getFrequencyHistogram()};
+    const BinEdges edges(7, LinearGenerator(0, 1.5));
+
+    const auto outputs = rebin(inputs, edges);
+    TS_ASSERT_EQUALS(outputs.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      const auto expected = rebin(inputs[i], edges);
+      TS_ASSERT_EQUALS(outputs[i].yMode(), expected.yMode());
+      TS_ASSERT_EQUALS(outputs[i].y(), expected.y());
+      TS_ASSERT_EQUALS(outputs[i].e(), expected.e());
+    }
+  }
+
 private:
   Histogram getCountsHistogram() {
     return Histogram(BinEdges(10, LinearGenerator(0, 1)), Counts{10.5, 11.2, 19.3, 25.4, 36.8, 40.3, 17.7, 9.3, 4.6},
@@ -399,9 +449,23 @@ public:
       rebin(histFreq, lgBins);
   }
 
+  void testRebinSharedXSmallerBins() { rebin(std::vector<Histogram>(nIters, hist), smBins); }
+
+  void testRebinDistinctXSmallerBins() {
+    // no two histograms share X, so each is rebinned in a single pass
+    std::vector<Histogram> inputs;
+    for (size_t i = 0; i < nDistinct; i++) {
+      inputs.emplace_back(hist);
+      inputs.back().mutableX() += 0.001 * static_cast<double>(i);
+    }
+    for (size_t i = 0; i < nIters / nDistinct; i++)
+      rebin(inputs, smBins);
+  }
+
 private:
   const size_t binSize = 10000;
   const size_t nIters = 10000;
+  const size_t nDistinct = 100;
   Histogram hist;
   Histogram histFreq;
   BinEdges smBins;
@@ -0,0 +1,94 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/DllConfig.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Mantid {
+namespace Kernel {
+
+/** AsyncIOQueue: a FIFO of I/O operations executed by a dedicated worker thread.
+
+  It is used by file-backed workspaces to overlap disk access with computation:
+  reads of data which will be needed soon (read-ahead) and writes of data which
+  has left memory (write-behind) are queued here and the caller continues.
+
+  Tasks run one at a time and in the order they were pushed, so a task observes
+  the effect of every task pushed before it. Each push returns a ticket which
+  can be waited for. An exception thrown by a task is kept and rethrown from the
+  next wait, as the thread which caused it has usually moved on.
+
+  The worker thread is started by the first push, so an idle queue costs nothing.
+*/
+class MANTID_KERNEL_DLL AsyncIOQueue {
+public:
+  /// Identifies a pushed task; tickets increase in the order of pushing
+  using Ticket = uint64_t;
+
+  /// Counters describing how the queue has been used
+  struct Statistics {
+    /// number of tasks queued or running now
+    size_t queueDepth;
+    /// the largest queue depth seen
+    size_t maxQueueDepth;
+    /// number of tasks finished
+    uint64_t tasksCompleted;
+    /// total time (in seconds) callers spent blocked on the queue
+    double stallTime;
+  };
+
+  AsyncIOQueue(size_t maxQueueDepth = 256);
+  AsyncIOQueue(const AsyncIOQueue &) = delete;
+  AsyncIOQueue &operator=(const AsyncIOQueue &) = delete;
+  ~AsyncIOQueue();
+
+  Ticket push(std::function<void()> task);
+  void waitFor(const Ticket ticket);
+  void wait();
+  bool isComplete(const Ticket ticket) const;
+
+  Statistics getStatistics() const;
+
+private:
+  void run();
+  void blockUntil(std::unique_lock<std::mutex> &lock, const Ticket ticket);
+
+  /// the tasks not started yet
+  std::deque<std::function<void()>> m_tasks;
+  /// the number of tasks the queue may hold before push blocks
+  const size_t m_maxQueueDepth;
+  /// the ticket given to the last pushed task
+  Ticket m_lastPushed;
+  /// the ticket of the last finished task
+  Ticket m_lastCompleted;
+  /// the largest queue depth seen
+  size_t m_peakDepth;
+  /// the time callers spent blocked, in seconds
+  double m_stallTime;
+  /// the first failure of a task, not yet reported
+  std::exception_ptr m_error;
+  /// set to stop the worker thread
+  bool m_stop;
+
+  mutable std::mutex m_mutex;
+  /// signalled when a task is pushed or the queue is stopping
+  std::condition_variable m_taskPushed;
+  /// signalled when a task finishes
+  std::condition_variable m_taskDone;
+  /// the worker thread; started by the first push
+  std::thread m_worker;
+};
+
+} // namespace Kernel
+} // namespace Mantid
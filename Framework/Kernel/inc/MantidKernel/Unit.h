@@ -10,6 +10,8 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidKernel/UnitLabel.h"
+#include <optional>
+#include <span>
 #include <utility>
 
 #include <unordered_map>
@@ -29,6 +31,22 @@ enum class UnitParams { l2, twoTheta, efixed, delta, difa, difc, tzero };
 // where [] creates element with value 0 if param name not present
 using UnitParametersMap = std::unordered_map<UnitParams, double>;
 
+/** A conversion of the form y = factor * x + offset, or y = factor / x + offset
+    when reciprocal is set. Units whose conversion to and from time-of-flight has
+    this form return it from Unit::closedFormToTOF() and Unit::closedFormFromTOF(),
+    which lets whole arrays be converted without a virtual call per value.
+*/
+struct MANTID_KERNEL_DLL ClosedFormConversion {
+  double factor{1.};
+  double offset{0.};
+  bool reciprocal{false};
+
+  /// Convert a single value
+  double operator()(const double x) const { return (reciprocal ? factor / x : x * factor) + offset; }
+  void apply(double *first, double *last) const;
+  std::optional<ClosedFormConversion> then(const ClosedFormConversion &next) const;
+};
+
 /** The base units (abstract) class. All concrete units should inherit from
     this class and provide implementations of the caption(), label(),
     toTOF() and fromTOF() methods. They also need to declare (but NOT define)
@@ -137,9 +155,34 @@ public:
    */
   virtual double singleFromTOF(const double tof) const = 0;
 
+  /** Convert an array of X values to TOF in place. The unit must be
+   * initialized. The default calls singleToTOF() for each value; units
+   * override it with a loop that the compiler can inline and vectorise, so
+   * units that override singleToTOF() must override this too.
+   * @param values :: the values to convert
+   */
+  virtual void batchToTOF(std::span<double> values) const;
+
+  /** Convert an array of tof values to this unit in place. The unit must be
+   * initialized. Units that override singleFromTOF() must override this too.
+   * @param values :: the values to convert
+   */
+  virtual void batchFromTOF(std::span<double> values) const;
+
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
+  /** The conversion to time-of-flight in closed form, if it has one with the
+   * current parameters. The unit must be initialized. Units that override
+   * singleToTOF() must override this too.
+   */
+  virtual std::optional<ClosedFormConversion> closedFormToTOF() const;
+  /** The conversion from time-of-flight in closed form, if it has one with the
+   * current parameters. The unit must be initialized. Units that override
+   * singleFromTOF() must override this too.
+   */
+  virtual std::optional<ClosedFormConversion> closedFormFromTOF() const;
+
   /// some units can be converted from TOF only in the range of TOF ;
   /// This function returns minimal TOF value still reversibly convertible into
   /// the unit.
@@ -255,6 +298,10 @@ public:
   void init() override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
+  std::optional<ClosedFormConversion> closedFormToTOF() const override;
+  std::optional<ClosedFormConversion> closedFormFromTOF() const override;
   Unit *clone() const override;
   ///@return -DBL_MAX as ToF convertible to TOF for in any time range
   double conversionTOFMin() const override;
@@ -272,6 +319,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
+  std::optional<ClosedFormConversion> closedFormToTOF() const override;
+  std::optional<ClosedFormConversion> closedFormFromTOF() const override;
   void init() override;
   Unit *clone() const override;
 
@@ -301,6 +352,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -326,6 +379,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -355,6 +410,10 @@ public:
   const UnitLabel label() const override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
+  std::optional<ClosedFormConversion> closedFormToTOF() const override;
+  std::optional<ClosedFormConversion> closedFormFromTOF() const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -383,6 +442,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -410,6 +471,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
+  std::optional<ClosedFormConversion> closedFormToTOF() const override;
+  std::optional<ClosedFormConversion> closedFormFromTOF() const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -432,6 +497,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
+  std::optional<ClosedFormConversion> closedFormToTOF() const override;
+  std::optional<ClosedFormConversion> closedFormFromTOF() const override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
   double conversionTOFMax() const override;
@@ -450,6 +519,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -505,6 +576,8 @@ public:
 
   double singleToTOF(const double ki) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -533,6 +606,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
+  std::optional<ClosedFormConversion> closedFormToTOF() const override;
+  std::optional<ClosedFormConversion> closedFormFromTOF() const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -555,6 +632,10 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void batchToTOF(std::span<double> values) const override;
+  void batchFromTOF(std::span<double> values) const override;
+  std::optional<ClosedFormConversion> closedFormToTOF() const override;
+  std::optional<ClosedFormConversion> closedFormFromTOF() const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
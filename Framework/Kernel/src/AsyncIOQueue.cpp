@@ -0,0 +1,132 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/AsyncIOQueue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace Mantid::Kernel {
+
+/** Constructor
+ * @param maxQueueDepth :: the number of unfinished tasks the queue may hold.
+ *   Pushing more blocks the caller until the worker catches up, which bounds
+ *   the memory held by queued write-behind data.
+ */
+AsyncIOQueue::AsyncIOQueue(size_t maxQueueDepth)
+    : m_tasks(), m_maxQueueDepth(std::max<size_t>(maxQueueDepth, 1)), m_lastPushed(0), m_lastCompleted(0),
+      m_peakDepth(0), m_stallTime(0), m_error(), m_stop(false) {}
+
+/** Destructor. Runs the tasks still queued, then stops the worker thread.
+ * Failures of those tasks are dropped as there is nobody left to report them to.
+ */
+AsyncIOQueue::~AsyncIOQueue() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_taskPushed.notify_all();
+  if (m_worker.joinable())
+    m_worker.join();
+}
+
+/** Queue a task to be run by the worker thread.
+ * @param task :: the I/O operation. It must not push to or wait on this queue.
+ * @return the ticket identifying the task
+ */
+AsyncIOQueue::Ticket AsyncIOQueue::push(std::function<void()> task) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (!m_worker.joinable())
+    m_worker = std::thread(&AsyncIOQueue::run, this);
+
+  while (m_lastPushed - m_lastCompleted >= m_maxQueueDepth)
+    blockUntil(lock, m_lastPushed - m_maxQueueDepth + 1);
+
+  m_tasks.emplace_back(std::move(task));
+  const Ticket ticket = ++m_lastPushed;
+  m_peakDepth = std::max(m_peakDepth, static_cast<size_t>(m_lastPushed - m_lastCompleted));
+  lock.unlock();
+  m_taskPushed.notify_one();
+  return ticket;
+}
+
+/** Block until the task with the given ticket (and so every task pushed before
+ * it) has finished.
+ * @param ticket :: the ticket returned by push
+ * @throw the first exception thrown by any task since the last wait
+ */
+void AsyncIOQueue::waitFor(const Ticket ticket) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  blockUntil(lock, ticket);
+  if (m_error)
+    std::rethrow_exception(std::exchange(m_error, nullptr));
+}
+
+/** Block until every task pushed so far has finished.
+ * @throw the first exception thrown by any task since the last wait
+ */
+void AsyncIOQueue::wait() {
+  Ticket last;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    last = m_lastPushed;
+  }
+  waitFor(last);
+}
+
+/// @return true if the task with the given ticket has finished
+bool AsyncIOQueue::isComplete(const Ticket ticket) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_lastCompleted >= ticket;
+}
+
+/// @return the current usage counters of the queue
+AsyncIOQueue::Statistics AsyncIOQueue::getStatistics() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return Statistics{static_cast<size_t>(m_lastPushed - m_lastCompleted), m_peakDepth, m_lastCompleted, m_stallTime};
+}
+
+/** Wait on the done-condition until the given ticket completes, adding the time
+ * spent to the stall counter.
+ * @param lock :: the held lock on m_mutex
+ * @param ticket :: the ticket to wait for
+ */
+void AsyncIOQueue::blockUntil(std::unique_lock<std::mutex> &lock, const Ticket ticket) {
+  if (m_lastCompleted >= ticket)
+    return;
+  const auto start = std::chrono::steady_clock::now();
+  m_taskDone.wait(lock, [this, ticket] { return m_lastCompleted >= ticket; });
+  m_stallTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// The body of the worker thread: run the tasks in order until stopped and empty
+void AsyncIOQueue::run() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_taskPushed.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+    if (m_tasks.empty())
+      return;
+    auto task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+    lock.unlock();
+
+    std::exception_ptr error;
+    try {
+      task();
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    if (error && !m_error)
+      m_error = error;
+    ++m_lastCompleted;
+    m_taskDone.notify_all();
+  }
+}
+
+} // namespace Mantid::Kernel
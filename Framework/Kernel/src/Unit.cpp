@@ -155,9 +155,7 @@ void Unit::toTOF(std::vector<double> &xdata, std::vector<double> &ydata, const d
                  const UnitParametersMap &params) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _emode, params);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleToTOF(xdata[i]);
+  this->batchToTOF(xdata);
 }
 
 /** Convert a single value to TOF
@@ -185,9 +183,7 @@ void Unit::fromTOF(std::vector<double> &xdata, std::vector<double> &ydata, const
                    const UnitParametersMap &params) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _emode, params);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleFromTOF(xdata[i]);
+  this->batchFromTOF(xdata);
 }
 
 /** Convert a single value from TOF
@@ -202,6 +198,48 @@ double Unit::convertSingleFromTOF(const double xvalue, const double &l1, const i
   return this->singleFromTOF(xvalue);
 }
 
+/** Convert an array of values in place
+ * @param first :: the first value to convert
+ * @param last :: one past the last value to convert
+ */
+void ClosedFormConversion::apply(double *first, double *last) const {
+  // separate loops keep the branch out of the loop so that both can be vectorised
+  if (reciprocal) {
+    for (auto *x = first; x != last; ++x)
+      *x = factor / *x + offset;
+  } else {
+    for (auto *x = first; x != last; ++x)
+      *x = *x * factor + offset;
+  }
+}
+
+/** Combine this conversion with one applied after it
+ * @param next :: the conversion applied to the result of this one
+ * @return the combined conversion, if it also has a closed form
+ */
+std::optional<ClosedFormConversion> ClosedFormConversion::then(const ClosedFormConversion &next) const {
+  if (!next.reciprocal)
+    return ClosedFormConversion{next.factor * factor, next.factor * offset + next.offset, reciprocal};
+  // the reciprocal of a * x + b is not linear in x or 1 / x unless b is zero
+  if (offset == 0.)
+    return ClosedFormConversion{next.factor / factor, next.offset, !reciprocal};
+  return std::nullopt;
+}
+
+void Unit::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = this->singleToTOF(x);
+}
+
+void Unit::batchFromTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = this->singleFromTOF(x);
+}
+
+std::optional<ClosedFormConversion> Unit::closedFormToTOF() const { return std::nullopt; }
+
+std::optional<ClosedFormConversion> Unit::closedFormFromTOF() const { return std::nullopt; }
+
 std::pair<double, double> Unit::conversionRange() const {
   double u1 = this->singleFromTOF(this->conversionTOFMin());
   double u2 = this->singleFromTOF(this->conversionTOFMax());
@@ -291,6 +329,20 @@ double TOF::singleFromTOF(const double tof) const {
   return tof;
 }
 
+void TOF::batchToTOF(std::span<double> values) const {
+  // Nothing to do
+  UNUSED_ARG(values);
+}
+
+void TOF::batchFromTOF(std::span<double> values) const {
+  // Nothing to do
+  UNUSED_ARG(values);
+}
+
+std::optional<ClosedFormConversion> TOF::closedFormToTOF() const { return ClosedFormConversion(); }
+
+std::optional<ClosedFormConversion> TOF::closedFormFromTOF() const { return ClosedFormConversion(); }
+
 Unit *TOF::clone() const { return new TOF(*this); }
 double TOF::conversionTOFMin() const { return -DBL_MAX; }
 ///@return DBL_MAX as ToF convetanble to TOF for in any time range
@@ -398,6 +450,29 @@ double Wavelength::singleFromTOF(const double tof) const {
   x *= factorFrom;
   return x;
 }
+
+void Wavelength::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = Wavelength::singleToTOF(x);
+}
+
+void Wavelength::batchFromTOF(std::span<double> values) const {
+  for (auto &tof : values)
+    tof = Wavelength::singleFromTOF(tof);
+}
+
+std::optional<ClosedFormConversion> Wavelength::closedFormToTOF() const {
+  if (!isInitialized())
+    return std::nullopt;
+  return ClosedFormConversion{factorTo, (emode == 1 || emode == 2) ? sfpTo : 0., false};
+}
+
+std::optional<ClosedFormConversion> Wavelength::closedFormFromTOF() const {
+  if (!isInitialized())
+    return std::nullopt;
+  return ClosedFormConversion{factorFrom, do_sfpFrom ? -sfpFrom * factorFrom : 0., false};
+}
+
 ///@return  Minimal time of flight, which can be reversively converted into
 /// wavelength
 double Wavelength::conversionTOFMin() const {
@@ -480,6 +555,16 @@ double Energy::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+void Energy::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = Energy::singleToTOF(x);
+}
+
+void Energy::batchFromTOF(std::span<double> values) const {
+  for (auto &tof : values)
+    tof = Energy::singleFromTOF(tof);
+}
+
 Unit *Energy::clone() const { return new Energy(*this); }
 
 // ============================================================================================
@@ -547,6 +632,16 @@ double Energy_inWavenumber::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+void Energy_inWavenumber::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = Energy_inWavenumber::singleToTOF(x);
+}
+
+void Energy_inWavenumber::batchFromTOF(std::span<double> values) const {
+  for (auto &tof : values)
+    tof = Energy_inWavenumber::singleFromTOF(tof);
+}
+
 Unit *Energy_inWavenumber::clone() const { return new Energy_inWavenumber(*this); }
 
 // used in calculate of DIFC
@@ -743,6 +838,49 @@ double dSpacing::singleFromTOF(const double tof) const {
     return negativeConstantTerm / (0.5 * difc * (1 + sqrt(sqrtTerm)));
 }
 
+void dSpacing::batchToTOF(std::span<double> values) const {
+  if (!isInitialized())
+    throw std::runtime_error("dSpacingBase::batchToTOF called before object "
+                             "has been initialized.");
+  if (difa == 0.) {
+    for (auto &x : values)
+      x = difc * x + tzero;
+    return;
+  }
+  for (auto &x : values)
+    x = dSpacing::singleToTOF(x);
+}
+
+void dSpacing::batchFromTOF(std::span<double> values) const {
+  if (!isInitialized())
+    throw std::runtime_error("dSpacingBase::batchFromTOF called before object "
+                             "has been initialized.");
+  if (!toDSpacingError.empty())
+    throw std::runtime_error(toDSpacingError);
+  if (difa == 0.) {
+    // the common case, with no edge cases to check for each value
+    for (auto &tof : values)
+      tof = (tof - tzero) / difc;
+    return;
+  }
+  for (auto &tof : values)
+    tof = dSpacing::singleFromTOF(tof);
+}
+
+std::optional<ClosedFormConversion> dSpacing::closedFormToTOF() const {
+  // the quadratic term has no closed form inverse of this kind
+  if (!isInitialized() || difa != 0.)
+    return std::nullopt;
+  return ClosedFormConversion{difc, tzero, false};
+}
+
+std::optional<ClosedFormConversion> dSpacing::closedFormFromTOF() const {
+  // leave the errors and edge cases to singleFromTOF()
+  if (!isInitialized() || difa != 0. || difc == 0. || !toDSpacingError.empty())
+    return std::nullopt;
+  return ClosedFormConversion{1. / difc, -tzero / difc, false};
+}
+
 double dSpacing::conversionTOFMin() const {
   // quadratic only has a min if difa is positive
   if (difa > 0) {
@@ -842,6 +980,16 @@ double dSpacingPerpendicular::singleFromTOF(const double tof) const {
   double temp = tof / factorFrom;
   return sqrt(temp * temp - sfpFrom);
 }
+
+void dSpacingPerpendicular::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = dSpacingPerpendicular::singleToTOF(x);
+}
+
+void dSpacingPerpendicular::batchFromTOF(std::span<double> values) const {
+  for (auto &tof : values)
+    tof = dSpacingPerpendicular::singleFromTOF(tof);
+}
 double dSpacingPerpendicular::conversionTOFMin() const { return sqrt(-1.0 * sfpFrom); }
 double dSpacingPerpendicular::conversionTOFMax() const { return sqrt(std::numeric_limits<double>::max()) / factorFrom; }
 
@@ -893,6 +1041,28 @@ double MomentumTransfer::singleToTOF(const double x) const { return 2. * M_PI *
 //
 double MomentumTransfer::singleFromTOF(const double tof) const { return 2. * M_PI * difc / tof; }
 
+void MomentumTransfer::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = MomentumTransfer::singleToTOF(x);
+}
+
+void MomentumTransfer::batchFromTOF(std::span<double> values) const {
+  for (auto &tof : values)
+    tof = MomentumTransfer::singleFromTOF(tof);
+}
+
+std::optional<ClosedFormConversion> MomentumTransfer::closedFormToTOF() const {
+  if (!isInitialized())
+    return std::nullopt;
+  return ClosedFormConversion{2. * M_PI * difc, 0., true};
+}
+
+std::optional<ClosedFormConversion> MomentumTransfer::closedFormFromTOF() const {
+  if (!isInitialized())
+    return std::nullopt;
+  return ClosedFormConversion{2. * M_PI * difc, 0., true};
+}
+
 double MomentumTransfer::conversionTOFMin() const { return 2. * M_PI * difc / DBL_MAX; }
 double MomentumTransfer::conversionTOFMax() const { return DBL_MAX; }
 
@@ -915,6 +1085,20 @@ QSquared::QSquared() : MomentumTransfer() {
 double QSquared::singleToTOF(const double x) const { return MomentumTransfer::singleToTOF(sqrt(x)); }
 double QSquared::singleFromTOF(const double tof) const { return pow(MomentumTransfer::singleFromTOF(tof), 2); }
 
+void QSquared::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = QSquared::singleToTOF(x);
+}
+
+void QSquared::batchFromTOF(std::span<double> values) const {
+  for (auto &tof : values)
+    tof = QSquared::singleFromTOF(tof);
+}
+
+std::optional<ClosedFormConversion> QSquared::closedFormToTOF() const { return std::nullopt; }
+
+std::optional<ClosedFormConversion> QSquared::closedFormFromTOF() const { return std::nullopt; }
+
 double QSquared::conversionTOFMin() const { return 2 * M_PI * difc / sqrt(DBL_MAX); }
 double QSquared::conversionTOFMax() const {
   double tofmax = 2 * M_PI * difc / sqrt(DBL_MIN);
@@ -1042,6 +1226,16 @@ double DeltaE::singleFromTOF(const double tof) const {
     return DBL_MAX;
 }
 
+void DeltaE::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = DeltaE::singleToTOF(x);
+}
+
+void DeltaE::batchFromTOF(std::span<double> values) const {
+  for (auto &tof : values)
+    tof = DeltaE::singleFromTOF(tof);
+}
+
 double DeltaE::conversionTOFMin() const {
   double time(DBL_MAX); // impossible for elastic, this units do not work for elastic
   if (emode == 1 || emode == 2)
@@ -1223,6 +1417,16 @@ double Momentum::singleFromTOF(const double tof) const {
   return factorFrom / x;
 }
 
+void Momentum::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = Momentum::singleToTOF(x);
+}
+
+void Momentum::batchFromTOF(std::span<double> values) const {
+  for (auto &tof : values)
+    tof = Momentum::singleFromTOF(tof);
+}
+
 Unit *Momentum::clone() const { return new Momentum(*this); }
 
 // ============================================================================================
@@ -1273,6 +1477,20 @@ double SpinEchoLength::singleFromTOF(const double tof) const {
   return x;
 }
 
+void SpinEchoLength::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = SpinEchoLength::singleToTOF(x);
+}
+
+void SpinEchoLength::batchFromTOF(std::span<double> values) const {
+  for (auto &tof : values)
+    tof = SpinEchoLength::singleFromTOF(tof);
+}
+
+std::optional<ClosedFormConversion> SpinEchoLength::closedFormToTOF() const { return std::nullopt; }
+
+std::optional<ClosedFormConversion> SpinEchoLength::closedFormFromTOF() const { return std::nullopt; }
+
 Unit *SpinEchoLength::clone() const { return new SpinEchoLength(*this); }
 
 // ============================================================================================
@@ -1317,6 +1535,20 @@ double SpinEchoTime::singleFromTOF(const double tof) const {
   return x;
 }
 
+void SpinEchoTime::batchToTOF(std::span<double> values) const {
+  for (auto &x : values)
+    x = SpinEchoTime::singleToTOF(x);
+}
+
+void SpinEchoTime::batchFromTOF(std::span<double> values) const {
+  for (auto &tof : values)
+    tof = SpinEchoTime::singleFromTOF(tof);
+}
+
+std::optional<ClosedFormConversion> SpinEchoTime::closedFormToTOF() const { return std::nullopt; }
+
+std::optional<ClosedFormConversion> SpinEchoTime::closedFormFromTOF() const { return std::nullopt; }
+
 Unit *SpinEchoTime::clone() const { return new SpinEchoTime(*this); }
 
 // ================================================================================
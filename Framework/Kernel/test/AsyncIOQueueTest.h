@@ -0,0 +1,89 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/AsyncIOQueue.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+using Mantid::Kernel::AsyncIOQueue;
+
+class AsyncIOQueueTest : public CxxTest::TestSuite {
+public:
+  static AsyncIOQueueTest *createSuite() { return new AsyncIOQueueTest(); }
+  static void destroySuite(AsyncIOQueueTest *suite) { delete suite; }
+
+  void test_tasks_run_in_push_order() {
+    AsyncIOQueue queue;
+    std::vector<int> order;
+    for (int i = 0; i < 100; ++i)
+      queue.push([&order, i] { order.emplace_back(i); });
+    TS_ASSERT_THROWS_NOTHING(queue.wait());
+
+    TS_ASSERT_EQUALS(order.size(), 100);
+    for (int i = 0; i < 100; ++i)
+      TS_ASSERT_EQUALS(order[i], i);
+  }
+
+  void test_waitFor_completes_the_task_and_its_predecessors() {
+    AsyncIOQueue queue;
+    std::atomic<int> done(0);
+    AsyncIOQueue::Ticket ticket = 0;
+    for (int i = 0; i < 10; ++i) {
+      auto pushed = queue.push([&done] { ++done; });
+      if (i == 4)
+        ticket = pushed;
+    }
+    queue.waitFor(ticket);
+    TS_ASSERT(queue.isComplete(ticket));
+    TS_ASSERT_LESS_THAN_EQUALS(5, done.load());
+    queue.wait();
+    TS_ASSERT_EQUALS(done.load(), 10);
+  }
+
+  void test_failure_is_reported_by_the_next_wait_only() {
+    AsyncIOQueue queue;
+    bool ranAfterFailure(false);
+    queue.push([] { throw std::runtime_error("disk full"); });
+    queue.push([&ranAfterFailure] { ranAfterFailure = true; });
+
+    TS_ASSERT_THROWS(queue.wait(), const std::runtime_error &);
+    TS_ASSERT(ranAfterFailure);
+    TS_ASSERT_THROWS_NOTHING(queue.wait());
+  }
+
+  void test_statistics() {
+    AsyncIOQueue queue(2);
+    auto stats = queue.getStatistics();
+    TS_ASSERT_EQUALS(stats.queueDepth, 0);
+    TS_ASSERT_EQUALS(stats.tasksCompleted, 0);
+
+    for (int i = 0; i < 20; ++i)
+      queue.push([] {});
+    queue.wait();
+
+    stats = queue.getStatistics();
+    TS_ASSERT_EQUALS(stats.queueDepth, 0);
+    TS_ASSERT_EQUALS(stats.tasksCompleted, 20);
+    TS_ASSERT_LESS_THAN_EQUALS(stats.maxQueueDepth, 2);
+    TS_ASSERT_LESS_THAN_EQUALS(0., stats.stallTime);
+  }
+
+  void test_destructor_runs_queued_tasks() {
+    std::atomic<int> done(0);
+    {
+      AsyncIOQueue queue;
+      for (int i = 0; i < 10; ++i)
+        queue.push([&done] { ++done; });
+    }
+    TS_ASSERT_EQUALS(done.load(), 10);
+  }
+};
@@ -902,6 +902,124 @@ public:
     TS_ASSERT_THROWS(q.fromTOF(x, y, 1.0, 1, {{UnitParams::l2, 1.0}}), const std::runtime_error &)
   }
 
+  //----------------------------------------------------------------------
+  // Closed form conversion tests
+  //----------------------------------------------------------------------
+
+  void testClosedForm_matchesSingleConversions() {
+    const UnitParametersMap params{{UnitParams::l2, 1.1}, {UnitParams::twoTheta, 0.7}, {UnitParams::efixed, 12.0}};
+    for (const int emode : {0, 1, 2}) {
+      std::vector<std::unique_ptr<Unit>> units;
+      units.emplace_back(std::make_unique<Units::TOF>());
+      units.emplace_back(std::make_unique<Units::Wavelength>());
+      units.emplace_back(std::make_unique<Units::dSpacing>());
+      units.emplace_back(std::make_unique<Units::MomentumTransfer>());
+      for (auto &unit : units) {
+        unit->initialize(10.0, emode, params);
+        const auto toTOF = unit->closedFormToTOF();
+        const auto fromTOF = unit->closedFormFromTOF();
+        TS_ASSERT(toTOF);
+        TS_ASSERT(fromTOF);
+        if (!toTOF || !fromTOF)
+          continue;
+        for (const double x : {0.5, 1.5, 3.7}) {
+          TS_ASSERT_DELTA((*toTOF)(x), unit->singleToTOF(x), 1e-9 * std::fabs(unit->singleToTOF(x)));
+          TS_ASSERT_DELTA((*fromTOF)(1000. * x), unit->singleFromTOF(1000. * x),
+                          1e-9 * std::fabs(unit->singleFromTOF(1000. * x)));
+        }
+      }
+    }
+  }
+
+  void testClosedForm_then() {
+    const UnitParametersMap params{{UnitParams::l2, 1.1}, {UnitParams::twoTheta, 0.7}};
+    Units::dSpacing dspacing;
+    dspacing.initialize(10.0, 0, params);
+    Units::MomentumTransfer momentum;
+    momentum.initialize(10.0, 0, params);
+    Units::Wavelength wavelength;
+    wavelength.initialize(10.0, 0, params);
+
+    const auto dToQ = dspacing.closedFormToTOF()->then(*momentum.closedFormFromTOF());
+    const auto qToLambda = momentum.closedFormToTOF()->then(*wavelength.closedFormFromTOF());
+    TS_ASSERT(dToQ);
+    TS_ASSERT(qToLambda);
+    std::vector<double> x{0.5, 1.5, 3.7};
+    auto expected = x;
+    for (auto &value : expected)
+      value = wavelength.singleFromTOF(momentum.singleToTOF(value));
+    qToLambda->apply(x.data(), x.data() + x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      TS_ASSERT_DELTA(x[i], expected[i], 1e-9 * expected[i]);
+      TS_ASSERT_DELTA((*dToQ)(expected[i]), 2. * M_PI / expected[i], 1e-9 / expected[i]);
+    }
+
+    // the reciprocal of an offset value has no closed form
+    const ClosedFormConversion shifted{2., 1., false};
+    TS_ASSERT(!shifted.then(ClosedFormConversion{3., 0., true}));
+  }
+
+  void testBatch_matchesSingleConversions() {
+    const UnitParametersMap params{{UnitParams::l2, 1.1}, {UnitParams::twoTheta, 0.7}, {UnitParams::efixed, 12.0}};
+    const std::vector<double> input{0.0, 0.5, 1.5, 3.7, 250., 1234.5, 20000.};
+    for (const int emode : {0, 1, 2}) {
+      std::vector<std::unique_ptr<Unit>> units;
+      units.emplace_back(std::make_unique<Units::TOF>());
+      units.emplace_back(std::make_unique<Units::Wavelength>());
+      units.emplace_back(std::make_unique<Units::Energy>());
+      units.emplace_back(std::make_unique<Units::Energy_inWavenumber>());
+      units.emplace_back(std::make_unique<Units::dSpacing>());
+      units.emplace_back(std::make_unique<Units::MomentumTransfer>());
+      units.emplace_back(std::make_unique<Units::QSquared>());
+      units.emplace_back(std::make_unique<Units::Momentum>());
+      if (emode == 0) {
+        units.emplace_back(std::make_unique<Units::SpinEchoLength>());
+        units.emplace_back(std::make_unique<Units::SpinEchoTime>());
+      } else {
+        units.emplace_back(std::make_unique<Units::DeltaE>());
+        units.emplace_back(std::make_unique<Units::DeltaE_inWavenumber>());
+      }
+      for (auto &unit : units) {
+        unit->initialize(10.0, emode, params);
+        auto toTOF = input;
+        unit->batchToTOF(toTOF);
+        auto fromTOF = input;
+        unit->batchFromTOF(fromTOF);
+        for (size_t i = 0; i < input.size(); ++i) {
+          TSM_ASSERT_EQUALS(unit->unitID(), toTOF[i], unit->singleToTOF(input[i]));
+          TSM_ASSERT_EQUALS(unit->unitID(), fromTOF[i], unit->singleFromTOF(input[i]));
+        }
+      }
+    }
+  }
+
+  void testBatch_dSpacingWithDIFA() {
+    Units::dSpacing dspacing;
+    dspacing.initialize(1.0, 0, {{UnitParams::difc, 3.0}, {UnitParams::difa, 2.0}, {UnitParams::tzero, 1.0}});
+    std::vector<double> x{2.0, 3.0};
+    dspacing.batchToTOF(x);
+    TS_ASSERT_DELTA(x[0], 6.0 + 8.0 + 1.0, 0.0001);
+    dspacing.batchFromTOF(x);
+    TS_ASSERT_DELTA(x[0], 2.0, 0.0001);
+    TS_ASSERT_DELTA(x[1], 3.0, 0.0001);
+
+    Units::dSpacing uninitialized;
+    TS_ASSERT_THROWS(uninitialized.batchFromTOF(x), const std::runtime_error &);
+  }
+
+  void testClosedForm_notAvailable() {
+    Units::dSpacing dspacing;
+    TS_ASSERT(!dspacing.closedFormToTOF());
+    dspacing.initialize(1.0, 0, {{UnitParams::difc, 3.0}, {UnitParams::difa, 2.0}, {UnitParams::tzero, 1.0}});
+    TS_ASSERT(!dspacing.closedFormToTOF());
+    TS_ASSERT(!dspacing.closedFormFromTOF());
+
+    Units::Energy energy;
+    energy.initialize(1.0, 0, {{UnitParams::l2, 1.0}});
+    TS_ASSERT(!energy.closedFormToTOF());
+    TS_ASSERT(!energy.closedFormFromTOF());
+  }
+
   //----------------------------------------------------------------------
   // Momentum Squared tests
   //----------------------------------------------------------------------
@@ -58,12 +58,26 @@ private:
   /// Run the algorithm
   void exec() override;
 
+  /// Arrays that the signal, squared error and number of events are added to
+  struct Accumulator {
+    signal_t *signals;
+    signal_t *errors;
+    signal_t *numEvents;
+  };
+
   /// Helper method
   template <typename MDE, size_t nd> void binByIterating(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
+  /// Bin all the boxes in one pass, with one accumulator per thread
+  template <typename MDE, size_t nd>
+  void binBoxes(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws, const int numAccumulators);
+  /// Bin the boxes in chunks of the output workspace
+  template <typename MDE, size_t nd>
+  void binByChunks(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws, const bool doParallel);
 
   /// Method to bin a single MDBox
   template <typename MDE, size_t nd>
-  void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax);
+  void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax,
+                const Accumulator &accumulator);
 
   /// The output MDHistoWorkspace
   Mantid::DataObjects::MDHistoWorkspace_sptr outWS;
@@ -16,6 +16,8 @@
 #include "MantidMDAlgorithms/MDEventWSWrapper.h"
 #include "MantidMDAlgorithms/MDTransfFactory.h"
 
+#include <atomic>
+
 namespace Mantid {
 // Forward declarations
 namespace API {
@@ -43,13 +45,27 @@ protected:
 private:
   // function runs the conversion on
   size_t conversionChunk(size_t workspaceIndex) override;
+  // converts a single event list with the given Q converter, so that several
+  // threads can convert different spectra at once
+  size_t convertSpectrum(size_t workspaceIndex, MDTransfInterface &qConverter);
   // the pointer to the source event workspace as event ws does not work through
   // the public Matrix WS interface
   /**function converts particular type of events into MD space and add these
    * events to the workspace itself    */
-  template <class T> size_t convertEventList(size_t workspaceIndex);
+  template <class T> size_t convertEventList(size_t workspaceIndex, MDTransfInterface &qConverter);
 
   virtual void appendEventsFromInputWS(API::Progress *pProgress, const API::BoxController_sptr &bc);
+
+  // The members below are used by the PARALLEL_*_INTERRUPT_REGION macros, as
+  // in API::Algorithm
+  /// name reported when the parallel conversion fails
+  const std::string name() const { return "ConvToMDEventsWS"; }
+  /// throws API::Algorithm::CancelException if the conversion was cancelled
+  void interruption_point();
+  /// set when the calling algorithm has been asked to cancel
+  std::atomic<bool> m_cancel{false};
+  /// set when an exception was thrown in a parallel region
+  std::atomic<bool> m_parallelException{false};
 };
 
 } // namespace MDAlgorithms
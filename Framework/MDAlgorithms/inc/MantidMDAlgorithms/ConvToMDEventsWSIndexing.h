@@ -8,6 +8,7 @@
 
 #include "MantidMDAlgorithms/ConvToMDEventsWS.h"
 #include "MantidMDAlgorithms/MDEventTreeBuilder.h"
+#include <algorithm>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -121,13 +122,17 @@ std::vector<MDEventType<ND>> ConvToMDEventsWSIndexing::convertEvents() {
     getEventsFrom(el, events_ptr);
     const typename std::vector<EventType> &events = *events_ptr;
     std::vector<MDEventType<ND>> mdEventsForSpectrum;
+    // convert the units of all the events at once
+    std::vector<double> values(events.size());
+    std::transform(events.cbegin(), events.cend(), values.begin(), [](const EventType &event) { return event.tof(); });
+    localUnitConv.convertUnits(values);
     // Iterators to start/end
-    for (const auto &event : events) {
-      double val = localUnitConv.convertUnits(event.tof());
-      double signal = event.weight();
-      double errorSq = event.errorSquared();
+    auto val = values.cbegin();
+    for (auto event = events.cbegin(); event != events.cend(); ++event, ++val) {
+      double signal = event->weight();
+      double errorSq = event->errorSquared();
 
-      if (!localQConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
+      if (!localQConverter->calcMatrixCoord(*val, locCoord, signal, errorSq))
         continue; // skip ND outside the range
 
       mdEventsForSpectrum.emplace_back(MDEventMaker<ND, MDEventType>::makeMDEvent(
@@ -42,6 +42,8 @@ public:
 
   /// Returns a confidence value that this algorithm can load a file
   int confidence(Kernel::NexusHDF5Descriptor &descriptor) const override;
+  /// Check that the options can be used together
+  std::map<std::string, std::string> validateInputs() override;
 
 private:
   /// Initialise the properties
@@ -53,6 +53,8 @@ private:
   void finalizeOutput(const std::string &outputFile);
 
   uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox);
+  void readAheadSubBoxes(const API::IMDNode *TargetBox);
+  void mergeBoxRange(const size_t begin, const size_t end, const Kernel::DiskBuffer *DiskBuf);
 
   // the class which flatten the box structure and deal with it
   DataObjects::MDBoxFlatTree m_BoxStruct;
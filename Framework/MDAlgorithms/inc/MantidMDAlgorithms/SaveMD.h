@@ -30,6 +30,8 @@ public:
   int version() const override { return 1; };
   /// Algorithm's category for identification
   const std::string category() const override { return "MDAlgorithms\\DataHandling"; }
+  /// Check that the options can be used together
+  std::map<std::string, std::string> validateInputs() override;
 
 private:
   /// Initialise the properties
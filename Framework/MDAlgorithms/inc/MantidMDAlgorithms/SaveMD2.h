@@ -28,6 +28,8 @@ public:
   const std::vector<std::string> seeAlso() const override { return {"LoadMD", "SaveZODS"}; }
   /// Algorithm's category for identification
   const std::string category() const override { return "MDAlgorithms\\DataHandling"; }
+  /// Check that the options can be used together
+  std::map<std::string, std::string> validateInputs() override;
 
 private:
   /// Initialise the properties
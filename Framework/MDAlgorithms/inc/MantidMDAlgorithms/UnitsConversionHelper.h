@@ -13,6 +13,8 @@
 #include "MantidKernel/Unit.h"
 #include "MantidMDAlgorithms/MDWSDescription.h"
 
+#include <span>
+
 namespace Mantid {
 namespace MDAlgorithms {
 /**  The class helps to organize unit conversion when running transformation
@@ -65,6 +67,7 @@ public:
                   const DataObjects::TableWorkspace_const_sptr &DetWS, int Emode, bool forceViaTOF = false);
   void updateConversion(size_t i);
   double convertUnits(double val) const;
+  void convertUnits(std::span<double> values) const;
 
   bool isUnitConverted() const;
   std::pair<double, double> getConversionRange(double x1, double x2) const;
@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/BinMD.h"
+#include "MantidAPI/IBoxControllerIO.h"
 #include "MantidAPI/ImplicitFunctionFactory.h"
 #include "MantidDataObjects/CoordTransformAffine.h"
 #include "MantidDataObjects/CoordTransformAffineParser.h"
@@ -22,6 +23,8 @@
 #include "MantidKernel/Utils.h"
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+
 namespace Mantid::MDAlgorithms {
 
 // Register the algorithm into the AlgorithmFactory
@@ -65,9 +68,9 @@ void BinMD::init() {
   setPropertyGroup("IterateEvents", grp);
 
   declareProperty(std::make_unique<PropertyWithValue<bool>>("Parallel", false, Direction::Input),
-                  "Temporary parameter: true to run in parallel. This is ignored for "
-                  "file-backed workspaces, where running in parallel makes things slower "
-                  "due to disk thrashing.");
+                  "Run in parallel, each thread binning into its own copy of the output "
+                  "when it is small enough. This is ignored for file-backed workspaces, "
+                  "where running in parallel makes things slower due to disk thrashing.");
   setPropertyGroup("Parallel", grp);
 
   declareProperty(std::make_unique<WorkspaceProperty<IMDHistoWorkspace>>("TemporaryDataWorkspace", "", Direction::Input,
@@ -88,9 +91,11 @@ void BinMD::init() {
  *(inclusive)
  * @param chunkMax :: the maximum index in each dimension to consider "valid"
  *(exclusive)
+ * @param accumulator :: the arrays to add the signal, errors and events to
  */
 template <typename MDE, size_t nd>
-inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax) {
+inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax,
+                            const Accumulator &accumulator) {
   // An array to hold the rotated/transformed coordinates
   auto outCenter = std::vector<coord_t>(m_outD);
 
@@ -153,11 +158,11 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, c
       //        std::cout << "Box at " << box->getExtentsStr() << " is within a
       //        single bin.\n";
       // Add the CACHED signal from the entire box
-      signals[lastLinearIndex] += box->getSignal();
-      errors[lastLinearIndex] += box->getErrorSquared();
+      accumulator.signals[lastLinearIndex] += box->getSignal();
+      accumulator.errors[lastLinearIndex] += box->getErrorSquared();
       // TODO: If DataObjects get a weight, this would need to get the summed
       // weight.
-      numEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
+      accumulator.numEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
 
       // And don't bother looking at each event. This may save lots of time
       // loading from disk.
@@ -199,17 +204,50 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, c
 
     if (!badOne) {
       // Sum the signals as doubles to preserve precision
-      signals[linearIndex] += static_cast<signal_t>(it->getSignal());
-      errors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
+      accumulator.signals[linearIndex] += static_cast<signal_t>(it->getSignal());
+      accumulator.errors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
       // TODO: If DataObjects get a weight, this would need to get the summed
       // weight.
-      numEvents[linearIndex] += 1.0;
+      accumulator.numEvents[linearIndex] += 1.0;
     }
   }
   // Done with the events list
   box->releaseEvents();
 }
 
+namespace {
+/// The memory that may be used for the copies of the output that each thread
+/// accumulates into
+constexpr size_t MAX_ACCUMULATOR_BYTES = size_t(1) << 30;
+
+/**
+ * The number of threads that can accumulate into their own copy of the output
+ * within MAX_ACCUMULATOR_BYTES. The first thread uses the output itself.
+ * @param numBins :: the number of bins in the output
+ * @return the number of accumulators, at least 1
+ */
+int numberOfAccumulators(const size_t numBins) {
+  const size_t bytesPerAccumulator = std::max(size_t(1), 3 * numBins * sizeof(signal_t));
+  const size_t maxCopies = MAX_ACCUMULATOR_BYTES / bytesPerAccumulator;
+  return static_cast<int>(std::min(static_cast<size_t>(PARALLEL_GET_MAX_THREADS), maxCopies + 1));
+}
+
+/// How many boxes ahead of the one being binned are read from a file-backed workspace
+constexpr size_t READ_AHEAD_BOXES = 16;
+
+/**
+ * Ask the IO layer of a file-backed workspace to start reading a box which will
+ * be binned soon, so that reading overlaps binning.
+ * @param fileIO :: the IO of the workspace; nullptr if it is not file backed
+ * @param boxes :: the boxes being binned, in order
+ * @param index :: the index of the box to read
+ */
+void readAhead(const API::IBoxControllerIO *fileIO, const std::vector<API::IMDNode *> &boxes, const size_t index) {
+  if (fileIO && index < boxes.size())
+    fileIO->prefetch(boxes[index]->getISaveable());
+}
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Perform binning by iterating through every event and placing them in the
  *output workspace
@@ -218,11 +256,6 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, c
  */
 template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   BoxController_sptr bc = ws->getBoxController();
-  // store exisiting write buffer size for the future
-  // uint64_t writeBufSize =bc->getDiskBuffer().getWriteBufferSize();
-  // and disable write buffer (if any) for input MD Events for this algorithm
-  // purposes;
-  // bc->setCacheParameters(1,0);
 
   // Cache some data to speed up accessing them a bit
   indexMultiplier.resize(m_outD);
@@ -241,6 +274,123 @@ template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWo
     outWS->setTo(0.0, 0.0, 0.0);
   }
 
+  if (prog) {
+    prog->setNotifyStep(0.1);
+    prog->resetNumSteps(100, 0.00, 1.0);
+  }
+
+  // Do we actually do it in parallel?
+  bool doParallel = getProperty("Parallel");
+  // Not if file-backed!
+  if (bc->isFileBacked())
+    doParallel = false;
+
+  const int numAccumulators = doParallel ? numberOfAccumulators(outWS->getNPoints()) : 1;
+  if (doParallel && numAccumulators < 2) {
+    // The output is too large to copy for each thread, so the threads each
+    // bin into a separate part of it
+    binByChunks<MDE, nd>(ws, doParallel);
+  } else {
+    binBoxes<MDE, nd>(ws, numAccumulators);
+  }
+
+  // Now the implicit function
+  if (implicitFunction) {
+    if (prog)
+      prog->report("Applying implicit function.");
+    signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
+    outWS->applyImplicitFunction(implicitFunction.get(), nan, nan);
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+/** Bin every box that may contribute to the output. The box tree is walked
+ * once, then the boxes are shared out dynamically between the threads. Each
+ * thread adds into its own copy of the output, apart from the first that adds
+ * into the output itself, and the copies are added to the output at the end.
+ * Boxes that lie within a single output bin are added in one go using their
+ * cached signal, the others event by event.
+ *
+ * @param ws :: MDEventWorkspace of the given type.
+ * @param numAccumulators :: the number of threads, each with its own accumulator
+ */
+template <typename MDE, size_t nd>
+void BinMD::binBoxes(typename MDEventWorkspace<MDE, nd>::sptr ws, const int numAccumulators) {
+  BoxController_sptr bc = ws->getBoxController();
+
+  // The whole of the output
+  std::vector<size_t> binMin(m_outD, 0);
+  std::vector<size_t> binMax(m_outD);
+  for (size_t bd = 0; bd < m_outD; bd++)
+    binMax[bd] = m_binDimensions[bd]->getNBins();
+
+  // Leaf-only; no depth limit; only the boxes touching the output.
+  auto function = this->getImplicitFunctionForChunk(binMin.data(), binMax.data());
+  std::vector<API::IMDNode *> boxes;
+  ws->getBox()->getBoxes(boxes, 1000, true, function.get());
+  // Sort boxes by file position IF file backed. This reduces seeking time,
+  // hopefully.
+  if (bc->isFileBacked())
+    API::IMDNode::sortObjByID(boxes);
+  g_log.debug() << "Found " << boxes.size() << " boxes within the implicit function.\n";
+  if (prog)
+    prog->setNumSteps(boxes.size());
+
+  // Each box is read ahead by the thread that bins the box READ_AHEAD_BOXES before it
+  const API::IBoxControllerIO *fileIO = bc->isFileBacked() ? bc->getFileIO() : nullptr;
+  for (size_t i = 0; i < READ_AHEAD_BOXES; ++i)
+    readAhead(fileIO, boxes, i);
+
+  // The first thread accumulates straight into the output
+  const size_t numBins = outWS->getNPoints();
+  std::vector<std::vector<signal_t>> copies(3 * static_cast<size_t>(numAccumulators - 1));
+  std::vector<Accumulator> accumulators{{signals, errors, numEvents}};
+  for (size_t i = 0; i < copies.size(); i += 3) {
+    copies[i].resize(numBins, 0.);
+    copies[i + 1].resize(numBins, 0.);
+    copies[i + 2].resize(numBins, 0.);
+    accumulators.push_back({copies[i].data(), copies[i + 1].data(), copies[i + 2].data()});
+  }
+
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) num_threads(numAccumulators) if (numAccumulators > 1))
+  for (int64_t i = 0; i < static_cast<int64_t>(boxes.size()); ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    readAhead(fileIO, boxes, static_cast<size_t>(i) + READ_AHEAD_BOXES);
+    auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
+    // Perform the binning in this separate method.
+    if (box && !box->getIsMasked())
+      this->binMDBox(box, binMin.data(), binMax.data(), accumulators[PARALLEL_THREAD_NUMBER]);
+    if (prog)
+      prog->report();
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  if (accumulators.size() > 1) {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t bin = 0; bin < static_cast<int64_t>(numBins); ++bin) {
+      for (size_t acc = 1; acc < accumulators.size(); ++acc) {
+        signals[bin] += accumulators[acc].signals[bin];
+        errors[bin] += accumulators[acc].errors[bin];
+        numEvents[bin] += accumulators[acc].numEvents[bin];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+/** Bin the boxes in chunks along the first output dimension, each chunk
+ * finding the boxes that touch it and binning them into its own part of the
+ * output. This needs no extra memory, so it is used when the output is too
+ * large to copy for each thread.
+ *
+ * @param ws :: MDEventWorkspace of the given type.
+ * @param doParallel :: whether to process the chunks in parallel
+ */
+template <typename MDE, size_t nd>
+void BinMD::binByChunks(typename MDEventWorkspace<MDE, nd>::sptr ws, const bool doParallel) {
+  BoxController_sptr bc = ws->getBoxController();
+
   // The dimension (in the output workspace) along which we chunk for parallel
   // processing
   // TODO: Find the smartest dimension to chunk against
@@ -251,91 +401,77 @@ template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWo
   auto chunkNumBins = int(m_binDimensions[chunkDimension]->getNBins() / (PARALLEL_GET_MAX_THREADS * 2));
   if (chunkNumBins < 1)
     chunkNumBins = 1;
-
-  // Do we actually do it in parallel?
-  bool doParallel = getProperty("Parallel");
-  // Not if file-backed!
-  if (bc->isFileBacked())
-    doParallel = false;
   if (!doParallel)
     chunkNumBins = int(m_binDimensions[chunkDimension]->getNBins());
 
   // Total number of steps
   size_t progNumSteps = 0;
-  if (prog) {
-    prog->setNotifyStep(0.1);
-    prog->resetNumSteps(100, 0.00, 1.0);
-  }
+  const Accumulator output{signals, errors, numEvents};
 
   // Run the chunks in parallel. There is no overlap in the output workspace so
   // it is thread safe to write to it..
-
-    PRAGMA_OMP( parallel for schedule(dynamic,1) if (doParallel) )
-    for (int chunk = 0; chunk < int(m_binDimensions[chunkDimension]->getNBins()); chunk += chunkNumBins) {
-      PARALLEL_START_INTERRUPT_REGION
-      // Region of interest for this chunk.
-      std::vector<size_t> chunkMin(m_outD);
-      std::vector<size_t> chunkMax(m_outD);
-      for (size_t bd = 0; bd < m_outD; bd++) {
-        // Same limits in the other dimensions
-        chunkMin[bd] = 0;
-        chunkMax[bd] = m_binDimensions[bd]->getNBins();
-      }
-      // Parcel out a chunk in that single dimension dimension
-      chunkMin[chunkDimension] = size_t(chunk);
-      if (size_t(chunk + chunkNumBins) > m_binDimensions[chunkDimension]->getNBins())
-        chunkMax[chunkDimension] = m_binDimensions[chunkDimension]->getNBins();
-      else
-        chunkMax[chunkDimension] = size_t(chunk + chunkNumBins);
-
-      // Build an implicit function (it needs to be in the space of the
-      // MDEventWorkspace)
-      auto function = this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data());
-
-      // Use getBoxes() to get an array with a pointer to each box
-      std::vector<API::IMDNode *> boxes;
-      // Leaf-only; no depth limit; with the implicit function passed to it.
-      ws->getBox()->getBoxes(boxes, 1000, true, function.get());
-
-      // Sort boxes by file position IF file backed. This reduces seeking time,
-      // hopefully.
-      if (bc->isFileBacked())
-        API::IMDNode::sortObjByID(boxes);
-
-      // For progress reporting, the # of boxes
-      if (prog) {
-        PARALLEL_CRITICAL(BinMD_progress) {
-          g_log.debug() << "Chunk " << chunk << ": found " << boxes.size() << " boxes within the implicit function.\n";
-          progNumSteps += boxes.size();
-          prog->setNumSteps(progNumSteps);
-        }
+  PRAGMA_OMP( parallel for schedule(dynamic,1) if (doParallel) )
+  for (int chunk = 0; chunk < int(m_binDimensions[chunkDimension]->getNBins()); chunk += chunkNumBins) {
+    PARALLEL_START_INTERRUPT_REGION
+    // Region of interest for this chunk.
+    std::vector<size_t> chunkMin(m_outD);
+    std::vector<size_t> chunkMax(m_outD);
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      // Same limits in the other dimensions
+      chunkMin[bd] = 0;
+      chunkMax[bd] = m_binDimensions[bd]->getNBins();
+    }
+    // Parcel out a chunk in that single dimension dimension
+    chunkMin[chunkDimension] = size_t(chunk);
+    if (size_t(chunk + chunkNumBins) > m_binDimensions[chunkDimension]->getNBins())
+      chunkMax[chunkDimension] = m_binDimensions[chunkDimension]->getNBins();
+    else
+      chunkMax[chunkDimension] = size_t(chunk + chunkNumBins);
+
+    // Build an implicit function (it needs to be in the space of the
+    // MDEventWorkspace)
+    auto function = this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data());
+
+    // Use getBoxes() to get an array with a pointer to each box
+    std::vector<API::IMDNode *> boxes;
+    // Leaf-only; no depth limit; with the implicit function passed to it.
+    ws->getBox()->getBoxes(boxes, 1000, true, function.get());
+
+    // Sort boxes by file position IF file backed. This reduces seeking time,
+    // hopefully.
+    if (bc->isFileBacked())
+      API::IMDNode::sortObjByID(boxes);
+
+    // For progress reporting, the # of boxes
+    if (prog) {
+      PARALLEL_CRITICAL(BinMD_progress) {
+        g_log.debug() << "Chunk " << chunk << ": found " << boxes.size() << " boxes within the implicit function.\n";
+        progNumSteps += boxes.size();
+        prog->setNumSteps(progNumSteps);
       }
+    }
 
-      // Go through every box for this chunk.
-      for (auto &boxe : boxes) {
-        auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
-        // Perform the binning in this separate method.
-        if (box && !box->getIsMasked())
-          this->binMDBox(box, chunkMin.data(), chunkMax.data());
-
-        // Progress reporting
-        if (prog)
-          prog->report();
-        // For early cancelling of the loop
-        if (this->m_cancel)
-          break;
-      } // for each box in the vector
-      PARALLEL_END_INTERRUPT_REGION
-    } // for each chunk in parallel
-    PARALLEL_CHECK_INTERRUPT_REGION
-
-    // Now the implicit function
-    if (implicitFunction) {
+    // Go through every box for this chunk, reading ahead those on file.
+    const API::IBoxControllerIO *fileIO = bc->isFileBacked() ? bc->getFileIO() : nullptr;
+    for (size_t i = 0; i < READ_AHEAD_BOXES; ++i)
+      readAhead(fileIO, boxes, i);
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      readAhead(fileIO, boxes, i + READ_AHEAD_BOXES);
+      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
+      // Perform the binning in this separate method.
+      if (box && !box->getIsMasked())
+        this->binMDBox(box, chunkMin.data(), chunkMax.data(), output);
+
+      // Progress reporting
       if (prog)
-        prog->report("Applying implicit function.");
-      signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
-      outWS->applyImplicitFunction(implicitFunction.get(), nan, nan);
-    }
+        prog->report();
+      // For early cancelling of the loop
+      if (this->m_cancel)
+        break;
+    } // for each box in the vector
+    PARALLEL_END_INTERRUPT_REGION
+  } // for each chunk in parallel
+  PARALLEL_CHECK_INTERRUPT_REGION
 }
 
 //----------------------------------------------------------------------------------------------
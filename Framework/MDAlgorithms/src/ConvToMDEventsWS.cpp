@@ -6,12 +6,21 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/ConvToMDEventsWS.h"
 
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidMDAlgorithms/UnitsConversionHelper.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace Mantid::MDAlgorithms {
+namespace {
+/// logger used by the PARALLEL_*_INTERRUPT_REGION macros
+Kernel::Logger g_log("ConvToMDEventsWS");
+} // namespace
+
 /**function converts particular list of events of type T into MD workspace and
  * adds these events to the workspace itself  */
-template <class T> size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
+template <class T> size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex, MDTransfInterface &qConverter) {
 
   const Mantid::DataObjects::EventList &el = m_EventWS->getSpectrum(workspaceIndex);
   size_t numEvents = el.getNumberEvents();
@@ -27,7 +36,7 @@ template <class T> size_t ConvToMDEventsWS::convertEventList(size_t workspaceInd
   std::vector<coord_t> locCoord(m_Coord);
   // set up unit conversion and calculate up all coordinates, which depend on
   // spectra index only
-  if (!m_QConverter->calcYDepCoordinates(locCoord, workspaceIndex))
+  if (!qConverter.calcYDepCoordinates(locCoord, workspaceIndex))
     return 0; // skip if any y outsize of the range of interest;
   localUnitConv.updateConversion(workspaceIndex);
   //
@@ -51,12 +60,17 @@ template <class T> size_t ConvToMDEventsWS::convertEventList(size_t workspaceInd
   getEventsFrom(el, events_ptr);
   const typename std::vector<T> &events = *events_ptr;
 
+  // convert the units of all the events at once
+  std::vector<double> values(events.size());
+  std::transform(events.cbegin(), events.cend(), values.begin(), [](const T &event) { return event.tof(); });
+  localUnitConv.convertUnits(values);
+
   // Iterators to start/end
-  for (auto it = events.cbegin(); it != events.cend(); it++) {
-    double val = localUnitConv.convertUnits(it->tof());
+  auto val = values.cbegin();
+  for (auto it = events.cbegin(); it != events.cend(); ++it, ++val) {
     double signal = it->weight();
     double errorSq = it->errorSquared();
-    if (!m_QConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
+    if (!qConverter.calcMatrixCoord(*val, locCoord, signal, errorSq))
       continue; // skip ND outside the range
 
     sig_err.emplace_back(static_cast<float>(signal));
@@ -76,14 +90,26 @@ template <class T> size_t ConvToMDEventsWS::convertEventList(size_t workspaceInd
 /** The method runs conversion for a single event list, corresponding to a
  * particular workspace index */
 size_t ConvToMDEventsWS::conversionChunk(size_t workspaceIndex) {
+  return this->convertSpectrum(workspaceIndex, *m_QConverter);
+}
+
+/** The method runs conversion for a single event list using the given Q
+ * converter, which holds the state of the spectrum being converted. Different
+ * spectra can be converted at once with one converter per thread, as the
+ * events are added to the boxes under their own locks.
+ * @param workspaceIndex -- the workspace index of the event list to convert
+ * @param qConverter     -- the Q converter used by the calling thread
+ * @return the number of events added to the workspace
+ */
+size_t ConvToMDEventsWS::convertSpectrum(size_t workspaceIndex, MDTransfInterface &qConverter) {
 
   switch (m_EventWS->getSpectrum(workspaceIndex).getEventType()) {
   case Mantid::API::TOF:
-    return this->convertEventList<Mantid::Types::Event::TofEvent>(workspaceIndex);
+    return this->convertEventList<Mantid::Types::Event::TofEvent>(workspaceIndex, qConverter);
   case Mantid::API::WEIGHTED:
-    return this->convertEventList<Mantid::DataObjects::WeightedEvent>(workspaceIndex);
+    return this->convertEventList<Mantid::DataObjects::WeightedEvent>(workspaceIndex, qConverter);
   case Mantid::API::WEIGHTED_NOTIME:
-    return this->convertEventList<Mantid::DataObjects::WeightedEventNoTime>(workspaceIndex);
+    return this->convertEventList<Mantid::DataObjects::WeightedEventNoTime>(workspaceIndex, qConverter);
   default:
     throw std::runtime_error("EventList had an unexpected data type!");
   }
@@ -128,6 +154,15 @@ void ConvToMDEventsWS::runConversion(API::Progress *pProgress) {
   m_OutWSWrapper->pWorkspace()->setCoordinateSystem(m_coordinateSystem);
 }
 
+/** Throws if the calling algorithm has been asked to cancel. As in
+ * API::Algorithm, nothing is thrown from inside a parallel region.
+ */
+void ConvToMDEventsWS::interruption_point() {
+  IF_NOT_PARALLEL
+  if (m_cancel)
+    throw API::Algorithm::CancelException();
+}
+
 void ConvToMDEventsWS::appendEventsFromInputWS(API::Progress *pProgress, const API::BoxController_sptr &bc) {
   // Is the access to input events thread-safe?
   // bool MultiThreadedAdding = m_EventWS->threadSafe();
@@ -154,10 +189,35 @@ void ConvToMDEventsWS::appendEventsFromInputWS(API::Progress *pProgress, const A
   Kernel::ThreadPool tp(ts, nThreads, new API::Progress(*pProgress));
   //<<<--  Thread control stuff
 
+  // The spectra between two splits are converted and added concurrently, each
+  // thread with its own copy of the Q converter. The box structure does not
+  // change while events are added, and every MDBox locks its own events.
+  const int nWorkers = m_NumThreads < 0 ? PARALLEL_GET_MAX_THREADS : std::max(1, m_NumThreads);
+  std::vector<MDTransf_sptr> qConverters;
+  for (int i = 0; i < nWorkers; ++i)
+    qConverters.emplace_back(m_QConverter->clone());
+
   size_t eventsAdded = 0;
-  for (size_t wi = 0; wi < m_NSpectra; wi++) {
+  size_t wi = 0;
+  while (wi < m_NSpectra) {
+    // The number of input events bounds the number of converted ones, so the
+    // spectra are taken until the split would be due if all were converted.
+    const size_t firstSpectrum = wi;
+    size_t eventsToAdd = 0;
+    while (wi < m_NSpectra &&
+           !bc->shouldSplitBoxes(nEventsInWS + eventsToAdd, eventsAdded + eventsToAdd, lastNumBoxes))
+      eventsToAdd += m_EventWS->getSpectrum(wi++).getNumberEvents();
+
+    size_t nConverted = 0;
+    m_cancel = pProgress->hasCancellationBeenRequested();
+    PRAGMA_OMP(parallel for schedule(dynamic) num_threads(nWorkers) reduction(+ : nConverted))
+    for (auto i = static_cast<int64_t>(firstSpectrum); i < static_cast<int64_t>(wi); ++i) {
+      PARALLEL_START_INTERRUPT_REGION
+      nConverted += convertSpectrum(static_cast<size_t>(i), *qConverters[PARALLEL_THREAD_NUMBER]);
+      PARALLEL_END_INTERRUPT_REGION
+    }
+    PARALLEL_CHECK_INTERRUPT_REGION
 
-    size_t nConverted = conversionChunk(wi);
     eventsAdded += nConverted;
     nEventsInWS += nConverted;
     // Keep a running total of how many events we've added
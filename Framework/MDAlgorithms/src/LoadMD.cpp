@@ -11,6 +11,7 @@
 #include "MantidAPI/IMDWorkspace.h"
 #include "MantidAPI/RegisterFileLoader.h"
 #include "MantidAPI/WorkspaceHistory.h"
+#include "MantidKernel/ArrayProperty.h"
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidDataObjects/CoordTransformAffine.h"
 #include "MantidDataObjects/MDBoxFlatTree.h"
@@ -33,6 +34,7 @@
 #include "MantidNexusCpp/NeXusException.hpp"
 #include <boost/algorithm/string.hpp>
 #include <boost/regex.hpp>
+#include <algorithm>
 #include <vector>
 
 using namespace Mantid::Kernel;
@@ -42,6 +44,24 @@ using namespace Mantid::DataObjects;
 
 using file_holder_type = std::unique_ptr<Mantid::DataObjects::BoxControllerNeXusIO>;
 
+namespace {
+/// The largest number of events read at once, in units of the data chunk of the file
+constexpr uint64_t MAX_READ_CHUNKS = 100;
+
+/** @return true if the box overlaps the region
+ * @param box :: the box to check
+ * @param region :: min/max of each dimension of the region; empty for the whole space
+ */
+bool overlapsRegion(IMDNode *box, const std::vector<double> &region) {
+  for (size_t d = 0; d < region.size() / 2; d++) {
+    const auto &extents = box->getExtents(d);
+    if (extents.getMax() < region[2 * d] || extents.getMin() > region[2 * d + 1])
+      return false;
+  }
+  return true;
+}
+} // namespace
+
 namespace Mantid::MDAlgorithms {
 
 DECLARE_NEXUS_HDF5_FILELOADER_ALGORITHM(LoadMD)
@@ -99,12 +119,41 @@ void LoadMD::init() {
                   "If not specified, a default of 40% of free physical memory is used.");
   setPropertySettings("Memory", std::make_unique<EnabledWhenProperty>("FileBackEnd", IS_EQUAL_TO, "1"));
 
+  declareProperty(std::make_unique<ArrayProperty<double>>("RegionExtents"),
+                  "Optional, for MDEventWorkspaces loaded in memory: the minimum and maximum of "
+                  "each dimension (min0,max0,min1,max1,...) of the region to load. Only the events "
+                  "of the boxes overlapping the region are read; the other boxes are left empty.");
+  setPropertySettings("RegionExtents", std::make_unique<EnabledWhenProperty>("FileBackEnd", IS_EQUAL_TO, "0"));
+
   declareProperty("LoadHistory", true, "If true, the workspace history will be loaded");
 
   declareProperty(std::make_unique<WorkspaceProperty<IMDWorkspace>>("OutputWorkspace", "", Direction::Output),
                   "Name of the output MDEventWorkspace.");
 }
 
+//----------------------------------------------------------------------------------------------
+/** Reject a region to load when no events would be read into memory, as it
+ * would otherwise be ignored.
+ * @return map of property names to errors
+ */
+std::map<std::string, std::string> LoadMD::validateInputs() {
+  std::map<std::string, std::string> issues;
+  const std::vector<double> region = getProperty("RegionExtents");
+  if (region.empty())
+    return issues;
+  const bool fileBackEnd = getProperty("FileBackEnd");
+  const bool metadataOnly = getProperty("MetadataOnly");
+  const bool boxStructureOnly = getProperty("BoxStructureOnly");
+  if (fileBackEnd)
+    issues["RegionExtents"] = "RegionExtents cannot be used with FileBackEnd, which loads the events on demand.";
+  else if (metadataOnly || boxStructureOnly)
+    issues["RegionExtents"] = "RegionExtents cannot be used with MetadataOnly or BoxStructureOnly, which load no "
+                              "events.";
+  else if (region.size() % 2 != 0)
+    issues["RegionExtents"] = "RegionExtents must give a minimum and a maximum for each dimension.";
+  return issues;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
@@ -153,6 +202,9 @@ void LoadMD::execLoader() {
   // Open the entry
   m_file->openGroup(entryName, "NXentry");
 
+  if (entryName == "MDHistoWorkspace" && !getPointerToProperty("RegionExtents")->isDefault())
+    g_log.warning("RegionExtents is only used for MDEventWorkspaces; the whole MDHistoWorkspace is loaded.");
+
   // Check is SaveMD version 2 was used
   m_saveMDVersion = 0;
   if (m_file->hasAttr("SaveMDVersion"))
@@ -544,22 +596,60 @@ template <typename MDE, size_t nd> void LoadMD::doLoad(typename MDEventWorkspace
     loader->openFile(m_filename, "r");
 
     const std::vector<uint64_t> &BoxEventIndex = FlatBoxTree.getEventIndex();
-    prog->setNumSteps(numBoxes);
-    std::vector<coord_t> boxTemp;
+    const std::vector<double> region = getProperty("RegionExtents");
+    if (!region.empty() && region.size() != 2 * nd)
+      throw std::invalid_argument("RegionExtents must give the minimum and maximum of each of the " +
+                                  std::to_string(nd) + " dimensions.");
 
+    // the boxes to fill, in the order of their events in the file
+    std::vector<size_t> boxesToLoad;
     for (size_t i = 0; i < numBoxes; i++) {
-      prog->report();
-      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxTree[i]);
-      if (!box)
-        continue;
-
-      if (BoxEventIndex[2 * i + 1] > 0) // Load in memory NOT using the file as the back-end,
-      {
-        boxTree[i]->reserveMemoryForLoad(BoxEventIndex[2 * i + 1]);
-        boxTree[i]->loadAndAddFrom(loader.get(), BoxEventIndex[2 * i], static_cast<size_t>(BoxEventIndex[2 * i + 1]),
-                                   boxTemp);
+      if (BoxEventIndex[2 * i + 1] > 0 && dynamic_cast<MDBox<MDE, nd> *>(boxTree[i]) &&
+          overlapsRegion(boxTree[i], region))
+        boxesToLoad.emplace_back(i);
+    }
+    std::stable_sort(boxesToLoad.begin(), boxesToLoad.end(), [&BoxEventIndex](size_t lhs, size_t rhs) {
+      return BoxEventIndex[2 * lhs] < BoxEventIndex[2 * rhs];
+    });
+
+    // Boxes whose events follow each other in the file are read together. With
+    // the Morton layout the boxes of a region are mostly adjacent, so a region
+    // takes a few large reads rather than one read per box.
+    const uint64_t maxReadEvents = std::max<uint64_t>(loader->getDataChunk(), 1) * MAX_READ_CHUNKS;
+    prog->setNumSteps(boxesToLoad.size());
+    std::vector<coord_t> blockData;
+    std::vector<coord_t> boxTemp;
+    size_t numReads(0);
+    for (size_t first = 0; first < boxesToLoad.size();) {
+      const uint64_t blockStart = BoxEventIndex[2 * boxesToLoad[first]];
+      uint64_t blockEnd = blockStart + BoxEventIndex[2 * boxesToLoad[first] + 1];
+      size_t last = first + 1;
+      for (; last < boxesToLoad.size(); last++) {
+        const size_t i = boxesToLoad[last];
+        if (BoxEventIndex[2 * i] != blockEnd || blockEnd + BoxEventIndex[2 * i + 1] - blockStart > maxReadEvents)
+          break;
+        blockEnd += BoxEventIndex[2 * i + 1];
+      }
+
+      blockData.clear();
+      loader->loadBlock(blockData, blockStart, static_cast<size_t>(blockEnd - blockStart));
+      numReads++;
+      const size_t numColumns = blockData.size() / static_cast<size_t>(blockEnd - blockStart);
+
+      for (; first < last; first++) {
+        prog->report();
+        const size_t i = boxesToLoad[first];
+        auto boxBegin =
+            blockData.cbegin() + static_cast<std::ptrdiff_t>((BoxEventIndex[2 * i] - blockStart) * numColumns);
+        boxTemp.assign(boxBegin, boxBegin + static_cast<std::ptrdiff_t>(BoxEventIndex[2 * i + 1] * numColumns));
+
+        auto *box = static_cast<MDBox<MDE, nd> *>(boxTree[i]);
+        box->reserveMemoryForLoad(BoxEventIndex[2 * i + 1]);
+        MDE::dataToEvents(boxTemp, box->getEvents(), false);
+        box->releaseEvents();
       }
     }
+    g_log.debug() << "Read the events of " << boxesToLoad.size() << " boxes in " << numReads << " blocks.\n";
     loader->closeFile();
   } else // box structure and metadata only
   {
@@ -12,11 +12,13 @@
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/VectorHelper.h"
 #include "MantidNexusCpp/NeXusFile.hpp"
 
 #include <Poco/File.h>
+#include <algorithm>
 #include <boost/scoped_ptr.hpp>
 
 using namespace Mantid::Kernel;
@@ -25,6 +27,42 @@ using namespace Mantid::DataObjects;
 
 namespace Mantid::MDAlgorithms {
 
+namespace {
+/// How many boxes ahead of the one being merged are read from the input files
+constexpr size_t READ_AHEAD_BOXES = 16;
+/// The number of box ranges per thread in a parallel merge; more ranges balance the load better
+constexpr size_t RANGES_PER_THREAD = 4;
+
+/** Split the boxes into contiguous ranges holding similar numbers of events.
+ * @param boxes :: the boxes of the output workspace, in the order of their events on file
+ * @param eventIndex :: the file position and number of events of each box, by box ID
+ * @param numRanges :: the number of ranges wanted
+ * @return the [begin, end) indices into boxes of each range
+ */
+std::vector<std::pair<size_t, size_t>> splitIntoRanges(const std::vector<API::IMDNode *> &boxes,
+                                                       const std::vector<uint64_t> &eventIndex, size_t numRanges) {
+  uint64_t totalEvents(0);
+  for (const auto box : boxes)
+    totalEvents += eventIndex[2 * box->getID() + 1];
+  const uint64_t rangeSize = std::max<uint64_t>(totalEvents / std::max<size_t>(numRanges, 1), 1);
+
+  std::vector<std::pair<size_t, size_t>> ranges;
+  size_t begin(0);
+  uint64_t rangeEvents(0);
+  for (size_t ib = 0; ib < boxes.size(); ib++) {
+    rangeEvents += eventIndex[2 * boxes[ib]->getID() + 1];
+    if (rangeEvents >= rangeSize) {
+      ranges.emplace_back(begin, ib + 1);
+      begin = ib + 1;
+      rangeEvents = 0;
+    }
+  }
+  if (begin < boxes.size())
+    ranges.emplace_back(begin, boxes.size());
+  return ranges;
+}
+} // namespace
+
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(MergeMDFiles)
 
@@ -57,8 +95,8 @@ void MergeMDFiles::init() {
                   "If not, it will be created in memory.");
 
   declareProperty("Parallel", false,
-                  "Run the loading tasks in parallel.\n"
-                  "This can be faster but might use more memory.");
+                  "Merge ranges of boxes in parallel threads.\n"
+                  "This can be faster but uses memory for the events of one box per thread.");
 
   declareProperty(std::make_unique<WorkspaceProperty<IMDEventWorkspace>>("OutputWorkspace", "", Direction::Output),
                   "An output MDEventWorkspace.");
@@ -174,6 +212,56 @@ uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
   return nBoxEvents;
 }
 
+/** Ask the loaders to start reading the events of all files which contribute to
+ * a box of the output workspace, so that reading overlaps the merging of the
+ * boxes before it.
+ */
+void MergeMDFiles::readAheadSubBoxes(const API::IMDNode *TargetBox) {
+  if (!TargetBox->isBox())
+    return;
+  const size_t ID = TargetBox->getID();
+  for (size_t iw = 0; iw < this->m_EventLoader.size(); iw++) {
+    const auto &eventIndex = m_fileComponentsStructure[iw].getEventIndex();
+    m_EventLoader[iw]->prefetchBlock(eventIndex[2 * ID + 0], static_cast<size_t>(eventIndex[2 * ID + 1]));
+  }
+}
+
+/** Merge the events of all files into a range of boxes of the output workspace,
+ * one box at a time. A file-backed box is written to its place in the output
+ * file and dropped from memory as soon as it is complete.
+ * @param begin :: the index of the first box of the range
+ * @param end :: one past the index of the last box of the range
+ * @param DiskBuf :: the disk buffer of the output workspace; nullptr if it is in memory
+ */
+void MergeMDFiles::mergeBoxRange(const size_t begin, const size_t end, const Kernel::DiskBuffer *DiskBuf) {
+  const std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
+
+  for (size_t ib = begin; ib < std::min(end, begin + READ_AHEAD_BOXES); ib++)
+    this->readAheadSubBoxes(boxes[ib]);
+
+  uint64_t nRangeEvents(0);
+  for (size_t ib = begin; ib < end; ib++) {
+    if (ib + READ_AHEAD_BOXES < end)
+      this->readAheadSubBoxes(boxes[ib + READ_AHEAD_BOXES]);
+    auto box = boxes[ib];
+    if (!box->isBox())
+      continue;
+    // load all contributed events into current box;
+    nRangeEvents += this->loadEventsFromSubBoxes(box);
+
+    if (DiskBuf) {
+      if (box->getDataInMemorySize() > 0) { // data position has been already pre-calculated
+        box->getISaveable()->save();
+        box->clearDataFromMemory();
+      }
+    }
+    m_progress->report("Loading and merging box data");
+  }
+
+  std::lock_guard<std::mutex> lock(m_statsMutex);
+  m_totalLoaded += nRangeEvents;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform the merging, but clone the initial workspace and use the same
  *splitting
@@ -187,8 +275,7 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
   m_OutIWS = ws;
   m_MDEventType = ws->getEventTypeName();
 
-  // Run the tasks in parallel? TODO: enable
-  // bool Parallel = this->getProperty("Parallel");
+  bool Parallel = this->getProperty("Parallel");
 
   // Fix the box controller settings in the output workspace so that it splits
   // normally
@@ -224,64 +311,38 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
   m_progress = std::make_unique<Progress>(this, 0.1, 0.9, size_t(numBoxes));
   m_progress->setNotifyStep(0.1);
 
-  // For tracking progress
-  // uint64_t m_totalEventsInTasks = 0;
-
-  // Prepare thread pool
   CPUTimer overallTime;
 
-  auto ts = new ThreadSchedulerFIFO();
-  ThreadPool tp(ts);
-
   Kernel::DiskBuffer *DiskBuf(nullptr);
   if (m_fileBasedTargetWS) {
     DiskBuf = bc->getFileIO();
   }
 
   this->m_totalLoaded = 0;
-  const std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
-
-  for (size_t ib = 0; ib < numBoxes; ib++) {
-    auto box = boxes[ib];
-    if (!box->isBox())
-      continue;
-    // load all contributed events into current box;
-    this->loadEventsFromSubBoxes(box);
-
-    if (DiskBuf) {
-      if (box->getDataInMemorySize() > 0) { // data position has been already pre-calculated
-        box->getISaveable()->save();
-        box->clearDataFromMemory();
-        // Kernel::ISaveable *Saver = box->getISaveable();
-        // DiskBuf->toWrite(Saver);
-      }
+  if (Parallel) {
+    // Each thread merges its own ranges of boxes, streaming their events from
+    // all the input files. The places of the boxes in the output file were
+    // reserved by loadBoxData, so the threads write independently and each
+    // holds the events of one box only.
+    const auto ranges = splitIntoRanges(m_BoxStruct.getBoxes(), m_BoxStruct.getEventIndex(),
+                                        static_cast<size_t>(PARALLEL_GET_MAX_THREADS) * RANGES_PER_THREAD);
+    const auto numRanges = static_cast<int>(ranges.size());
+    PRAGMA_OMP(parallel for schedule(dynamic, 1))
+    for (int ir = 0; ir < numRanges; ir++) {
+      PARALLEL_START_INTERRUPT_REGION
+      this->mergeBoxRange(ranges[ir].first, ranges[ir].second, DiskBuf);
+      PARALLEL_END_INTERRUPT_REGION
     }
-    // else
-    //{   size_t ID = box->getID();
-    //    uint64_t filePosition = targetEventIndexes[2*ID];
-    //    box->saveAt(saver.get(), filePosition);
-    //}
-    //
-    // if (!Parallel)
-    //{
-    //  // Run the task serially only
-    //  task->run();
-    //  delete task;
-    //}
-    // else
-    //{
-    //  // Enqueue to run in parallel (at the joinAll() call below).
-    //  ts->push(task);
-    //}
-
-    m_progress->reportIncrement(ib, "Loading and merging box data");
+    PARALLEL_CHECK_INTERRUPT_REGION
+  } else {
+    this->mergeBoxRange(0, numBoxes, DiskBuf);
   }
+
   if (DiskBuf) {
     DiskBuf->flushCache();
     bc->getFileIO()->flushData();
   }
-  //// Run any final tasks
-  // tp.joinAll();
+  g_log.information() << m_totalLoaded << " events merged.\n";
   g_log.information() << overallTime << " to do all the adding.\n";
 
   // Close any open file handle
@@ -39,6 +39,17 @@ void prepareUpdate(MDBoxFlatTree &BoxFlatStruct, BoxController *bc, typename MDE
   // box structure
   BoxFlatStruct.initFlatStructure(ws, filename);
 }
+
+/** @return the boxes of the flat structure in the order of their events in the
+ * file, so that the file is written sequentially whatever the layout */
+std::vector<IMDNode *> boxesInFileOrder(MDBoxFlatTree &BoxFlatStruct) {
+  std::vector<IMDNode *> boxes = BoxFlatStruct.getBoxes();
+  const std::vector<uint64_t> &eventIndex = BoxFlatStruct.getEventIndex();
+  std::stable_sort(boxes.begin(), boxes.end(), [&eventIndex](const IMDNode *lhs, const IMDNode *rhs) {
+    return eventIndex[2 * lhs->getID()] < eventIndex[2 * rhs->getID()];
+  });
+  return boxes;
+}
 } // namespace
 
 namespace Mantid::MDAlgorithms {
@@ -70,6 +81,13 @@ void SaveMD::init() {
                   "This saves it to a file AND makes the workspace into a "
                   "file-backed one.");
   setPropertySettings("MakeFileBacked", std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
+
+  declareProperty("MortonOrder", false,
+                  "Only for MDEventWorkspaces which are not file backed: lay the events "
+                  "out in the file in the Morton (Z) order of the boxes, so that the "
+                  "events of a region of the workspace are close together and can be "
+                  "loaded with a few large reads.");
+  setPropertySettings("MortonOrder", std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -82,6 +100,7 @@ void SaveMD::init() {
 template <typename MDE, size_t nd> void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   bool updateFileBackend = getProperty("UpdateFileBackEnd");
   bool makeFileBackend = getProperty("MakeFileBacked");
+  bool mortonOrder = getProperty("MortonOrder");
   if (updateFileBackend && makeFileBackend)
     throw std::invalid_argument("Please choose either UpdateFileBackEnd or MakeFileBacked, not both.");
 
@@ -153,11 +172,11 @@ template <typename MDE, size_t nd> void SaveMD::doSaveEvents(typename MDEventWor
     if (makeFileBackend) {
       // store saver with box controller
       bc->setFileBacked(Saver, filename);
-      // get access to boxes array
-      std::vector<API::IMDNode *> &boxes = BoxFlatStruct.getBoxes();
       // calculate the position of the boxes on file, indicating to make them
       // saveable and that the boxes were not saved.
-      BoxFlatStruct.setBoxesFilePositions(true);
+      BoxFlatStruct.setBoxesFilePositions(true, mortonOrder);
+      // get access to boxes array, in the order of their data on file
+      std::vector<API::IMDNode *> boxes = boxesInFileOrder(BoxFlatStruct);
       prog->resetNumSteps(boxes.size(), 0.06, 0.90);
       for (auto &boxe : boxes) {
         auto saveableTag = boxe->getISaveable();
@@ -185,14 +204,15 @@ template <typename MDE, size_t nd> void SaveMD::doSaveEvents(typename MDEventWor
     } else // just save data, and finish with it
     {
       Saver->openFile(filename, "w");
-      BoxFlatStruct.setBoxesFilePositions(false);
-      std::vector<API::IMDNode *> &boxes = BoxFlatStruct.getBoxes();
+      BoxFlatStruct.setBoxesFilePositions(false, mortonOrder);
+      std::vector<API::IMDNode *> boxes = boxesInFileOrder(BoxFlatStruct);
       std::vector<uint64_t> &eventIndex = BoxFlatStruct.getEventIndex();
       prog->resetNumSteps(boxes.size(), 0.06, 0.90);
-      for (size_t i = 0; i < boxes.size(); i++) {
-        if (eventIndex[2 * i + 1] == 0 || boxes[i]->getIsMasked())
+      for (auto box : boxes) {
+        const size_t ID = box->getID();
+        if (eventIndex[2 * ID + 1] == 0 || box->getIsMasked())
           continue;
-        boxes[i]->saveAt(Saver.get(), eventIndex[2 * i]);
+        box->saveAt(Saver.get(), eventIndex[2 * ID]);
         prog->report("Saving Box");
       }
       Saver->closeFile();
@@ -296,6 +316,29 @@ void SaveMD::doSaveHisto(const Mantid::DataObjects::MDHistoWorkspace_sptr &ws) {
   file->close();
 }
 
+//----------------------------------------------------------------------------------------------
+/** Reject MortonOrder where the layout of the file is not chosen by this
+ * algorithm, as it would otherwise be ignored.
+ * @return map of property names to errors
+ */
+std::map<std::string, std::string> SaveMD::validateInputs() {
+  std::map<std::string, std::string> issues;
+  const bool mortonOrder = getProperty("MortonOrder");
+  if (!mortonOrder)
+    return issues;
+  const bool updateFileBackEnd = getProperty("UpdateFileBackEnd");
+  IMDWorkspace_sptr ws = getProperty("InputWorkspace");
+  const auto eventWS = std::dynamic_pointer_cast<IMDEventWorkspace>(ws);
+  if (updateFileBackEnd)
+    issues["MortonOrder"] = "MortonOrder cannot be used with UpdateFileBackEnd, which keeps the layout of the file.";
+  else if (ws && !eventWS)
+    issues["MortonOrder"] = "MortonOrder is only used for MDEventWorkspaces.";
+  else if (eventWS && eventWS->isFileBacked())
+    issues["MortonOrder"] = "MortonOrder cannot be used with a file-backed workspace, whose events keep the layout "
+                            "of its file.";
+  return issues;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
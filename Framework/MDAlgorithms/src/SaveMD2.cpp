@@ -59,6 +59,12 @@ void SaveMD2::init() {
                   "This saves it to a file AND makes the workspace into a "
                   "file-backed one.");
   setPropertySettings("MakeFileBacked", std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
+  declareProperty("MortonOrder", false,
+                  "Only for MDEventWorkspaces which are not file backed: lay the events "
+                  "out in the file in the Morton (Z) order of the boxes, so that the "
+                  "events of a region of the workspace are close together and can be "
+                  "loaded with a few large reads.");
+  setPropertySettings("MortonOrder", std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
   declareProperty("SaveHistory", true, "Option to not save the Mantid history in the file. Only for MDHisto");
   declareProperty("SaveInstrument", true, "Option to not save the instrument in the file. Only for MDHisto");
   declareProperty("SaveSample", true, "Option to not save the sample in the file. Only for MDHisto");
@@ -186,6 +192,29 @@ void SaveMD2::doSaveHisto(const Mantid::DataObjects::MDHistoWorkspace_sptr &ws)
   file->close();
 }
 
+//----------------------------------------------------------------------------------------------
+/** Reject MortonOrder where the layout of the file is not chosen by this
+ * algorithm, as it would otherwise be ignored.
+ * @return map of property names to errors
+ */
+std::map<std::string, std::string> SaveMD2::validateInputs() {
+  std::map<std::string, std::string> issues;
+  const bool mortonOrder = getProperty("MortonOrder");
+  if (!mortonOrder)
+    return issues;
+  const bool updateFileBackEnd = getProperty("UpdateFileBackEnd");
+  IMDWorkspace_sptr ws = getProperty("InputWorkspace");
+  const auto eventWS = std::dynamic_pointer_cast<IMDEventWorkspace>(ws);
+  if (updateFileBackEnd)
+    issues["MortonOrder"] = "MortonOrder cannot be used with UpdateFileBackEnd, which keeps the layout of the file.";
+  else if (ws && !eventWS)
+    issues["MortonOrder"] = "MortonOrder is only used for MDEventWorkspaces.";
+  else if (eventWS && eventWS->isFileBacked())
+    issues["MortonOrder"] = "MortonOrder cannot be used with a file-backed workspace, whose events keep the layout "
+                            "of its file.";
+  return issues;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
@@ -201,6 +230,7 @@ void SaveMD2::exec() {
     saveMDv1->setProperty<std::string>("Filename", getProperty("Filename"));
     saveMDv1->setProperty<bool>("UpdateFileBackEnd", getProperty("UpdateFileBackEnd"));
     saveMDv1->setProperty<bool>("MakeFileBacked", getProperty("MakeFileBacked"));
+    saveMDv1->setProperty<bool>("MortonOrder", getProperty("MortonOrder"));
     saveMDv1->execute();
   } else if (histoWS) {
     this->doSaveHisto(histoWS);
@@ -9,6 +9,8 @@
 #include "MantidAPI/IMDHistoWorkspace.h"
 #include "MantidAPI/IMDIterator.h"
 #include "MantidAPI/Progress.h"
+#include "MantidDataObjects/MDHistoOccupancy.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidDataObjects/MDHistoWorkspaceIterator.h"
 #include "MantidKernel/ArrayBoundedValidator.h"
 #include "MantidKernel/ArrayProperty.h"
@@ -24,6 +26,7 @@
 #include <map>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <sstream>
 #include <stack>
 #include <string>
@@ -174,6 +177,28 @@ IMDHistoWorkspace_sptr SmoothMD::hatSmooth(const IMDHistoWorkspace_const_sptr &t
 
   auto iterators = toSmooth->createIterators(nThreads, nullptr);
 
+  // Explicitly cast the doubles to int
+  // We've already checked in the validator that the doubles we have are odd
+  // integer values and well below max int
+  std::vector<int> widthVectorInt;
+  widthVectorInt.resize(widthVector.size());
+  std::transform(widthVector.cbegin(), widthVector.cend(), widthVectorInt.begin(),
+                 [](double w) -> int { return static_cast<int>(w); });
+
+  // Without weights, a point whose whole neighbourhood is empty stays empty and the
+  // cloned output already holds the result. Neighbours lie within `reach` linear
+  // indices, so a point can be skipped when no tile in that window is occupied.
+  std::optional<MDHistoOccupancy> occupancy;
+  size_t reach(0);
+  if (auto histo = std::dynamic_pointer_cast<const MDHistoWorkspace>(toSmooth); histo && !useWeights) {
+    occupancy.emplace(*histo);
+    size_t stride(1);
+    for (size_t d = 0; d < histo->getNumDims(); ++d) {
+      reach += stride * static_cast<size_t>(widthVectorInt[d] / 2);
+      stride *= histo->getDimension(d)->getNBins();
+    }
+  }
+
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int it = 0; it < int(iterators.size()); ++it) { // NOLINT
 
@@ -188,6 +213,12 @@ IMDHistoWorkspace_sptr SmoothMD::hatSmooth(const IMDHistoWorkspace_const_sptr &t
       // Gets all vertex-touching neighbours
       size_t iteratorIndex = iterator->getLinearIndex();
 
+      if (occupancy &&
+          !occupancy->anyOccupiedTile(iteratorIndex - std::min(iteratorIndex, reach), iteratorIndex + reach + 1)) {
+        progress.report();
+        continue; // Nothing to smooth here.
+      }
+
       if (useWeights) {
 
         // Check that we could measure here.
@@ -200,14 +231,6 @@ IMDHistoWorkspace_sptr SmoothMD::hatSmooth(const IMDHistoWorkspace_const_sptr &t
         }
       }
 
-      // Explicitly cast the doubles to int
-      // We've already checked in the validator that the doubles we have are odd
-      // integer values and well below max int
-      std::vector<int> widthVectorInt;
-      widthVectorInt.resize(widthVector.size());
-      std::transform(widthVector.cbegin(), widthVector.cend(), widthVectorInt.begin(),
-                     [](double w) -> int { return static_cast<int>(w); });
-
       std::vector<size_t> neighbourIndexes = iterator->findNeighbourIndexesByWidth(widthVectorInt);
 
       size_t nNeighbours = neighbourIndexes.size();
@@ -348,6 +348,35 @@ double UnitsConversionHelper::convertUnits(double val) const {
     throw std::runtime_error("updateConversion: unknown type of conversion requested");
   }
 }
+/** do actual unit conversion of an array of values in place. The kind of
+conversion is decided once for the whole array, and conversions through TOF
+use the batch methods of the units.
+@param   values  -- the input values which are replaced by the values in the
+                    units requested.
+*/
+void UnitsConversionHelper::convertUnits(std::span<double> values) const {
+  switch (m_UnitCnvrsn) {
+  case (CnvrtToMD::ConvertNo): {
+    return;
+  }
+  case (CnvrtToMD::ConvertFast): {
+    for (auto &val : values)
+      val = m_Factor * std::pow(val, m_Power);
+    return;
+  }
+  case (CnvrtToMD::ConvertFromTOF): {
+    m_TargetUnit->batchFromTOF(values);
+    return;
+  }
+  case (CnvrtToMD::ConvertByTOF): {
+    m_SourceWSUnit->batchToTOF(values);
+    m_TargetUnit->batchFromTOF(values);
+    return;
+  }
+  default:
+    throw std::runtime_error("updateConversion: unknown type of conversion requested");
+  }
+}
 // copy constructor;
 UnitsConversionHelper::UnitsConversionHelper(const UnitsConversionHelper &another) {
   m_UnitCnvrsn = another.m_UnitCnvrsn;
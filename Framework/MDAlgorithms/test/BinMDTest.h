@@ -260,6 +260,41 @@ public:
                  true /*IterateEvents*/, 20 /*numEventsPerBox*/, VMD(0, 0, 1));
   }
 
+  MDHistoWorkspace_sptr binInParallel(const IMDEventWorkspace_sptr &in_ws, const bool parallel) {
+    BinMD alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", in_ws);
+    alg.setPropertyValue("AlignedDim0", "Axis0,0.5,9.5, 6");
+    alg.setPropertyValue("AlignedDim1", "Axis1,0.0,10.0, 4");
+    alg.setPropertyValue("AlignedDim2", "Axis2,0.0,10.0, 10");
+    alg.setProperty("Parallel", parallel);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    IMDHistoWorkspace_sptr out = alg.getProperty("OutputWorkspace");
+    return std::dynamic_pointer_cast<MDHistoWorkspace>(out);
+  }
+
+  void test_parallel_matches_serial() {
+    Mantid::Geometry::QSample frame;
+    // enough events per box for whole boxes to be binned at once, with a
+    // binning that leaves some boxes straddling the output bins
+    IMDEventWorkspace_sptr in_ws =
+        MDEventsTestHelper::makeAnyMDEWWithFrames<MDLeanEvent<3>, 3>(10, 0.0, 10.0, frame, 20);
+    auto serial = binInParallel(in_ws, false);
+    auto parallel = binInParallel(in_ws, true);
+    TS_ASSERT_EQUALS(serial->getNPoints(), parallel->getNPoints());
+    double totalEvents = 0.;
+    for (size_t i = 0; i < serial->getNPoints(); ++i) {
+      TS_ASSERT_EQUALS(parallel->getSignalAt(i), serial->getSignalAt(i));
+      TS_ASSERT_EQUALS(parallel->getErrorAt(i), serial->getErrorAt(i));
+      TS_ASSERT_EQUALS(parallel->getNumEventsAt(i), serial->getNumEventsAt(i));
+      totalEvents += parallel->getNumEventsAt(i);
+    }
+    // the first and last half box along Axis0 are outside the output
+    TS_ASSERT_DELTA(totalEvents, 20. * 10 * 10 * 9, 1e-6);
+  }
+
   bool etta(int x, int base) {
     int ii = x - base / 2;
     if (ii < 0)
@@ -11,6 +11,8 @@
 #include "MantidFrameworkTestHelpers/MDEventsTestHelper.h"
 #include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
 #include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Timer.h"
 #include "MantidMDAlgorithms/ConvToMDSelector.h"
 #include "MantidMDAlgorithms/ConvertToMD.h"
 #include "MantidMDAlgorithms/PreprocessDetectorsToMD.h"
@@ -599,6 +601,52 @@ public:
             boost::lexical_cast<std::string>(sec) + " sec");
   }
 
+  void test_EventFromTOFConvThreadScaling() {
+    auto pAxis0 = std::make_unique<API::NumericAxis>(2);
+    pAxis0->setUnit("TOF");
+    inWsEv->replaceAxis(0, std::move(pAxis0));
+
+    std::vector<int> threads{1};
+    for (int nThreads = 2; nThreads <= PARALLEL_GET_MAX_THREADS; nThreads *= 2)
+      threads.emplace_back(nThreads);
+
+    double serialTime(0);
+    size_t serialPoints(0);
+    for (const int nThreads : threads) {
+      // ConvToMDBase takes the number of threads from this log
+      inWsEv->mutableRun().addProperty("NUM_THREADS", static_cast<double>(nThreads), true);
+
+      MDWSDescription WSD;
+      std::vector<double> min(4, -1e+30), max(4, 1e+30);
+      WSD.setMinMax(min, max);
+      WSD.buildFromMatrixWS(inWsEv, "Q3D", "Indirect");
+      WSD.m_PreprDetTable = pDetLoc_events;
+      WSD.m_RotMatrix = Rot;
+
+      pTargWS->releaseWorkspace();
+      pTargWS->createEmptyMDWS(WSD);
+
+      ConvToMDSelector AlgoSelector;
+      pConvMethods = AlgoSelector.convSelector(inWsEv, pConvMethods);
+      pConvMethods->initialize(WSD, pTargWS, false);
+
+      pMockAlgorithm->resetProgress(numHist);
+      Kernel::Timer timer;
+      TS_ASSERT_THROWS_NOTHING(pConvMethods->runConversion(pMockAlgorithm->getProgress()));
+      const double sec = timer.elapsed();
+
+      const size_t nPoints = pTargWS->pWorkspace()->getNPoints();
+      if (nThreads == 1) {
+        serialTime = sec;
+        serialPoints = nPoints;
+      }
+      TSM_ASSERT_EQUALS("The same events are added whatever the number of threads", nPoints, serialPoints);
+      TS_WARN("Time to complete <EventWSType,Q3D,Indir,ConvFromTOF,CrystType> with " + std::to_string(nThreads) +
+              " threads: " + std::to_string(sec) + " sec, speed-up " + std::to_string(serialTime / sec));
+    }
+    inWsEv->mutableRun().removeProperty("NUM_THREADS");
+  }
+
   void test_HistoFromTOFConv() {
 
     auto pAxis0 = std::make_unique<API::NumericAxis>(2);
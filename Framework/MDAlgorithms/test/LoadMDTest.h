@@ -394,6 +394,72 @@ public:
 
   //=================================================================================================================
 
+  void test_load_region_of_Morton_ordered_file() {
+    // 10x10 boxes with 2 events each, at the box centres
+    std::shared_ptr<MDEventWorkspace<MDLeanEvent<2>, 2>> ws1 = MDEventsTestHelper::makeMDEW<2>(10, 0.0, 10.0, 2);
+    AnalysisDataService::Instance().addOrReplace("LoadMDTest_ws", std::dynamic_pointer_cast<IMDEventWorkspace>(ws1));
+
+    SaveMD2 saver;
+    TS_ASSERT_THROWS_NOTHING(saver.initialize())
+    TS_ASSERT_THROWS_NOTHING(saver.setProperty("InputWorkspace", "LoadMDTest_ws"));
+    TS_ASSERT_THROWS_NOTHING(saver.setPropertyValue("Filename", "LoadMDTestMorton.nxs"));
+    TS_ASSERT_THROWS_NOTHING(saver.setProperty("MortonOrder", true));
+    std::string filename = saver.getPropertyValue("Filename");
+    if (Poco::File(filename).exists())
+      Poco::File(filename).remove();
+    TS_ASSERT_THROWS_NOTHING(saver.execute(););
+    TS_ASSERT(saver.isExecuted());
+
+    std::string outWSName("LoadMDTest_OutputWS");
+    LoadMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Filename", filename));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", outWSName));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("RegionExtents", "0,4.5,0,4.5"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+    auto ws = AnalysisDataService::Instance().retrieveWS<MDEventWorkspace<MDLeanEvent<2>, 2>>(outWSName);
+
+    TSM_ASSERT_EQUALS("Should keep the box structure of the whole workspace",
+                      ws1->getBoxController()->getTotalNumMDBoxes(), ws->getBoxController()->getTotalNumMDBoxes());
+    TSM_ASSERT_EQUALS("Should load the events of the 5x5 boxes overlapping the region only", 50, ws->getNPoints());
+    TS_ASSERT_DELTA(ws->getBox()->getSignal(), 50.0, 1e-6);
+
+    // the whole file loads back unchanged
+    LoadMD loadAll;
+    TS_ASSERT_THROWS_NOTHING(loadAll.initialize())
+    TS_ASSERT_THROWS_NOTHING(loadAll.setPropertyValue("Filename", filename));
+    TS_ASSERT_THROWS_NOTHING(loadAll.setPropertyValue("OutputWorkspace", outWSName));
+    TS_ASSERT_THROWS_NOTHING(loadAll.execute(););
+    ws = AnalysisDataService::Instance().retrieveWS<MDEventWorkspace<MDLeanEvent<2>, 2>>(outWSName);
+    TS_ASSERT_EQUALS(200, ws->getNPoints());
+    MDEventsTestHelper::checkAndDeleteFile(filename);
+
+    AnalysisDataService::Instance().remove(outWSName);
+    AnalysisDataService::Instance().remove("LoadMDTest_ws");
+  }
+
+  void test_RegionExtents_is_rejected_where_no_events_are_loaded() {
+    for (const std::string option : {"FileBackEnd", "MetadataOnly", "BoxStructureOnly"}) {
+      LoadMD alg;
+      TS_ASSERT_THROWS_NOTHING(alg.initialize())
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("RegionExtents", "0,4.5,0,4.5"));
+      TSM_ASSERT("RegionExtents alone is valid", alg.validateInputs().empty());
+
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty(option, true));
+      const auto issues = alg.validateInputs();
+      TSM_ASSERT_EQUALS(option, issues.size(), 1);
+      TSM_ASSERT_EQUALS(option, issues.count("RegionExtents"), 1);
+    }
+  }
+
+  void test_RegionExtents_needs_a_minimum_and_maximum_per_dimension() {
+    LoadMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("RegionExtents", "0,4.5,0"));
+    TS_ASSERT_EQUALS(alg.validateInputs().count("RegionExtents"), 1);
+  }
+
   void testMetaDataOnly() {
     //------ Start by creating the file
     //----------------------------------------------
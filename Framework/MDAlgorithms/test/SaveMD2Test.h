@@ -330,6 +330,33 @@ public:
     MDHistoWorkspace_sptr ws = MDEventsTestHelper::makeFakeMDHistoWorkspace(2.5, 2, 10, 10.0, 3.5, "histo2", 4.5);
     doTestHisto(ws);
   }
+
+  void test_MortonOrder_is_rejected_with_UpdateFileBackEnd() {
+    MDEventWorkspace1Lean::sptr ws = MDEventsTestHelper::makeMDEW<1>(10, 0.0, 10.0, 1);
+    SaveMD2 alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("InputWorkspace", std::dynamic_pointer_cast<IMDWorkspace>(ws)));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Filename", "SaveMD2Test_MortonOrder.nxs"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("MortonOrder", true));
+    TSM_ASSERT("MortonOrder alone is valid", alg.validateInputs().empty());
+
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("UpdateFileBackEnd", true));
+    const auto issues = alg.validateInputs();
+    TS_ASSERT_EQUALS(issues.size(), 1);
+    TS_ASSERT_EQUALS(issues.count("MortonOrder"), 1);
+  }
+
+  void test_MortonOrder_is_rejected_for_MDHistoWorkspace() {
+    MDHistoWorkspace_sptr ws = MDEventsTestHelper::makeFakeMDHistoWorkspace(2.5, 2, 10, 10.0, 3.5, "histo2", 4.5);
+    SaveMD2 alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("InputWorkspace", std::dynamic_pointer_cast<IMDWorkspace>(ws)));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Filename", "SaveMD2Test_MortonOrder.nxs"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("MortonOrder", true));
+    const auto issues = alg.validateInputs();
+    TS_ASSERT_EQUALS(issues.size(), 1);
+    TS_ASSERT_EQUALS(issues.count("MortonOrder"), 1);
+  }
 };
 
 class SaveMD2TestPerformance : public CxxTest::TestSuite {
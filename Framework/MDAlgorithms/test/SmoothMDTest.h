@@ -361,6 +361,43 @@ public:
     TSM_ASSERT("Last index should have a smoothed Value of NaN", std::isnan(out->getSignalAt(9)));
   }
 
+  void test_hat_smoothing_of_sparse_workspace_matches_dense_smoothing() {
+    // 30^3 points over several occupancy tiles, with data in a few places only
+    MDHistoWorkspace_sptr toSmooth = MDEventsTestHelper::makeFakeMDHistoWorkspace(0.0, 3, 30, 10.0, 0.0, "", 0.0);
+    for (const size_t index : {3900, 3901, 4120, 15000, 26999}) {
+      toSmooth->setSignalAt(index, static_cast<double>(index % 7) + 1.);
+      toSmooth->setErrorSquaredAt(index, 0.5);
+    }
+    // A normalization workspace of ones gives the same result, smoothing every point
+    MDHistoWorkspace_sptr ones = MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 3, 30);
+
+    const auto smooth = [&toSmooth](const IMDHistoWorkspace_sptr &normWs) {
+      SmoothMD alg;
+      alg.setChild(true);
+      alg.initialize();
+      alg.setProperty("WidthVector", WidthVector{3, 5, 3});
+      alg.setProperty("InputWorkspace", toSmooth);
+      if (normWs)
+        alg.setProperty("InputNormalizationWorkspace", normWs);
+      alg.setPropertyValue("OutputWorkspace", "dummy");
+      alg.execute();
+      IMDHistoWorkspace_sptr out = alg.getProperty("OutputWorkspace");
+      return out;
+    };
+    const auto sparse = smooth(nullptr);
+    const auto dense = smooth(ones);
+
+    size_t numNonZero = 0;
+    for (size_t i = 0; i < toSmooth->getNPoints(); ++i) {
+      TS_ASSERT_EQUALS(sparse->getSignalAt(i), dense->getSignalAt(i));
+      TS_ASSERT_EQUALS(sparse->getErrorAt(i), dense->getErrorAt(i));
+      if (dense->getSignalAt(i) != 0)
+        ++numNonZero;
+    }
+    // The 3x5x3 neighbourhoods of the filled points, clipped at the edges, 3900 and 3901 sharing most of theirs
+    TS_ASSERT_EQUALS(numNonZero, 45 + 45 + 30 + 12);
+  }
+
   void test_gaussian_kernel_sigma_1() {
     // FWHM of 2.355 equivalent to sigma=1
     const std::vector<double> kernel = Mantid::MDAlgorithms::gaussianKernel(2.355);
@@ -466,6 +503,7 @@ public:
 class SmoothMDTestPerformance : public CxxTest::TestSuite {
 private:
   IMDHistoWorkspace_sptr m_toSmooth;
+  IMDHistoWorkspace_sptr m_sparseToSmooth;
 
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -476,6 +514,13 @@ public:
   SmoothMDTestPerformance() {
     m_toSmooth =
         MDEventsTestHelper::makeFakeMDHistoWorkspace(1 /*signal*/, 2 /*numDims*/, 500 /*numBins in each dimension*/);
+    // Same size, with data in the first 25 rows (5% of the points) only
+    auto sparse = MDEventsTestHelper::makeFakeMDHistoWorkspace(0, 2, 500, 10.0, 0.0, "", 0.0);
+    for (size_t i = 0; i < 25 * 500; ++i) {
+      sparse->setSignalAt(i, 1.0);
+      sparse->setErrorSquaredAt(i, 1.0);
+    }
+    m_sparseToSmooth = sparse;
   }
 
   void test_execute_hat_function() {
@@ -491,6 +536,19 @@ public:
     TS_ASSERT(out);
   }
 
+  void test_execute_hat_function_sparse() {
+    SmoothMD alg;
+    alg.setChild(true);
+    alg.initialize();
+    WidthVector widthVector(1, 5); // Smooth with width == 5
+    alg.setProperty("WidthVector", widthVector);
+    alg.setProperty("InputWorkspace", m_sparseToSmooth);
+    alg.setPropertyValue("OutputWorkspace", "dummy");
+    alg.execute();
+    IMDHistoWorkspace_sptr out = alg.getProperty("OutputWorkspace");
+    TS_ASSERT(out);
+  }
+
   void test_execute_hat_function_with_normalisation() {
     SmoothMD alg;
     alg.setChild(true);
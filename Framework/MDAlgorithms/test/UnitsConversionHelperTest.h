@@ -160,6 +160,10 @@ public:
       E_storage[i] = X[i];
       TOFS[i] = Conv.convertUnits(X[i]);
     }
+    // the batch conversion gives the same values
+    std::vector<double> batchTOFS(X.begin(), X.end());
+    Conv.convertUnits(batchTOFS);
+    TS_ASSERT_EQUALS(batchTOFS, TOFS);
 
     // Let WS know that it is in TOF now (one column)
     auto &T = ws2D->dataX(0);
@@ -187,6 +191,10 @@ public:
     for (size_t i = 0; i < n_bins; i++) {
       TS_ASSERT_DELTA(E_storage[i], Conv.convertUnits(TOFS[i]), 1.e-5);
     }
+    Conv.convertUnits(batchTOFS);
+    for (size_t i = 0; i < n_bins; i++) {
+      TS_ASSERT_EQUALS(batchTOFS[i], Conv.convertUnits(TOFS[i]));
+    }
 
     auto range = Conv.getConversionRange(-1000000000, 1000000000);
     TS_ASSERT_DELTA(t_lim, range.first, 1.e-8);
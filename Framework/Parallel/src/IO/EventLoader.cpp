@@ -45,7 +45,10 @@ void load(const std::string &filename, const std::string &groupname, const std::
           bool precalcEvents) {
   auto concurencyNumber = PARALLEL_GET_MAX_THREADS;
   auto numThreads = std::max<int>(concurencyNumber / 2, 1);
-  auto numProceses = std::max<int>(concurencyNumber / 2, 1);
+  // the number of reading processes can be raised to saturate a parallel file system
+  const auto numProcessesConfigVal =
+      Kernel::ConfigService::Instance().getValue<int>("loadeventnexus.multiprocess.processes");
+  auto numProceses = std::max<int>(numProcessesConfigVal.value_or(concurencyNumber / 2), 1);
   std::string executableName = Kernel::ConfigService::Instance().getPropertiesDir() + "MantidNexusParallelLoader";
 
   MultiProcessEventLoader loader(static_cast<unsigned>(eventLists.size()), numProceses, numThreads, executableName,
@@ -8,6 +8,8 @@
 #include "MantidParallel/IO/MultiProcessEventLoader.h"
 #include "MantidTypes/Event/TofEvent.h"
 
+#include <string>
+
 using namespace Mantid::Parallel::IO;
 using namespace Mantid::Types;
 
@@ -15,10 +17,11 @@ int main(int argc, char **argv) {
   const std::string segmentName(argv[1]);
   const std::string storageName(argv[2]);
   //  unsigned procId = std::atoi(argv[3]);
-  unsigned firstEvent = std::atoi(argv[4]);
-  unsigned upperEvent = std::atoi(argv[5]);
+  // event ranges can exceed 32 bits for large files
+  const std::size_t firstEvent = std::stoull(argv[4]);
+  const std::size_t upperEvent = std::stoull(argv[5]);
   unsigned numPixels = std::atoi(argv[6]);
-  std::size_t size = std::atoll(argv[7]);
+  std::size_t size = std::stoull(argv[7]);
   const std::string fileName(argv[8]);
   const std::string groupName(argv[9]);
   const bool precalcEvents = std::atoi(argv[10]);
@@ -41,12 +41,18 @@ std::string MultiProcessEventLoader::generateStoragename() {
 }
 
 /// Generates "unique" prefix for shared memory stuff
+/** The prefix includes the process id and a counter as well as the time, so
+ * that loads started within the same second, by this or another process, do
+ * not share the shared memory segments.
+ */
 std::string MultiProcessEventLoader::generateTimeBasedPrefix() {
+  static std::atomic<uint32_t> loadCounter{0};
   auto now = std::chrono::system_clock::now();
   auto in_time_t = std::chrono::system_clock::to_time_t(now);
 
   std::stringstream ss;
-  ss << std::put_time(std::localtime(&in_time_t), "%Y%m%d%X");
+  ss << std::put_time(std::localtime(&in_time_t), "%Y%m%d%H%M%S") << '_' << Poco::Process::id() << '_'
+     << loadCounter++;
   return ss.str();
 }
 
@@ -202,7 +208,7 @@ void MultiProcessEventLoader::assembleFromShared(
           ip::shared_memory_object::remove(m_segmentNames[segId].c_str());
 
         while (processCounter[segId] != m_numThreads)
-          ;
+          std::this_thread::yield();
       }
     });
   }
@@ -235,7 +241,7 @@ void MultiProcessEventLoader::fillFromFile(EventsListsShmemStorage &storage, con
 // bytes extra overhead
 size_t MultiProcessEventLoader::estimateShmemAmount(size_t eventCount) const {
   // 8 bytes pointer to allocator + 8 bytes pointer to metadata
-  auto allocationFee = 8 + 8 + generateStoragename().length();
+  auto allocationFee = 8 + 8 + m_storageName.length();
   std::size_t len{(eventCount / m_numProcesses + eventCount % m_numProcesses) * sizeof(TofEvent) +
                   m_numPixels * (sizeof(EventLists) + allocationFee) + sizeof(Chunks) + allocationFee};
   return len;
@@ -13,7 +13,7 @@ It is intended for internal use.
 
 import inspect as _inspect
 
-from mantid.api import AnalysisDataServiceImpl, ITableWorkspace, Workspace, WorkspaceGroup, performBinaryOp
+from mantid.api import AnalysisDataServiceImpl, ITableWorkspace, Workspace, WorkspaceExpression, WorkspaceGroup, performBinaryOp
 from mantid.kernel.funcinspect import customise_func, lhs_info, LazyMethodSignature
 
 
@@ -29,6 +29,9 @@ def attach_binary_operators_to_workspace():
     def add_operator_func(attr, algorithm, inplace, reverse):
         # Wrapper for the function call
         def op_wrapper(self, other):
+            # Let the expression build itself up rather than running the algorithm
+            if isinstance(other, WorkspaceExpression):
+                return NotImplemented
             # Get the result variable to know what to call the output
             result_info = lhs_info()
             # Pass off to helper
@@ -0,0 +1,78 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidPythonInterface/core/Policies/AsType.h"
+#include "MantidPythonInterface/core/ReleaseGlobalInterpreterLock.h"
+
+#include <boost/python/class.hpp>
+#include <boost/python/copy_const_reference.hpp>
+#include <boost/python/init.hpp>
+#include <boost/python/operators.hpp>
+#include <boost/python/other.hpp>
+#include <boost/python/return_value_policy.hpp>
+#include <boost/python/self.hpp>
+
+using Mantid::API::MatrixWorkspace_sptr;
+using Mantid::API::Workspace_sptr;
+using Mantid::API::WorkspaceExpression;
+using Mantid::PythonInterface::ReleaseGlobalInterpreterLock;
+using namespace boost::python;
+namespace Policies = Mantid::PythonInterface::Policies;
+
+namespace {
+/**
+ * Evaluate the expression without holding the GIL. As for the workspace
+ * operators the algorithm is not run as a child so it appears in the history.
+ * @param self :: A reference to the calling object
+ * @param name :: If not empty the result is stored in the ADS with this name
+ * @returns The result of the expression
+ */
+MatrixWorkspace_sptr evaluate(const WorkspaceExpression &self, const std::string &name) {
+  ReleaseGlobalInterpreterLock releaseGIL;
+  return self.evaluate(name, false);
+}
+} // namespace
+
+void export_WorkspaceExpression() {
+  class_<WorkspaceExpression>("WorkspaceExpression",
+                              "An arithmetic expression of workspaces and numbers that is evaluated in a single pass "
+                              "by EvaluateWorkspaceExpression when evaluate() is called",
+                              no_init)
+      .def(init<const MatrixWorkspace_sptr &>((arg("self"), arg("workspace")),
+                                              "Start an expression from a MatrixWorkspace"))
+      .def(init<double>((arg("self"), arg("value")), "Start an expression from a number"))
+
+      .def("evaluate", &evaluate, (arg("self"), arg("name") = ""),
+           return_value_policy<Policies::AsType<Workspace_sptr>>(),
+           "Evaluates the expression. If a name is given the result is also stored in the ADS with that name.")
+
+      .def("__str__", &WorkspaceExpression::str, arg("self"), return_value_policy<copy_const_reference>())
+
+      // ----------------- Operators --------------------------------------
+      .def(-self)
+      .def(self + self)
+      .def(self - self)
+      .def(self * self)
+      .def(self / self)
+      .def(self + other<MatrixWorkspace_sptr>())
+      .def(self - other<MatrixWorkspace_sptr>())
+      .def(self * other<MatrixWorkspace_sptr>())
+      .def(self / other<MatrixWorkspace_sptr>())
+      .def(other<MatrixWorkspace_sptr>() + self)
+      .def(other<MatrixWorkspace_sptr>() - self)
+      .def(other<MatrixWorkspace_sptr>() * self)
+      .def(other<MatrixWorkspace_sptr>() / self)
+      .def(self + double())
+      .def(self - double())
+      .def(self * double())
+      .def(self / double())
+      .def(double() + self)
+      .def(double() - self)
+      .def(double() * self)
+      .def(double() / self);
+}
@@ -5,8 +5,8 @@
 #   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 # SPDX - License - Identifier: GPL - 3.0 +
 # ruff: noqa: F841   # Local variable assigned but not used
-from mantid.api import mtd
-from mantid.simpleapi import CreateSampleWorkspace
+from mantid.api import mtd, WorkspaceExpression
+from mantid.simpleapi import CompareWorkspaces, CreateSampleWorkspace
 import unittest
 
 
@@ -38,6 +38,25 @@ class WorkspaceBinaryOpsTest(unittest.TestCase):
         ws_ads += 1
         self.assertTrue(mtd.doesExist("ws_ads"))
 
+    def test_workspace_expression_matches_chained_operators(self):
+        a = CreateSampleWorkspace(StoreInADS=False)
+        b = CreateSampleWorkspace(StoreInADS=True, OutputWorkspace="b")
+        chained = (a - b) / (b + 1) * 2
+        expression = (WorkspaceExpression(a) - b) / (b + WorkspaceExpression(1.0)) * 2
+        self.assertTrue("'b'" in str(expression))
+
+        fused = expression.evaluate()
+        self.assertFalse(mtd.doesExist("fused"))
+        self.assertTrue(CompareWorkspaces(chained, fused, Tolerance=1e-12, CheckAllData=True)[0])
+        self.assertEqual(fused.getHistory().lastAlgorithm().name(), "EvaluateWorkspaceExpression")
+
+    def test_workspace_operators_defer_to_workspace_expression(self):
+        a = CreateSampleWorkspace(StoreInADS=False)
+        expression = a + WorkspaceExpression(a)
+        self.assertTrue(isinstance(expression, WorkspaceExpression))
+        expression.evaluate("summed")
+        self.assertTrue(mtd.doesExist("summed"))
+
 
 if __name__ == "__main__":
     unittest.main()
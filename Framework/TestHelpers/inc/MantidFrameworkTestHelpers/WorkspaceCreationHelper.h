@@ -137,6 +137,8 @@ Mantid::DataObjects::Workspace2D_sptr create1DWorkspaceConstantWithXerror(int si
                                                                           double xError, bool isHisto = true);
 Mantid::DataObjects::Workspace2D_sptr create2DWorkspace(size_t nhist, size_t numBoundaries);
 Mantid::DataObjects::Workspace2D_sptr create2DWorkspaceWhereYIsWorkspaceIndex(int nhist, int numBoundaries);
+/// Create a 2D workspace whose Y and E differ in every bin
+Mantid::DataObjects::Workspace2D_sptr create2DWorkspaceVaried(int nHist, int nBins, double offset, double error);
 Mantid::DataObjects::Workspace2D_sptr
 create2DWorkspace123(int64_t nHist, int64_t nBins, bool isHist = false,
                      const std::set<int64_t> &maskedWorkspaceIndices = std::set<int64_t>(), bool hasDx = false);
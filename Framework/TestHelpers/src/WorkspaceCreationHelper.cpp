@@ -168,6 +168,26 @@ Workspace2D_sptr create2DWorkspaceWhereYIsWorkspaceIndex(int nhist, int numBound
   return out;
 }
 
+/** Create a Workspace2D whose Y and E differ in every bin
+ * @param nHist :: # histograms
+ * @param nBins :: # of bins
+ * @param offset :: Y value of the first bin of the first histogram
+ * @param error :: E value of the first bin of each histogram
+ * @return Workspace2D
+ */
+Workspace2D_sptr create2DWorkspaceVaried(int nHist, int nBins, double offset, double error) {
+  Workspace2D_sptr out = create2DWorkspaceBinned(nHist, nBins);
+  for (size_t i = 0; i < static_cast<size_t>(nHist); ++i) {
+    auto &y = out->mutableY(i);
+    auto &e = out->mutableE(i);
+    for (size_t j = 0; j < static_cast<size_t>(nBins); ++j) {
+      y[j] = offset + 0.37 * static_cast<double>(i) + 0.11 * static_cast<double>(j);
+      e[j] = error + 0.013 * static_cast<double>(j);
+    }
+  }
+  return out;
+}
+
 Workspace2D_sptr create2DWorkspaceThetaVsTOF(int nHist, int nBins) {
 
   Workspace2D_sptr outputWS = create2DWorkspaceBinned(nHist, nBins);